@@ -180,6 +180,12 @@
 #define SAE_PASSPHRASE                  12345678
 #endif
 
+/* Command throughput example is disabled by default */
+#ifndef ENABLE_THROUGHPUT_EXAMPLE
+/** Set to 1 to measure the agent command rate once the agent has started. */
+#define ENABLE_THROUGHPUT_EXAMPLE       0
+#endif
+
 /** Stringify macro. Do not use directly; use @ref STRINGIFY(). */
 #define _STRINGIFY(x) #x
 /** Convert the content of the given macro to a string. */
@@ -442,6 +448,134 @@ static void beacon_monitor_example_start(struct mmagic_controller *controller)
            beacon_monitor_args.oui_filter.ouis[0].oui[2]);
 }
 
+#if ENABLE_THROUGHPUT_EXAMPLE
+/** Number of commands to issue for each mode of the command throughput example. */
+#define THROUGHPUT_EXAMPLE_NUM_COMMANDS 200
+
+/** Context shared with the response handler of the command throughput example. */
+struct throughput_example_ctx
+{
+    /** Binary semaphore given every time a command completes. */
+    struct mmosal_semb *completed_semb;
+    /** Number of commands that have completed. */
+    volatile uint32_t num_completed;
+    /** Number of commands that completed with an error. */
+    volatile uint32_t num_failed;
+};
+
+/**
+ * Handler invoked when an asynchronous command issued by the throughput example completes.
+ *
+ * @param controller Controller instance handle.
+ * @param tag        Tag of the command that completed.
+ * @param status     Completion status of the command.
+ * @param arg        Reference to the @ref throughput_example_ctx.
+ */
+static void throughput_example_rsp_handler(struct mmagic_controller *controller,
+                                           uint32_t tag,
+                                           enum mmagic_status status,
+                                           void *arg)
+{
+    MM_UNUSED(controller);
+    MM_UNUSED(tag);
+    struct throughput_example_ctx *ctx = (struct throughput_example_ctx *)arg;
+    if (status != MMAGIC_STATUS_OK)
+    {
+        ctx->num_failed++;
+    }
+    ctx->num_completed++;
+    mmosal_semb_give(ctx->completed_semb);
+}
+
+/**
+ * This function measures the rate at which commands can be executed by the agent, first by
+ * issuing them one at a time with the blocking API and then by keeping up to
+ * @c MMAGIC_CONTROLLER_MAX_IN_FLIGHT commands in flight with the asynchronous API.
+ *
+ * @param controller Reference to the controller structure to use.
+ */
+static void command_throughput_example(struct mmagic_controller *controller)
+{
+    /* The responses are discarded so all commands can share a single response buffer. */
+    static struct mmagic_core_sys_get_version_rsp_args version_rsp;
+    /* Static since a response handler may still run after a timeout. */
+    static struct throughput_example_ctx ctx;
+    enum mmagic_status status;
+    uint32_t start_time_ms;
+    uint32_t elapsed_ms;
+    uint32_t num_sent = 0;
+
+    enum {
+        COMPLETION_TIMEOUT_MS = 5000,
+    };
+
+    printf("\n\n#### Example Command Throughput using MMAGIC Controller ####\n\n");
+
+    start_time_ms = mmosal_get_time_ms();
+    for (num_sent = 0; num_sent < THROUGHPUT_EXAMPLE_NUM_COMMANDS; num_sent++)
+    {
+        status = mmagic_controller_sys_get_version(controller, &version_rsp);
+        if (status != MMAGIC_STATUS_OK)
+        {
+            printf("Get version failed with status %d\n", status);
+            return;
+        }
+    }
+    elapsed_ms = mmosal_get_time_ms() - start_time_ms;
+    printf("Blocking:  %u commands in %lu ms (%lu ops/s)\n",
+           THROUGHPUT_EXAMPLE_NUM_COMMANDS,
+           elapsed_ms,
+           (THROUGHPUT_EXAMPLE_NUM_COMMANDS * 1000ul) / (elapsed_ms ? elapsed_ms : 1));
+
+    if (ctx.completed_semb == NULL)
+    {
+        ctx.completed_semb = mmosal_semb_create("throughput");
+        MMOSAL_ASSERT(ctx.completed_semb != NULL);
+    }
+    ctx.num_completed = 0;
+    ctx.num_failed = 0;
+
+    num_sent = 0;
+    start_time_ms = mmosal_get_time_ms();
+    while (ctx.num_completed < THROUGHPUT_EXAMPLE_NUM_COMMANDS)
+    {
+        status = MMAGIC_STATUS_OK;
+        while (num_sent < THROUGHPUT_EXAMPLE_NUM_COMMANDS)
+        {
+            status = mmagic_controller_sys_get_version_async(controller,
+                                                             &version_rsp,
+                                                             throughput_example_rsp_handler,
+                                                             &ctx,
+                                                             NULL);
+            if (status != MMAGIC_STATUS_OK)
+            {
+                break;
+            }
+            num_sent++;
+        }
+
+        if (status != MMAGIC_STATUS_OK && status != MMAGIC_STATUS_UNAVAILABLE)
+        {
+            printf("Get version failed with status %d\n", status);
+            break;
+        }
+
+        /* Wait for a slot to become free (or for the last commands to complete). */
+        if (!mmosal_semb_wait(ctx.completed_semb, COMPLETION_TIMEOUT_MS))
+        {
+            printf("Timed out waiting for responses\n");
+            break;
+        }
+    }
+    elapsed_ms = mmosal_get_time_ms() - start_time_ms;
+    printf("Pipelined: %lu commands in %lu ms (%lu ops/s), %lu failed\n",
+           ctx.num_completed,
+           elapsed_ms,
+           (ctx.num_completed * 1000ul) / (elapsed_ms ? elapsed_ms : 1),
+           ctx.num_failed);
+}
+#endif
+
 /**
  * This function illustrates how to open a tcp client, send and receive some data and close the
  * connection. It is currently hitting a http web-page so we just expect a very basic response from
@@ -767,6 +901,10 @@ agent_started:
     printf("Morse HW version:        %s\n", version_rsp.results.morse_hardware_version.data);
     printf("-----------------------------------\n");
 
+#if ENABLE_THROUGHPUT_EXAMPLE
+    command_throughput_example(controller);
+#endif
+
     if (!wlan_connect(controller))
     {
         printf("Failed to connect\n");
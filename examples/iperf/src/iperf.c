@@ -90,6 +90,30 @@ static uint32_t format_bytes(uint64_t bytes, uint8_t *unit_index)
     return bytes;
 }
 
+/**
+ * Print a latency distribution summary if it contains any samples.
+ *
+ * @param name  Name of the distribution.
+ * @param stats The distribution summary.
+ */
+static void print_latency_stats(const char *name, const struct mmiperf_latency_stats *stats)
+{
+    if (stats->count == 0)
+    {
+        return;
+    }
+
+    printf("  %s (us): min %lu, mean %lu, p50 %lu, p90 %lu, p99 %lu, p99.9 %lu, max %lu\n",
+           name,
+           stats->min_us,
+           stats->mean_us,
+           stats->p50_us,
+           stats->p90_us,
+           stats->p99_us,
+           stats->p999_us,
+           stats->max_us);
+}
+
 /**
  * Handle a report at the end of an iperf transfer.
  *
@@ -109,6 +133,20 @@ static void iperf_report_handler(const struct mmiperf_report *report,
         format_bytes(report->bytes_transferred, &bytes_transferred_unit_index);
 
     printf("\nIperf Report\n");
+    if (report->num_streams > 1)
+    {
+        if (report->stream_index == MMIPERF_STREAM_AGGREGATE)
+        {
+            printf("  Streams: %u (aggregate)\n", report->num_streams);
+        }
+        else
+        {
+            printf("  Stream: %u of %u, DSCP: %u\n",
+                   report->stream_index + 1,
+                   report->num_streams,
+                   report->dscp);
+        }
+    }
     printf("  Remote Address: %s:%d\n", report->remote_addr, report->remote_port);
     printf("  Local Address:  %s:%d\n", report->local_addr, report->local_port);
     printf("  Transferred: %lu %cBytes, duration: %lu ms, bandwidth: %lu kbps\n",
@@ -116,6 +154,13 @@ static void iperf_report_handler(const struct mmiperf_report *report,
            units[bytes_transferred_unit_index],
            report->duration_ms,
            report->bandwidth_kbitpsec);
+    if (report->jitter_us != 0)
+    {
+        printf("  Jitter: %lu us\n", report->jitter_us);
+    }
+    print_latency_stats("One-way latency", &report->one_way_latency);
+    print_latency_stats("Delay variation", &report->delay_variation);
+    print_latency_stats("Round trip time", &report->rtt);
     printf("\n");
 
     if ((report->report_type == MMIPERF_UDP_DONE_SERVER) ||
@@ -203,6 +248,34 @@ static void start_udp_client(void)
     }
     args.report_fn = iperf_report_handler;
 
+    (void)mmconfig_read_uint32("iperf.bandwidth", &args.target_bw);
+
+    char traffic_shape[16] = "block";
+    (void)mmconfig_read_string("iperf.traffic_shape", traffic_shape, sizeof(traffic_shape));
+    if (!strcmp(traffic_shape, "cbr"))
+    {
+        args.traffic_shape = MMIPERF_TRAFFIC_CBR;
+    }
+    else if (!strcmp(traffic_shape, "poisson"))
+    {
+        args.traffic_shape = MMIPERF_TRAFFIC_POISSON;
+    }
+    else if (!strcmp(traffic_shape, "on_off"))
+    {
+        args.traffic_shape = MMIPERF_TRAFFIC_ON_OFF;
+        args.on_time_ms = 1000;
+        args.off_time_ms = 1000;
+        (void)mmconfig_read_uint32("iperf.on_time_ms", &args.on_time_ms);
+        (void)mmconfig_read_uint32("iperf.off_time_ms", &args.off_time_ms);
+    }
+
+    (void)mmconfig_read_bool("iperf.rtt_echo", &args.rtt_echo);
+
+    uint32_t num_streams = 1;
+    (void)mmconfig_read_uint32("iperf.streams", &num_streams);
+    MMOSAL_ASSERT(num_streams <= MMIPERF_MAX_STREAMS);
+    args.num_streams = num_streams;
+
     mmiperf_start_udp_client(&args);
     printf("\nIperf UDP client started, waiting for completion...\n");
 }
@@ -256,6 +329,8 @@ static void start_udp_server(void)
 
     args.report_fn = iperf_report_handler;
 
+    (void)mmconfig_read_bool("iperf.echo", &args.echo);
+
     mmiperf_handle_t iperf_handle = mmiperf_start_udp_server(&args);
     if (iperf_handle == NULL)
     {
@@ -43,6 +43,11 @@
 /** Interval between successive ping requests. */
 #define PING_INTERVAL_MS 1000
 #endif
+#ifndef PING_IN_FLIGHT
+/** Maximum number of ping requests to have outstanding at once. Values greater than 1 allow
+ *  the interval to be shorter than the round-trip time. */
+#define PING_IN_FLIGHT 1
+#endif
 #ifndef POST_PING_DELAY_MS
 /** Delay in ms to wait before terminating connection on completion of ping. */
 #define POST_PING_DELAY_MS 10000
@@ -156,6 +161,10 @@ void app_init(void)
     args.ping_interval_ms = PING_INTERVAL_MS;
     mmconfig_read_uint32("ping.interval", &args.ping_interval_ms);
 
+    uint32_t in_flight = PING_IN_FLIGHT;
+    mmconfig_read_uint32("ping.in_flight", &in_flight);
+    args.max_in_flight = (uint16_t)in_flight;
+
     mmping_start(&args);
     printf("\nPing %s %lu(%lu) bytes of data.\n",
            args.ping_target,
@@ -166,9 +175,15 @@ void app_init(void)
     uint32_t next_update_time_ms = mmosal_get_time_ms() + UPDATE_INTERVAL_MS;
     unsigned last_ping_recv_count = 0;
     mmping_stats(&stats);
+    /* Poll at half the ping interval, but never busy-loop when flooding. */
+    uint32_t poll_interval_ms = args.ping_interval_ms / 2;
+    if (poll_interval_ms == 0)
+    {
+        poll_interval_ms = 1;
+    }
     while (stats.ping_is_running)
     {
-        mmosal_task_sleep(args.ping_interval_ms / 2);
+        mmosal_task_sleep(poll_interval_ms);
         mmping_stats(&stats);
         if (stats.ping_recv_count != last_ping_recv_count ||
             mmosal_time_has_passed(next_update_time_ms))
@@ -210,6 +225,10 @@ void app_init(void)
            stats.ping_min_time_ms,
            stats.ping_avg_time_ms,
            stats.ping_max_time_ms);
+    printf("round-trip p50/p90/p99 = %lu/%lu/%lu ms\n",
+           stats.ping_p50_time_ms,
+           stats.ping_p90_time_ms,
+           stats.ping_p99_time_ms);
 
     /* Delay to allow communications to settle so we measure only idle current */
     PWR_MEAS_DELAY_MS(150);
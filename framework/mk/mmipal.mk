@@ -40,3 +40,5 @@ MMIOT_SRCS_C += $(addprefix $(MMIPAL_DIR)/,$(MMIPAL_SRCS_C))
 MMIOT_SRCS_H += $(addprefix $(MMIPAL_DIR)/,$(MMIPAL_SRCS_H))
 
 MMIOT_INCLUDES += $(MMIPAL_DIR)
+
+CFLAGS-$(MMIPAL_DIR) += -DMMLOG_MODULE=MMLOG_MODULE_NET
@@ -12,6 +12,7 @@ MMIPERF_DIR = src/mmiperf
 
 MMIPERF_SRCS_C += common/mmiperf_common.c
 MMIPERF_SRCS_C += common/mmiperf_data.c
+MMIPERF_SRCS_C += common/mmiperf_histogram.c
 MMIPERF_SRCS_C += common/mmiperf_list.c
 MMIPERF_SRCS_H += common/mmiperf_private.h
 
@@ -6,13 +6,21 @@
 
 MMUTILS_DIR = src/mmutils
 
+# Set MMLOG_TOKENIZED_ENABLED to 1 to log binary records that are decoded on the host by
+# tools/mmlog/mmlog_decode.py instead of formatting log messages on the device.
+ifneq ($(MMLOG_TOKENIZED_ENABLED),)
+BUILD_DEFINES += MMLOG_TOKENIZED_ENABLED=$(MMLOG_TOKENIZED_ENABLED)
+endif
+
 MMUTILS_SRCS_C += mmutils_wlan.c
 MMUTILS_SRCS_C += mmbuf.c
 MMUTILS_SRCS_C += mmcrc.c
+MMUTILS_SRCS_C += mmlog_tokenized.c
 
 MMUTILS_SRCS_H += mmutils.h
 MMUTILS_SRCS_H +=mmbuf.h
 MMUTILS_SRCS_H +=mmcrc.h
+MMUTILS_SRCS_H += mmhist.h
 
 MMIOT_SRCS_C += $(addprefix $(MMUTILS_DIR)/,$(MMUTILS_SRCS_C))
 MMIOT_SRCS_H += $(addprefix $(MMUTILS_DIR)/,$(MMUTILS_SRCS_H))
@@ -19,6 +19,17 @@ ifneq ($(BUILD_MORSELIB_FROM_SOURCE),)
     MMIOT_INCLUDES += $(MORSELIB_SRC_DIR)/umac/rc/mmrc_osal
     MMIOT_INCLUDES += morselib/mmrc/src/core
     CFLAGS-$(MORSELIB_SRC_DIR) += -Wno-c++-compat
+    CFLAGS-$(MORSELIB_SRC_DIR)/umac += -DMMLOG_MODULE=MMLOG_MODULE_UMAC
+    CFLAGS-$(MORSELIB_SRC_DIR)/driver += -DMMLOG_MODULE=MMLOG_MODULE_DRIVER
+    # Set YAPS_RX_READ_AHEAD to a non-empty string to fetch the next YAPS delimiter in the same
+    # bus transaction as each received packet. This reads past the end of the current packet in
+    # the YSL window, so is experimental.
+    ifneq ($(YAPS_RX_READ_AHEAD),)
+        CFLAGS-$(MORSELIB_SRC_DIR)/driver += -DYAPS_RX_READ_AHEAD=1
+    endif
+    # Fragment chains add a field to struct mmpkt, so they are only enabled when morselib and the
+    # application are built together. The prebuilt archives use the original layout.
+    BUILD_DEFINES += MMPKT_FRAG_CHAIN=1
 else
     # Use a prebuilt morselib
     ifneq ($(BUILD_SUPPLICANT_FROM_SOURCE),)
@@ -32,6 +43,10 @@ else
     endif
 endif
 
+# Functionality that is not yet in the prebuilt morselib archives is only available to the rest of
+# the framework when morselib is built from source.
+BUILD_DEFINES += MORSELIB_FROM_SOURCE=$(if $(strip $(BUILD_MORSELIB_FROM_SOURCE)),1,0)
+
 # For MMRC
 BUILD_DEFINES += LOOKAROUND_FAIL_MAX=50
 
@@ -53,7 +68,9 @@ MORSELIB_SRCS_C += morselib/src/umac/core/umac_evtq.c
 MORSELIB_SRCS_C += morselib/src/umac/core/umac_timeout.c 
 MORSELIB_SRCS_C += morselib/src/umac/data/umac_data.c 
 MORSELIB_SRCS_C += morselib/src/umac/data/umac_sta_data.c 
+MORSELIB_SRCS_C += morselib/src/umac/datapath/datapath_airtime.c 
 MORSELIB_SRCS_C += morselib/src/umac/datapath/datapath_defrag.c 
+MORSELIB_SRCS_C += morselib/src/umac/datapath/datapath_twt_hold.c 
 MORSELIB_SRCS_C += morselib/src/umac/datapath/umac_datapath.c 
 MORSELIB_SRCS_C += morselib/src/umac/datapath/umac_datapath_ap.c 
 MORSELIB_SRCS_C += morselib/src/umac/datapath/umac_datapath_sta.c 
@@ -90,6 +107,7 @@ MORSELIB_SRCS_C += morselib/src/umac/stats/umac_stats.c
 MORSELIB_SRCS_C += morselib/src/umac/supplicant_shim/bip.c 
 MORSELIB_SRCS_C += morselib/src/umac/supplicant_shim/ccmp.c 
 MORSELIB_SRCS_C += morselib/src/umac/supplicant_shim/config.c 
+MORSELIB_SRCS_C += morselib/src/umac/supplicant_shim/crypto_offload.c 
 MORSELIB_SRCS_C += morselib/src/umac/supplicant_shim/driver.c 
 MORSELIB_SRCS_C += morselib/src/umac/supplicant_shim/driver_ap.c 
 MORSELIB_SRCS_C += morselib/src/umac/supplicant_shim/eloop.c 
@@ -113,14 +131,17 @@ MORSELIB_SRCS_C += morselib/src/driver/driver.c
 MORSELIB_SRCS_C += morselib/src/driver/driver_task.c 
 MORSELIB_SRCS_C += morselib/src/driver/puff/puff.c 
 MORSELIB_SRCS_C += morselib/src/driver/morse_crc/morse_crc.c 
+MORSELIB_SRCS_C += morselib/src/driver/morse_driver/benchmark.c 
 MORSELIB_SRCS_C += morselib/src/driver/morse_driver/command.c 
 MORSELIB_SRCS_C += morselib/src/driver/morse_driver/coredump.c 
 MORSELIB_SRCS_C += morselib/src/driver/morse_driver/event.c 
 MORSELIB_SRCS_C += morselib/src/driver/morse_driver/ext_host_table.c 
 MORSELIB_SRCS_C += morselib/src/driver/morse_driver/firmware.c 
 MORSELIB_SRCS_C += morselib/src/driver/morse_driver/firmware_mbin.c 
+MORSELIB_SRCS_C += morselib/src/driver/morse_driver/fw_pipeline.c 
 MORSELIB_SRCS_C += morselib/src/driver/morse_driver/hw.c 
 MORSELIB_SRCS_C += morselib/src/driver/morse_driver/ps.c 
+MORSELIB_SRCS_C += morselib/src/driver/morse_driver/ps_policy.c 
 MORSELIB_SRCS_C += morselib/src/driver/morse_driver/skbq.c 
 MORSELIB_SRCS_C += morselib/src/driver/transport/sdio.c 
 MORSELIB_SRCS_C += morselib/src/driver/transport/sdio_spi.c 
@@ -24,6 +24,7 @@ enum mbin_tlv_types
 {
     FIELD_TYPE_FW_TLV_BCF_ADDR = 0x0001,
     FIELD_TYPE_COREDUMP_MEM_REGION = 0x0002,
+    FIELD_TYPE_FW_SEGMENT_DIGEST = 0x0003,
     FIELD_TYPE_MAGIC = 0x8000,
     FIELD_TYPE_FW_SEGMENT = 0x8001,
     FIELD_TYPE_FW_SEGMENT_DEFLATED = 0x8002,
@@ -71,6 +72,22 @@ struct PACKED mbin_deflated_segment_hdr
     uint8_t zlib_header[2];
 };
 
+/**
+ * Payload of a @c FIELD_TYPE_FW_SEGMENT_DIGEST field.
+ *
+ * Describes the contents of the @c FIELD_TYPE_FW_SEGMENT or @c FIELD_TYPE_FW_SEGMENT_DEFLATED
+ * field that immediately follows it. Loaders that do not support this field may skip it.
+ */
+struct PACKED mbin_segment_digest
+{
+    /** Destination base address of the segment. */
+    uint32_t base_address;
+    /** Length of the segment once loaded (i.e., after decompression). */
+    uint32_t length;
+    /** CRC-32 (IEEE 802.3) of the segment once loaded. */
+    uint32_t crc32;
+};
+
 /** Data header in a @c FIELD_TYPE_BCF_REGDOM field. */
 struct PACKED mbin_regdom_hdr
 {
@@ -482,8 +482,12 @@ struct mmpkt *mmhal_wlan_alloc_mmpkt_for_rx(uint8_t pkt_class,
  * within the RX pool. It includes the packet size and the RX metadata
  */
 #ifndef MMHAL_WLAN_MMPKT_RX_MAX_SIZE
+#if defined(MMPKT_FRAG_CHAIN) && MMPKT_FRAG_CHAIN
+#define MMHAL_WLAN_MMPKT_RX_MAX_SIZE (1676)
+#else
 #define MMHAL_WLAN_MMPKT_RX_MAX_SIZE (1672)
 #endif
+#endif
 
 /**
  * Size of the TX pool in blocks.
@@ -10,6 +10,18 @@
  *
  * Utility macros and functions for outputting log messages.
  *
+ * By default log messages are formatted with @c printf at the point of logging. Defining
+ * @c MMLOG_TOKENIZED_ENABLED to 1 at build time instead causes each log message to be written as
+ * a compact binary record (containing the address of a compile-time descriptor followed by the raw
+ * arguments) into a ring buffer that is drained to the log output by a low priority task. The
+ * records can be re-inflated to text on the host using @c tools/mmlog/mmlog_decode.py together
+ * with the ELF file of the application. See @ref mmlog_tokenized_write() for details.
+ *
+ * When @c MMLOG_RUNTIME_LEVELS_ENABLED is set (which is the default when tokenized logging is
+ * enabled), the log level of each @ref mmlog_module can additionally be reduced at runtime using
+ * @ref mmlog_set_module_level(). The runtime level is checked before any of the arguments of the
+ * log message are evaluated. A source file selects its module by defining @c MMLOG_MODULE.
+ *
  * @{
  */
 
@@ -108,6 +120,204 @@ void mm_hexdump(char level,
 /** Application, error, warning, info, and debug messages, plus additional verbose messages. */
 #define MMLOG_LEVEL_VRB (7)
 
+#if !defined(MMLOG_TOKENIZED_ENABLED)
+/** Whether tokenized logging is enabled. */
+#define MMLOG_TOKENIZED_ENABLED (0)
+#endif
+
+#if !defined(MMLOG_RUNTIME_LEVELS_ENABLED)
+/** Whether per-module runtime log levels are enabled. Defaults to on with tokenized logging. */
+#define MMLOG_RUNTIME_LEVELS_ENABLED MMLOG_TOKENIZED_ENABLED
+#endif
+
+/** Modules whose log level can be adjusted at runtime. */
+enum mmlog_module
+{
+    /** Default module, used by source files that do not define @c MMLOG_MODULE. */
+    MMLOG_MODULE_DEFAULT,
+    /** Upper MAC. */
+    MMLOG_MODULE_UMAC,
+    /** Chip driver. */
+    MMLOG_MODULE_DRIVER,
+    /** IP stack and network interface. */
+    MMLOG_MODULE_NET,
+    /** Application. */
+    MMLOG_MODULE_APP,
+    /** Number of modules. Not a valid module. */
+    MMLOG_MODULE_COUNT,
+};
+
+#if !defined(MMLOG_MODULE)
+/** The module that log messages from the current source file belong to. */
+#define MMLOG_MODULE MMLOG_MODULE_DEFAULT
+#endif
+
+/**
+ * Set the runtime log level of the given module.
+ *
+ * Messages above the compile-time log level (@c MMLOG_LEVEL) are compiled out and cannot be
+ * enabled at runtime, so the effective level is the lower of the two.
+ *
+ * @note Only available when @c MMLOG_RUNTIME_LEVELS_ENABLED is set.
+ *
+ * @param module    The module to set the log level for.
+ * @param level     The new log level (e.g., @ref MMLOG_LEVEL_INF).
+ */
+void mmlog_set_module_level(enum mmlog_module module, uint8_t level);
+
+/**
+ * Get the runtime log level of the given module.
+ *
+ * @note Only available when @c MMLOG_RUNTIME_LEVELS_ENABLED is set.
+ *
+ * @param module    The module to get the log level for.
+ *
+ * @returns the runtime log level of the module, or @ref MMLOG_LEVEL_INVALID if @p module is
+ *          not valid.
+ */
+uint8_t mmlog_get_module_level(enum mmlog_module module);
+
+#if MMLOG_RUNTIME_LEVELS_ENABLED
+/** Runtime log level of each module. Use @ref mmlog_set_module_level() to modify. */
+extern uint8_t mmlog_module_levels[MMLOG_MODULE_COUNT];
+
+/**
+ * Convert a log level character (as passed to @c MMLOG) to the corresponding log level.
+ *
+ * @param lvl   The log level character.
+ *
+ * @returns the log level.
+ */
+static inline uint8_t mmlog_level_from_char(char lvl)
+{
+    switch (lvl)
+    {
+        case 'E':
+            return MMLOG_LEVEL_ERR;
+
+        case 'W':
+            return MMLOG_LEVEL_WRN;
+
+        case 'I':
+            return MMLOG_LEVEL_INF;
+
+        case 'D':
+            return MMLOG_LEVEL_DBG;
+
+        default:
+            return MMLOG_LEVEL_VRB;
+    }
+}
+
+/** Evaluates to true if the given log level is enabled for the current module at runtime. */
+#define MMLOG_RUNTIME_LEVEL_ENABLED(_lvl) \
+    (mmlog_module_levels[MMLOG_MODULE] >= mmlog_level_from_char(_lvl))
+#else
+/** Evaluates to true if the given log level is enabled for the current module at runtime. */
+#define MMLOG_RUNTIME_LEVEL_ENABLED(_lvl) (1)
+#endif
+
+/**
+ * Write raw data to the log output.
+ *
+ * This serializes access to the log output with other log writers.
+ *
+ * @param data  Buffer containing data to write.
+ * @param len   Length of data in buffer.
+ */
+void mm_logging_write(const uint8_t *data, size_t len);
+
+/** Value of the first octet of a tokenized log record. Not a printable character. */
+#define MMLOG_TOKENIZED_SYNC (0x1e)
+
+/** Record ID reserved for reporting the number of records that were dropped. */
+#define MMLOG_TOKENIZED_ID_DROPPED (0)
+
+/**
+ * Descriptor for a tokenized log message. One of these is generated at compile time for each
+ * log call site and its address is used as the ID of the message.
+ */
+struct mmlog_tokenized_desc
+{
+    /** The @c printf format string of the message (excluding prefix). */
+    const char *fmt;
+    /** Name of the function the message is logged from. */
+    const char *function;
+    /** Line number the message is logged from. */
+    uint16_t line;
+    /** Log level character (e.g., @c 'E'). */
+    char level;
+};
+
+/**
+ * Write a tokenized log record.
+ *
+ * This does not format the message. Instead, a record is written to the log ring buffer with
+ * the following layout (multi-octet fields are little endian):
+ *
+ * | Offset | Length | Description                                                  |
+ * |--------|--------|--------------------------------------------------------------|
+ * | 0      | 1      | @ref MMLOG_TOKENIZED_SYNC                                    |
+ * | 1      | 1      | Length of the remainder of the record                        |
+ * | 2      | 4      | Address of the @ref mmlog_tokenized_desc (the message ID)    |
+ * | 6      | 4      | Timestamp in milliseconds                                    |
+ * | 10     | 2      | First two characters of the task name                        |
+ * | 12     | n      | Arguments                                                    |
+ *
+ * Integer arguments are encoded as 4 octets, or 8 octets for @c ll and @c j length modifiers.
+ * Floating point arguments are encoded as 8 octet doubles. Strings are encoded as a length octet
+ * followed by the string contents (without terminator), truncated to
+ * @c MMLOG_TOKENIZED_MAX_STR_LEN. If the record would exceed @c MMLOG_TOKENIZED_MAX_RECORD_LEN
+ * then the remaining arguments are omitted.
+ *
+ * If the ring buffer is full the record is dropped. The number of dropped records is reported
+ * by a record with ID @ref MMLOG_TOKENIZED_ID_DROPPED and a single integer argument.
+ *
+ * @param desc  The descriptor of the log message.
+ * @param ...   Arguments matching the format string in @p desc.
+ */
+void mmlog_tokenized_write(const struct mmlog_tokenized_desc *desc, ...);
+
+/**
+ * Black hole @c printf that lets the compiler check the format string and arguments of a
+ * tokenized log message, since @ref mmlog_tokenized_write() only receives them as varargs.
+ * Calls to this are never evaluated.
+ *
+ * @param fmt   The @c printf format string.
+ */
+static inline void __attribute__((format(printf, 1, 2)))
+mmlog_tokenized_check_format(const char *fmt, ...)
+{
+    (void)(fmt);
+}
+
+/**
+ * Initialize tokenized logging and start the task that drains the ring buffer to the log output.
+ *
+ * Invoked by @ref mm_logging_init() when tokenized logging is enabled.
+ */
+void mmlog_tokenized_init(void);
+
+/**
+ * Read whole records from the tokenized log ring buffer.
+ *
+ * This may be used by a platform that drains the log output by other means (for example, from a
+ * DMA completion handler) instead of the drain task. Only one reader may be active at a time.
+ *
+ * @param buf       Buffer to read records into.
+ * @param maxlen    Length of @p buf. Must be at least @c MMLOG_TOKENIZED_MAX_RECORD_LEN.
+ *
+ * @returns the number of octets written to @p buf.
+ */
+size_t mmlog_tokenized_read(uint8_t *buf, size_t maxlen);
+
+/**
+ * Write all records remaining in the tokenized log ring buffer directly to the log output.
+ *
+ * Intended for use on the assert path; does not take any locks.
+ */
+void mmlog_tokenized_flush(void);
+
 /* ANSI Escape Codes for Colours (0;xx) */
 /** ANSI color code: red */
 #define MMLOG_COLOR_RED (31)
@@ -244,9 +454,29 @@ static inline void mm_hexdump_blackhole(const char *title, const uint8_t *buf, s
 #endif
 
 #if MMLOG_LEVEL >= MMLOG_LEVEL_ERR
+#if MMLOG_TOKENIZED_ENABLED
+/** Generic logging macro. */
+#define MMLOG(fmt, _col, _lvl, ...)                                                              \
+    do {                                                                                         \
+        static const struct mmlog_tokenized_desc mmlog_desc = { fmt, __func__, __LINE__, _lvl }; \
+        (void)(_col);                                                                            \
+        if (0)                                                                                   \
+        {                                                                                        \
+            mmlog_tokenized_check_format(fmt, ##__VA_ARGS__);                                    \
+        }                                                                                        \
+        if (MMLOG_RUNTIME_LEVEL_ENABLED(_lvl))                                                   \
+        {                                                                                        \
+            mmlog_tokenized_write(&mmlog_desc, ##__VA_ARGS__);                                   \
+        }                                                                                        \
+    } while (0)
+#else
 /** Generic logging macro. */
 #define MMLOG(fmt, _col, _lvl, ...)                                                            \
     do {                                                                                       \
+        if (!MMLOG_RUNTIME_LEVEL_ENABLED(_lvl))                                                \
+        {                                                                                      \
+            break;                                                                             \
+        }                                                                                      \
         char lvl = (_lvl);                                                                     \
         char col = (_col);                                                                     \
         char short_task_name[3] = { '?', '?', '\0' };                                          \
@@ -261,6 +491,7 @@ static inline void mm_hexdump_blackhole(const char *title, const uint8_t *buf, s
         (void)(short_task_name);                                                               \
         MMLOG_PRINTF(MMLOG_PREFIX_FMT fmt MMLOG_SUFFIX_FMT, MMLOG_PREFIX_ARGS, ##__VA_ARGS__); \
     } while (0)
+#endif
 
 /** Display an ERROR level log message. */
 #define MMLOG_ERR(fmt, ...) MMLOG(fmt, MMLOG_COLOR_RED, 'E', ##__VA_ARGS__)
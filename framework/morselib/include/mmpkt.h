@@ -83,6 +83,16 @@ union mmpkt_metadata_ptr {
  *      |<-----------------------buf_len-------------------------->|
  *     buf
  * @endcode
+ *
+ * If @c MMPKT_FRAG_CHAIN is enabled, an mmpkt may optionally be the head of a fragment chain, in
+ * which case the packet data is the concatenation of the data in the head and in each of the
+ * segments linked from it via @c frag_next. Only the head mmpkt carries metadata. The segments
+ * are owned by the head and are opened, closed and released along with it. See
+ * @ref mmpkt_append_segment().
+ *
+ * @note @c MMPKT_FRAG_CHAIN changes the layout of this structure, so it must be set the same way
+ *       for the application and for morselib. It is enabled when morselib is built from source,
+ *       and must be left disabled when linking against the prebuilt morselib archives.
  */
 struct mmpkt
 {
@@ -100,6 +110,10 @@ struct mmpkt
     const struct mmpkt_ops *ops;
     /** Pointer that can be used to construct linked lists. */
     struct mmpkt *volatile next;
+#if defined(MMPKT_FRAG_CHAIN) && MMPKT_FRAG_CHAIN
+    /** Next data segment if this mmpkt is part of a fragment chain, else @c NULL. */
+    struct mmpkt *frag_next;
+#endif
 #if defined(MMPKT_DEBUG) && MMPKT_DEBUG
     uint32_t debug_magic;
 #endif
@@ -251,8 +265,17 @@ void mmpkt_release(struct mmpkt *mmpkt);
 static inline struct mmpktview *mmpkt_open(struct mmpkt *mmpkt)
 {
 #if defined(MMPKT_DEBUG) && MMPKT_DEBUG
+#if defined(MMPKT_FRAG_CHAIN) && MMPKT_FRAG_CHAIN
+    struct mmpkt *segment;
+    for (segment = mmpkt; segment != NULL; segment = segment->frag_next)
+    {
+        MMOSAL_ASSERT(segment->debug_magic == MMPKT_DEBUG_MAGIC_CLOSED);
+        segment->debug_magic = MMPKT_DEBUG_MAGIC_OPENED;
+    }
+#else
     MMOSAL_ASSERT(mmpkt->debug_magic == MMPKT_DEBUG_MAGIC_CLOSED);
     mmpkt->debug_magic = MMPKT_DEBUG_MAGIC_OPENED;
+#endif
 #endif
     return (struct mmpktview *)mmpkt;
 }
@@ -267,8 +290,13 @@ static inline void mmpkt_close(struct mmpktview **view)
 {
     MMOSAL_ASSERT(view != NULL);
 #if defined(MMPKT_DEBUG) && MMPKT_DEBUG
+#if defined(MMPKT_FRAG_CHAIN) && MMPKT_FRAG_CHAIN
+    struct mmpkt *mmpkt;
+    for (mmpkt = (struct mmpkt *)(*view); mmpkt != NULL; mmpkt = mmpkt->frag_next)
+#else
     struct mmpkt *mmpkt = (struct mmpkt *)(*view);
     if (mmpkt != NULL)
+#endif
     {
         MMOSAL_ASSERT(mmpkt->debug_magic == MMPKT_DEBUG_MAGIC_OPENED);
         mmpkt->debug_magic = MMPKT_DEBUG_MAGIC_CLOSED;
@@ -588,6 +616,145 @@ static inline void mmpkt_set_next(struct mmpkt *mmpkt, struct mmpkt *next)
     mmpkt->next = next;
 }
 
+#if defined(MMPKT_FRAG_CHAIN) && MMPKT_FRAG_CHAIN
+/**
+ * Append a data segment to the fragment chain headed by the given mmpkt.
+ *
+ * Ownership of @p segment (and of any segments already chained to it) passes to the chain; it
+ * will be released when @p head is released. Any metadata attached to @p segment is ignored.
+ *
+ * @note When a chain is transmitted the driver pads the last segment to a multiple of 4 octets,
+ *       so the last segment should have at least 3 octets of space at the end. Segments other
+ *       than the last whose length is not a multiple of 4 cause the packet to be linearized
+ *       into a bounce buffer before being written to the chip.
+ *
+ * @param head      The head of the chain. This must not be in another fragment chain.
+ * @param segment   The segment to append. Must be in the same opened/closed state as @p head.
+ */
+static inline void mmpkt_append_segment(struct mmpkt *head, struct mmpkt *segment)
+{
+#if defined(MMPKT_DEBUG) && MMPKT_DEBUG
+    MMOSAL_ASSERT(head->debug_magic == segment->debug_magic);
+#endif
+    while (head->frag_next != NULL)
+    {
+        head = head->frag_next;
+    }
+    head->frag_next = segment;
+}
+
+/**
+ * Detach the data segments from the fragment chain headed by the given mmpkt.
+ *
+ * After this call @p head is no longer a chain, and the caller takes ownership of the returned
+ * segments (which remain linked to each other).
+ *
+ * @param head  The head of the chain.
+ *
+ * @returns the first segment that was detached, or @c NULL if @p head was not a chain.
+ */
+static inline struct mmpkt *mmpkt_detach_segments(struct mmpkt *head)
+{
+    struct mmpkt *segments = head->frag_next;
+    head->frag_next = NULL;
+    return segments;
+}
+
+/**
+ * Check whether the given mmpkt is the head of a fragment chain.
+ *
+ * @param mmpkt  The mmpkt to check.
+ *
+ * @returns @c true if @p mmpkt has further data segments chained to it.
+ */
+static inline bool mmpkt_is_chained(const struct mmpkt *mmpkt)
+{
+    return mmpkt->frag_next != NULL;
+}
+
+/**
+ * Peek the total length of the data in all segments of an unopened mmpkt.
+ *
+ * @param mmpkt  The unopened mmpkt to operate on.
+ *
+ * @returns the sum of the data lengths of @p mmpkt and all segments chained to it.
+ */
+static inline uint32_t mmpkt_peek_total_length(const struct mmpkt *mmpkt)
+{
+    uint32_t len = 0;
+    for (; mmpkt != NULL; mmpkt = mmpkt->frag_next)
+    {
+        len += mmpkt->data_len;
+    }
+    return len;
+}
+
+/**
+ * Get the total length of the data in all segments of an opened mmpkt.
+ *
+ * @param view  The opened mmpkt to operate on.
+ *
+ * @returns the sum of the data lengths of all segments in the chain.
+ */
+static inline uint32_t mmpkt_get_total_length(struct mmpktview *view)
+{
+#if defined(MMPKT_DEBUG) && MMPKT_DEBUG
+    MMOSAL_ASSERT(((struct mmpkt *)view)->debug_magic == MMPKT_DEBUG_MAGIC_OPENED);
+#endif
+    return mmpkt_peek_total_length((const struct mmpkt *)view);
+}
+
+/**
+ * Get a view of the next data segment in a fragment chain.
+ *
+ * Segments are opened along with the head of the chain, so the returned view must not be
+ * closed separately. The @c mmpkt_get_data_* and @c mmpkt_*_from_* functions may be used on it
+ * to access the segment data.
+ *
+ * @param view  View of the head of the chain or of one of its segments.
+ *
+ * @returns a view of the next segment, or @c NULL if @p view is the last segment.
+ */
+static inline struct mmpktview *mmpkt_get_next_segment(struct mmpktview *view)
+{
+    struct mmpkt *mmpkt = (struct mmpkt *)view;
+#if defined(MMPKT_DEBUG) && MMPKT_DEBUG
+    MMOSAL_ASSERT(mmpkt->debug_magic == MMPKT_DEBUG_MAGIC_OPENED);
+#endif
+    return (struct mmpktview *)mmpkt->frag_next;
+}
+
+/**
+ * Get a view of the last data segment in a fragment chain.
+ *
+ * @param view  View of the head of the chain.
+ *
+ * @returns a view of the last segment (which will be @p view if the mmpkt is not a chain).
+ */
+static inline struct mmpktview *mmpkt_get_last_segment(struct mmpktview *view)
+{
+    struct mmpktview *next;
+    while ((next = mmpkt_get_next_segment(view)) != NULL)
+    {
+        view = next;
+    }
+    return view;
+}
+
+/**
+ * Copy data out of an opened mmpkt, following the fragment chain if present.
+ *
+ * @param view      The opened mmpkt to operate on.
+ * @param offset    Offset within the packet data (across all segments) to start copying from.
+ * @param dst       Buffer to copy data into.
+ * @param len       Maximum number of bytes to copy.
+ *
+ * @returns the number of bytes copied, which will be less than @p len if the packet data ends
+ *          before @p offset + @p len.
+ */
+uint32_t mmpkt_copy_data(struct mmpktview *view, uint32_t offset, uint8_t *dst, uint32_t len);
+#endif
+
 /**
  * Check whether the given pointer is pointing inside the mmpkt's buffer.
  *
@@ -287,6 +287,18 @@ struct mmwlan_duty_cycle_stats
     uint32_t burst_airtime_remaining_us;
     /** Burst window duration (us) - applicable in burst mode only */
     uint32_t burst_window_duration_us;
+    /**
+     * Airtime (us) the host estimates it may still transmit before data frames are paced.
+     *
+     * When the budget is exhausted, data frames are held per access category until enough
+     * airtime has accrued, so a held background frame does not delay voice or video frames.
+     * Once several frames of one access category are held the data path is paused (see
+     * @ref mmwlan_tx_wait_until_ready and @ref mmwlan_register_tx_flow_control_cb). Voice and
+     * video frames may use the whole budget; background and best effort frames leave a quarter
+     * of it in reserve and are dropped if they would have to wait more than two seconds.
+     * Set to @c UINT32_MAX when no duty cycle limit applies.
+     */
+    uint32_t airtime_budget_remaining_us;
 };
 
 /**
@@ -647,6 +659,110 @@ enum mmwlan_status mmwlan_boot(const struct mmwlan_boot_args *args);
  */
 enum mmwlan_status mmwlan_shutdown(void);
 
+/**
+ * Enumeration of firmware load modes used when booting the transceiver.
+ *
+ * @see mmwlan_set_fw_load_mode()
+ */
+enum mmwlan_fw_load_mode
+{
+    /** Always download the complete firmware image (default). */
+    MMWLAN_FW_LOAD_FULL,
+    /**
+     * Read back each firmware segment from the transceiver and only download the segments
+     * whose contents do not match the firmware image.
+     */
+    MMWLAN_FW_LOAD_SKIP_UNCHANGED,
+    /**
+     * Read back each firmware segment from the transceiver and boot it without downloading
+     * anything if every segment matches the firmware image. If any segment does not match
+     * then the complete firmware image is downloaded.
+     */
+    MMWLAN_FW_LOAD_VERIFY_ONLY,
+};
+
+/**
+ * Set the mode used to load firmware the next time the transceiver is booted.
+ *
+ * The modes other than @ref MMWLAN_FW_LOAD_FULL only help where the transceiver memory is
+ * retained while it is shut down, i.e., the transceiver stays powered across
+ * @ref mmwlan_shutdown() and the following boot, so that most of the firmware image is still
+ * present. Each segment is then read back over the bus, which is only quicker than downloading it
+ * where the bus reads faster than the firmware image can be read and decompressed. If the
+ * transceiver was powered off, or the firmware has not been booted since the host started, the
+ * complete firmware image is downloaded without reading anything back.
+ *
+ * The expected contents of each segment are taken from the digest fields of the firmware image
+ * where present. Otherwise they are taken from digests that were recorded by the host when the
+ * segment was last downloaded using a mode other than @ref MMWLAN_FW_LOAD_FULL. Segments for
+ * which no digest is available are always downloaded. If the firmware fails to boot after a
+ * partial download then the complete firmware image is downloaded.
+ *
+ * @note The board configuration file (BCF) is always downloaded.
+ *
+ * @param mode  The firmware load mode to use.
+ *
+ * @return @ref MMWLAN_SUCCESS on success, else an appropriate error code.
+ */
+enum mmwlan_status mmwlan_set_fw_load_mode(enum mmwlan_fw_load_mode mode);
+
+/** Statistics for the most recent firmware load. */
+struct mmwlan_fw_load_stats
+{
+    /** The firmware load mode that was requested. */
+    enum mmwlan_fw_load_mode mode;
+    /**
+     * Time taken to load the firmware and BCF and for the firmware to boot, in milliseconds.
+     * This includes any retries.
+     */
+    uint32_t load_time_ms;
+    /** Number of firmware segments in the firmware image. */
+    uint16_t segments_total;
+    /** Number of firmware segments that were downloaded. */
+    uint16_t segments_loaded;
+    /** Number of firmware segments that were found to be unchanged and were not downloaded. */
+    uint16_t segments_skipped;
+    /** Number of firmware segments whose contents did not match the expected digest. */
+    uint16_t segments_mismatched;
+    /** Whether a complete firmware download was required after a warm load failed. */
+    bool full_reload_fallback;
+    /**
+     * Whether the transceiver memory was found not to have been retained, so the complete
+     * firmware image was downloaded without reading back any segments.
+     */
+    bool memory_not_retained;
+    /**
+     * Time spent reading the firmware image, in milliseconds. This and the following stage
+     * times include any retries.
+     */
+    uint32_t read_time_ms;
+    /** Time spent decompressing firmware segments, in milliseconds. */
+    uint32_t inflate_time_ms;
+    /** Time spent reading back firmware segments to check if they are unchanged. */
+    uint32_t verify_time_ms;
+    /**
+     * Time spent writing firmware segments to the transceiver, in milliseconds. Where the
+     * firmware download is pipelined this overlaps with reading and decompressing.
+     */
+    uint32_t write_time_ms;
+    /**
+     * Time spent waiting for a write buffer to become free, in milliseconds. A large value
+     * indicates that the firmware download is limited by bus throughput.
+     */
+    uint32_t write_wait_time_ms;
+    /** Number of bus write transactions used to download the firmware segments. */
+    uint32_t bus_writes;
+};
+
+/**
+ * Get statistics for the most recent firmware load.
+ *
+ * @param stats  Pointer to a data structure to be filled out on success.
+ *
+ * @return @ref MMWLAN_SUCCESS on success, else an appropriate error code.
+ */
+enum mmwlan_status mmwlan_get_fw_load_stats(struct mmwlan_fw_load_stats *stats);
+
 /**
  * Gets the MAC address of the given interface.
  *
@@ -801,12 +917,16 @@ enum mmwlan_status mmwlan_set_scan_config(const struct mmwlan_scan_config *confi
 /** Minimum value for @c mmwlan_scan_args.dwell_time_ms. */
 #define MMWLAN_SCAN_MIN_DWELL_TIME_MS (15)
 
+/** Maximum number of channels that can be given in @c mmwlan_scan_args.channels. */
+#define MMWLAN_SCAN_MAX_CHANNELS (16)
+
 /**
  * Enumeration of states in Scan mode.
  */
 enum mmwlan_scan_state
 {
-    /** Scan was successful and all channels were scanned. */
+    /** Scan was successful and all channels were scanned, or the scan was stopped early
+     *  because @c mmwlan_scan_args.stop_on_ssid_match was set and the SSID was found. */
     MMWLAN_SCAN_SUCCESSFUL,
     /** Scan was incomplete. One or more channels may have been scanned and therefore an
      *  incomplete set of scan results may still have been received. */
@@ -851,6 +971,21 @@ struct mmwlan_scan_args
      * If set to 0, the device will not return to the home channel during the scan.
      */
     uint32_t dwell_on_home_ms;
+    /**
+     * S1G channel numbers to restrict the scan to. Only the 1 MHz and 2 MHz channels of the
+     * channel list that overlap one of these channels are scanned.
+     * If @c num_channels is zero, all channels in the channel list are scanned.
+     */
+    uint8_t channels[MMWLAN_SCAN_MAX_CHANNELS];
+    /** Number of entries in @c channels. */
+    uint8_t num_channels;
+    /**
+     * If @c true and an SSID is given, stop the scan as soon as a response is received from
+     * a BSS with that SSID.
+     *
+     * @note Channels on which the SSID was recently seen are always scanned first.
+     */
+    bool stop_on_ssid_match;
 };
 
 /**
@@ -870,6 +1005,9 @@ struct mmwlan_scan_args
         .ssid = { 0 },                                            \
         .ssid_len = 0,                                            \
         .dwell_on_home_ms = MMWLAN_SCAN_DEFAULT_DWELL_ON_HOME_MS, \
+        .channels = { 0 },                                        \
+        .num_channels = 0,                                        \
+        .stop_on_ssid_match = false,                              \
     }
 
 /**
@@ -1303,6 +1441,98 @@ enum mmwlan_status mmwlan_set_power_save_mode(enum mmwlan_ps_mode mode);
  */
 enum mmwlan_status mmwlan_set_dynamic_ps_timeout(uint32_t timeout_ms);
 
+/**
+ * Arguments for @ref mmwlan_set_adaptive_ps(). Initialize with @ref MMWLAN_ADAPTIVE_PS_ARGS_INIT.
+ */
+struct mmwlan_adaptive_ps_args
+{
+    /** Whether adaptive power save is enabled. If disabled, the host uses the dynamic power save
+     *  timeout configured with @ref mmwlan_set_dynamic_ps_timeout(). */
+    bool enabled;
+    /** Upper bound on the average additional latency, in microseconds, that traffic may incur
+     *  because the chip had to be woken up. */
+    uint32_t max_avg_wake_latency_us;
+    /** Energy cost of one sleep/wake cycle of the chip, expressed as the equivalent time in
+     *  milliseconds that the chip could have stayed awake for the same energy. */
+    uint32_t wake_energy_ms;
+    /** Minimum timeout after network activity that the adaptive policy may select. */
+    uint32_t min_timeout_ms;
+    /** Maximum timeout after network activity that the adaptive policy may select. */
+    uint32_t max_timeout_ms;
+};
+
+/** Initializer for @ref mmwlan_adaptive_ps_args. */
+#define MMWLAN_ADAPTIVE_PS_ARGS_INIT { false, 1000, 10, 5, 1000 }
+
+/**
+ * Enable or disable adaptive power save.
+ *
+ * When enabled, the host learns the distribution of the time between successive network
+ * activity and uses it to select the timeout after network activity before it releases its veto
+ * on chip sleep. The timeout is chosen to minimize the expected energy (awake time plus the cost
+ * of each sleep/wake cycle) while keeping the expected wake latency within the given bound.
+ *
+ * This only affects the host veto on chip sleep; the timeout used by the chip to notify the AP
+ * that it is going to sleep is still set by @ref mmwlan_set_dynamic_ps_timeout().
+ *
+ * @param args  Adaptive power save arguments.
+ *
+ * @return @ref MMWLAN_SUCCESS on success, else an appropriate error code.
+ */
+enum mmwlan_status mmwlan_set_adaptive_ps(const struct mmwlan_adaptive_ps_args *args);
+
+/** Reasons that the host may wake the chip up. */
+enum mmwlan_ps_wake_reason
+{
+    /** Woken due to recent network activity. */
+    MMWLAN_PS_WAKE_REASON_NETWORK_ACTIVITY,
+    /** Woken because a subsystem of the driver is holding it awake. */
+    MMWLAN_PS_WAKE_REASON_WAKER,
+    /** Woken because of a pending bus transaction. */
+    MMWLAN_PS_WAKE_REASON_PENDING_EVENT,
+    /** Woken because there are frames buffered for transmission. */
+    MMWLAN_PS_WAKE_REASON_TX_BUFFERED,
+    /** Woken by the chip (e.g., because it has received data). */
+    MMWLAN_PS_WAKE_REASON_CHIP,
+    /** Number of wake reasons. Not a valid reason. */
+    MMWLAN_PS_WAKE_REASON_COUNT,
+};
+
+/** Number of bins in the network activity inter-arrival histogram. */
+#define MMWLAN_ADAPTIVE_PS_HIST_BINS (16)
+
+/** Adaptive power save statistics. See @ref mmwlan_get_adaptive_ps_stats(). */
+struct mmwlan_adaptive_ps_stats
+{
+    /** Timeout after network activity currently in use, in milliseconds. */
+    uint32_t timeout_ms;
+    /** Number of times the chip has been woken up by the host. */
+    uint32_t wake_count;
+    /** Number of times the chip was put to sleep only to be woken up again before the break-even
+     *  time (@ref mmwlan_adaptive_ps_args.wake_energy_ms) had elapsed. */
+    uint32_t mispredicted_sleeps;
+    /** Cumulative time the chip has been held awake, by the reason it was woken up. */
+    uint32_t awake_ms[MMWLAN_PS_WAKE_REASON_COUNT];
+    /** Smoothed time taken to wake the chip, in microseconds. */
+    uint32_t wake_latency_us;
+    /** Histogram of the time between successive network activity. Bin 0 counts intervals of 0 ms
+     *  and bin @c n counts intervals in the range [2^(n-1), 2^n) ms, except the last bin which has
+     *  no upper bound. Counts are periodically halved so that old samples decay. */
+    uint16_t inter_arrival_hist[MMWLAN_ADAPTIVE_PS_HIST_BINS];
+};
+
+/**
+ * Get adaptive power save statistics.
+ *
+ * Statistics are collected regardless of whether adaptive power save is enabled, so they can be
+ * used to evaluate the policy against the fixed dynamic power save timeout.
+ *
+ * @param stats Statistics structure to fill.
+ *
+ * @return @ref MMWLAN_SUCCESS on success, else an appropriate error code.
+ */
+enum mmwlan_status mmwlan_get_adaptive_ps_stats(struct mmwlan_adaptive_ps_stats *stats);
+
 /**
  * Sets whether or not non-TIM mode support is enabled.
  * Upon successful non-TIM mode negotiation, the STA will ignore traffic indication map (TIM)
@@ -1701,6 +1931,53 @@ enum mmwlan_status mmwlan_dpp_stop(void);
 /** Maximum limit of connected stations */
 #define MMWLAN_AP_MAX_STAS_LIMIT (20)
 
+/** Default limit on the number of frames buffered for a sleeping STA. */
+#define MMWLAN_DEFAULT_AP_PS_MAX_BUFFERED_FRAMES (32)
+
+/** Default limit on the number of octets buffered for a sleeping STA. */
+#define MMWLAN_DEFAULT_AP_PS_MAX_BUFFERED_BYTES (16384)
+
+/**
+ * Lifetime, in milliseconds, of frames buffered for a STA that did not indicate a listen interval
+ * when it associated. The lifetime counts from when the STA went to sleep or, if later, from when
+ * the frame was queued. Frames are not expired while the STA is awake.
+ */
+#define MMWLAN_DEFAULT_AP_PS_BUFFER_LIFETIME_MS (10000)
+
+/**
+ * Enumeration of policies for selecting the frame to drop when the power save buffer of a
+ * sleeping STA is full.
+ *
+ * @warning ALPHA NOTICE: This is an alpha API that is under development;
+ *          breaking changes may be introduced in future releases.
+ */
+enum mmwlan_ap_ps_drop_policy
+{
+    /**
+     * Drop the buffered frame that has been waiting longest, whatever its access category, to
+     * make room. Where frames were buffered at the same time, the lower priority one is dropped.
+     */
+    MMWLAN_AP_PS_DROP_OLDEST,
+    /** Drop the frame that is being queued. */
+    MMWLAN_AP_PS_DROP_NEWEST,
+};
+
+/**
+ * Enumeration of policies for unicast data frames sent by one associated STA to another.
+ *
+ * @warning ALPHA NOTICE: This is an alpha API that is under development;
+ *          breaking changes may be introduced in future releases.
+ */
+enum mmwlan_ap_intra_bss_policy
+{
+    /** Deliver the frame to the host network stack, which decides whether to route it. */
+    MMWLAN_AP_INTRA_BSS_TO_HOST,
+    /** Queue the frame directly to the destination STA without involving the host stack. */
+    MMWLAN_AP_INTRA_BSS_FORWARD,
+    /** Drop the frame so that associated STAs cannot reach each other (client isolation). */
+    MMWLAN_AP_INTRA_BSS_ISOLATE,
+};
+
 /**
  * Enumeration of STA states.
  *
@@ -1868,6 +2145,22 @@ struct mmwlan_ap_args
      * @ref MMWLAN_UNAVAILABLE until active.
      */
     bool async_start;
+    /**
+     * Maximum number of frames that will be buffered for a STA while it is asleep.
+     *
+     * If zero, the default value of @ref MMWLAN_DEFAULT_AP_PS_MAX_BUFFERED_FRAMES will be used.
+     */
+    uint16_t ps_max_buffered_frames;
+    /**
+     * Maximum number of octets that will be buffered for a STA while it is asleep.
+     *
+     * If zero, the default value of @ref MMWLAN_DEFAULT_AP_PS_MAX_BUFFERED_BYTES will be used.
+     */
+    uint32_t ps_max_buffered_bytes;
+    /** Frame to drop when the power save buffer of a sleeping STA is full. */
+    enum mmwlan_ap_ps_drop_policy ps_drop_policy;
+    /** Handling of unicast data frames sent by one associated STA to another. */
+    enum mmwlan_ap_intra_bss_policy intra_bss_policy;
 };
 
 /**
@@ -1875,26 +2168,30 @@ struct mmwlan_ap_args
  *
  * @see mmwlan_ap_args
  */
-#define MMWLAN_AP_ARGS_INIT              \
-    {                                    \
-        .ssid = { 0 },                   \
-        .ssid_len = 0,                   \
-        .bssid = { 0 },                  \
-        .security_type = MMWLAN_OPEN,    \
-        .passphrase = { 0 },             \
-        .passphrase_len = 0,             \
-        .pmf_mode = MMWLAN_PMF_REQUIRED, \
-        .sae_owe_ec_groups = { 0 },      \
-        .op_class = 0,                   \
-        .s1g_chan_num = 0,               \
-        .beacon_interval_tus = 0,        \
-        .dtim_period = 0,                \
-        .pri_bw_mhz = 0,                 \
-        .pri_1mhz_chan_idx = 0,          \
-        .sta_status_cb = NULL,           \
-        .sta_status_cb_arg = NULL,       \
-        .max_stas = 0,                   \
-        .async_start = false,            \
+#define MMWLAN_AP_ARGS_INIT                              \
+    {                                                    \
+        .ssid = { 0 },                                   \
+        .ssid_len = 0,                                   \
+        .bssid = { 0 },                                  \
+        .security_type = MMWLAN_OPEN,                    \
+        .passphrase = { 0 },                             \
+        .passphrase_len = 0,                             \
+        .pmf_mode = MMWLAN_PMF_REQUIRED,                 \
+        .sae_owe_ec_groups = { 0 },                      \
+        .op_class = 0,                                   \
+        .s1g_chan_num = 0,                               \
+        .beacon_interval_tus = 0,                        \
+        .dtim_period = 0,                                \
+        .pri_bw_mhz = 0,                                 \
+        .pri_1mhz_chan_idx = 0,                          \
+        .sta_status_cb = NULL,                           \
+        .sta_status_cb_arg = NULL,                       \
+        .max_stas = 0,                                   \
+        .async_start = false,                            \
+        .ps_max_buffered_frames = 0,                     \
+        .ps_max_buffered_bytes = 0,                      \
+        .ps_drop_policy = MMWLAN_AP_PS_DROP_OLDEST,      \
+        .intra_bss_policy = MMWLAN_AP_INTRA_BSS_TO_HOST, \
     }
 
 /**
@@ -2571,6 +2868,75 @@ typedef void (*mmwlan_tx_flow_control_cb_t)(enum mmwlan_tx_flow_control_state st
  */
 enum mmwlan_status mmwlan_register_tx_flow_control_cb(mmwlan_tx_flow_control_cb_t cb, void *arg);
 
+/**
+ * Arguments for @ref mmwlan_twt_set_tx_hold(). Initialize with @ref MMWLAN_TWT_TX_HOLD_ARGS_INIT.
+ */
+struct mmwlan_twt_tx_hold_args
+{
+    /** Whether to hold non-urgent frames until the next TWT service period. */
+    bool enabled;
+    /** Maximum time in milliseconds that a frame of each TID may be held. A value of 0 marks the
+     *  TID as urgent: its frames are never held, and sending one also releases any held frames. */
+    uint16_t max_hold_ms[MMWLAN_MAX_QOS_TID + 1];
+    /** Maximum number of frames to hold. When reached, all held frames are released. */
+    uint16_t max_held_frames;
+};
+
+/**
+ * Initializer for @ref mmwlan_twt_tx_hold_args. Background and best effort TIDs may be held;
+ * video and voice TIDs are urgent.
+ */
+#define MMWLAN_TWT_TX_HOLD_ARGS_INIT { false, { 1000, 2000, 2000, 1000, 0, 0, 0, 0 }, 32 }
+
+/**
+ * Configure holding of transmit frames until the next TWT service period.
+ *
+ * When enabled and a TWT agreement is installed, frames for non-urgent TIDs are held in the
+ * UMAC instead of being sent immediately. Held frames are released together at the start of the
+ * next service period, so that they can be aggregated and sent in a single wake of the chip.
+ * They are released early if a frame has been held for longer than its TID's maximum hold
+ * time, if the number of held frames reaches the limit, or if an urgent frame is sent.
+ *
+ * The host does not have access to the chip TSF, so the service period schedule is estimated
+ * from the time the agreement was installed and is re-aligned on each frame received from the AP.
+ *
+ * @param args  Hold configuration.
+ *
+ * @return @ref MMWLAN_SUCCESS on success, else an appropriate error code.
+ */
+enum mmwlan_status mmwlan_twt_set_tx_hold(const struct mmwlan_twt_tx_hold_args *args);
+
+/** TWT transmit hold statistics. See @ref mmwlan_twt_get_tx_hold_stats(). */
+struct mmwlan_twt_tx_hold_stats
+{
+    /** Number of frames that have been held. */
+    uint32_t frames_held;
+    /** Number of times held frames were released at the start of a service period. */
+    uint32_t released_at_sp;
+    /** Number of times held frames were released because the maximum hold time was reached. */
+    uint32_t released_on_deadline;
+    /** Number of times held frames were released because the hold queue was full. */
+    uint32_t released_on_overflow;
+    /** Number of times held frames were released along with an urgent frame. */
+    uint32_t released_with_urgent;
+    /** Number of frames that have been released. */
+    uint32_t frames_released;
+    /** Number of bytes (including 802.3 header) that have been released. */
+    uint32_t bytes_released;
+};
+
+/**
+ * Get TWT transmit hold statistics.
+ *
+ * Together with the power save accounting in the UMAC statistics, these can be used to derive
+ * the number of chip wakes per hour and the awake time per delivered byte.
+ *
+ * @param stats Statistics structure to fill.
+ *
+ * @return @ref MMWLAN_SUCCESS on success, else an appropriate error code.
+ */
+enum mmwlan_status mmwlan_twt_get_tx_hold_stats(struct mmwlan_twt_tx_hold_stats *stats);
+
 /** Arguments for fatal error handler. */
 struct mmwlan_fatal_error_args
 {
@@ -2819,6 +3185,85 @@ enum mmwlan_status mmwlan_ate_execute_command(uint8_t *command,
                                               uint8_t *response,
                                               uint32_t *response_len);
 
+/** Maximum payload length of a packet sent by @ref mmwlan_bus_benchmark(). */
+#define MMWLAN_BUS_BENCHMARK_MAX_PKT_LEN (1496)
+
+/** Minimum payload length of a packet sent by @ref mmwlan_bus_benchmark(). */
+#define MMWLAN_BUS_BENCHMARK_MIN_PKT_LEN (16)
+
+/** Maximum number of packets that @ref mmwlan_bus_benchmark() can have outstanding at once. */
+#define MMWLAN_BUS_BENCHMARK_MAX_BATCH_DEPTH (32)
+
+/** Arguments for @ref mmwlan_bus_benchmark(). */
+struct mmwlan_bus_benchmark_args
+{
+    /** Payload length of each loopback packet in octets. Must be in the range
+     *  @ref MMWLAN_BUS_BENCHMARK_MIN_PKT_LEN to @ref MMWLAN_BUS_BENCHMARK_MAX_PKT_LEN. */
+    uint32_t pkt_len;
+    /** Number of loopback packets to send. */
+    uint32_t num_pkts;
+    /** Maximum number of packets to have queued or in flight at once (1 to
+     *  @ref MMWLAN_BUS_BENCHMARK_MAX_BATCH_DEPTH). */
+    uint32_t batch_depth;
+    /** Maximum time to wait for the benchmark to complete, in milliseconds. */
+    uint32_t timeout_ms;
+};
+
+/** Initializer for @ref mmwlan_bus_benchmark_args. */
+#define MMWLAN_BUS_BENCHMARK_ARGS_INIT { MMWLAN_BUS_BENCHMARK_MAX_PKT_LEN, 1000, 8, 5000 }
+
+/** Results of @ref mmwlan_bus_benchmark(). */
+struct mmwlan_bus_benchmark_result
+{
+    /** Number of loopback packets that were sent to the chip. */
+    uint32_t num_sent;
+    /** Number of loopback packets that were received back from the chip. */
+    uint32_t num_received;
+    /** Time from the first packet being queued until the last packet was received, in
+     *  milliseconds. */
+    uint32_t duration_ms;
+    /** Payload throughput in each direction, in bytes per second. */
+    uint32_t throughput_bytes_per_s;
+    /** Number of packets received per second. */
+    uint32_t pkts_per_s;
+    /** Minimum round trip latency from queuing a packet until it was received back, in
+     *  microseconds. The resolution is limited to that of the OS tick. */
+    uint32_t latency_min_us;
+    /** Median round trip latency in microseconds. */
+    uint32_t latency_p50_us;
+    /** 90th percentile round trip latency in microseconds. */
+    uint32_t latency_p90_us;
+    /** 99th percentile round trip latency in microseconds. */
+    uint32_t latency_p99_us;
+    /** Maximum round trip latency in microseconds. */
+    uint32_t latency_max_us;
+    /** Time that the driver task spent processing events during the benchmark, in
+     *  milliseconds. This approximates the host CPU time consumed by the bus and datapath. */
+    uint32_t driver_busy_ms;
+};
+
+/**
+ * Measure the throughput and latency of the host interface between the host and the chip.
+ *
+ * Loopback packets are streamed through the normal driver transmit path to the chip, which
+ * returns them to the host. This exercises the SPI/SDIO bus and the driver's queueing and chip
+ * interface handling without involving the air interface, which helps to isolate the cause of
+ * datapath performance problems.
+ *
+ * The benchmark blocks the calling thread until all packets have been returned or
+ * @c timeout_ms has elapsed. It should not be run while there is other traffic, since that
+ * traffic will share the bus and affect the results.
+ *
+ * @param args   Benchmark arguments. Initialize with @ref MMWLAN_BUS_BENCHMARK_ARGS_INIT.
+ * @param result Pointer to a structure to receive the results. This is filled in even if the
+ *               benchmark times out.
+ *
+ * @return @ref MMWLAN_SUCCESS if all packets were returned, @ref MMWLAN_TIMED_OUT if the
+ *         timeout elapsed first, else an appropriate error code.
+ */
+enum mmwlan_status mmwlan_bus_benchmark(const struct mmwlan_bus_benchmark_args *args,
+                                        struct mmwlan_bus_benchmark_result *result);
+
 /** @} */
 
 #ifdef __cplusplus
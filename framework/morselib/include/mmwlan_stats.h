@@ -12,6 +12,8 @@
 
 #include <stdint.h>
 
+#include "mmwlan.h"
+
 /**
  * @ingroup MMWLAN_STATS
  * @{
@@ -41,6 +43,31 @@ enum mmwlan_stats_connect_timestamp_index
     MMWLAN_STATS_CONNECT_TIMESTAMP_N_ENTRIES
 };
 
+/**
+ * Enumeration of valid indexes for ps_awake_ms_by_waker and ps_wake_count_by_waker.
+ */
+enum mmwlan_stats_ps_waker_index
+{
+    MMWLAN_STATS_PS_WAKER_UMAC,
+    MMWLAN_STATS_PS_WAKER_PAGESET,
+    MMWLAN_STATS_PS_WAKER_COMMAND,
+    MMWLAN_STATS_PS_WAKER_IRQ,
+    MMWLAN_STATS_PS_WAKER_BENCHMARK,
+    MMWLAN_STATS_PS_WAKER_N_ENTRIES
+};
+
+/**
+ * Enumeration of valid indexes for the per access category TX queue counters.
+ */
+enum mmwlan_stats_ac_index
+{
+    MMWLAN_STATS_AC_BE,
+    MMWLAN_STATS_AC_BK,
+    MMWLAN_STATS_AC_VI,
+    MMWLAN_STATS_AC_VO,
+    MMWLAN_STATS_AC_N_ENTRIES
+};
+
 /**
  * Data structure to contain all stats from the UMAC.
  * @warning This is not considered stable API and may change between releases.
@@ -117,6 +144,67 @@ struct mmwlan_stats_umac_data
     /** Number of frames sent by the driver that timed out before receiving a TX status from the
      *  chip. */
     uint32_t datapath_driver_tx_pending_status_timeout;
+
+    /** Number of packets that the driver has read from the chip. */
+    uint32_t datapath_driver_rx_packets;
+
+    /** Number of bus read transactions that the driver has performed to read packets from the
+     *  chip. Dividing this by @c datapath_driver_rx_packets gives the average number of
+     *  transactions per RX packet. */
+    uint32_t datapath_driver_rx_read_transactions;
+
+    /** Cumulative time in milliseconds that the host has held the chip awake, per wake reason.
+     *  Time is counted against every reason that applied, so entries may overlap. */
+    uint32_t ps_awake_ms_by_reason[MMWLAN_PS_WAKE_REASON_COUNT];
+
+    /** Number of times the host has woken the chip, per wake reason. A wake is counted against
+     *  every reason that applied. */
+    uint32_t ps_wake_count_by_reason[MMWLAN_PS_WAKE_REASON_COUNT];
+
+    /** Cumulative time in milliseconds that the host has held the chip awake while each driver
+     *  subsystem was holding it awake. */
+    uint32_t ps_awake_ms_by_waker[MMWLAN_STATS_PS_WAKER_N_ENTRIES];
+
+    /** Number of times the host has woken the chip while each driver subsystem was holding it
+     *  awake. */
+    uint32_t ps_wake_count_by_waker[MMWLAN_STATS_PS_WAKER_N_ENTRIES];
+
+    /** Cumulative time in milliseconds that the driver task has spent processing events. */
+    uint32_t driver_task_busy_ms;
+
+    /** High water mark in terms of octets of packet buffer (including the mmpkt header) held
+     *  for reassembly, including the buffer the fragments are reassembled into. */
+    uint32_t datapath_rx_defrag_bytes_high_water_mark;
+
+    /** Number of frames queued for transmission to a peer, per access category. */
+    uint32_t datapath_txq_frames_queued_by_ac[MMWLAN_STATS_AC_N_ENTRIES];
+
+    /** Number of frames dropped from a peer's transmit queues, per access category. */
+    uint32_t datapath_txq_frames_dropped_by_ac[MMWLAN_STATS_AC_N_ENTRIES];
+
+    /** Number of frames dropped because a sleeping STA's power-save buffer was full. */
+    uint32_t datapath_txq_ps_frames_dropped;
+
+    /** Number of frames dropped because their power-save buffering lifetime expired. */
+    uint32_t datapath_txq_ps_frames_expired;
+
+    /** Number of times a data frame was held back because the airtime budget was exhausted. */
+    uint32_t datapath_tx_airtime_deferrals;
+
+    /** Number of low priority frames dropped because the airtime budget could not cover them. */
+    uint32_t datapath_txq_airtime_frames_dropped;
+
+    /** Number of frames received from one associated STA and queued directly to another. */
+    uint32_t datapath_rx_intra_bss_forwarded;
+
+    /** Number of frames between associated STAs dropped by the intra-BSS isolation policy. */
+    uint32_t datapath_rx_intra_bss_isolated;
+
+    /**
+     * Number of frames between associated STAs that could not be forwarded, because the TX
+     * datapath was paused or the frame could not be allocated or queued.
+     */
+    uint32_t datapath_rx_intra_bss_dropped;
 };
 
 /** @} */
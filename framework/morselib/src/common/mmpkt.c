@@ -6,8 +6,13 @@
 #include "mmlog.h"
 #include "mmpkt.h"
 #include "mmosal.h"
+#include "mmutils.h"
 #include "common/common.h"
 
+#if !(defined(MMPKT_FRAG_CHAIN) && MMPKT_FRAG_CHAIN)
+#error morselib must be built with MMPKT_FRAG_CHAIN enabled
+#endif
+
 static const struct mmpkt_ops mmpkt_heap_ops = { .free_mmpkt = mmosal_free };
 
 struct mmpkt *mmpkt_alloc_on_heap(uint32_t space_at_start,
@@ -50,16 +55,41 @@ struct mmpkt *mmpkt_alloc_on_heap(uint32_t space_at_start,
 
 void mmpkt_release(struct mmpkt *mmpkt)
 {
-    if (mmpkt == NULL)
+    while (mmpkt != NULL)
     {
-        return;
-    }
+        struct mmpkt *next = mmpkt->frag_next;
 
 #if defined(MMPKT_DEBUG) && MMPKT_DEBUG
-    MMOSAL_ASSERT(mmpkt->debug_magic == MMPKT_DEBUG_MAGIC_CLOSED);
-    mmpkt->debug_magic = MMPKT_DEBUG_MAGIC_RELEASED;
+        MMOSAL_ASSERT(mmpkt->debug_magic == MMPKT_DEBUG_MAGIC_CLOSED);
+        mmpkt->debug_magic = MMPKT_DEBUG_MAGIC_RELEASED;
 #endif
 
-    MMOSAL_ASSERT(mmpkt->ops != NULL && mmpkt->ops->free_mmpkt != NULL);
-    mmpkt->ops->free_mmpkt(mmpkt);
+        MMOSAL_ASSERT(mmpkt->ops != NULL && mmpkt->ops->free_mmpkt != NULL);
+        mmpkt->ops->free_mmpkt(mmpkt);
+        mmpkt = next;
+    }
+}
+
+uint32_t mmpkt_copy_data(struct mmpktview *view, uint32_t offset, uint8_t *dst, uint32_t len)
+{
+    uint32_t copied = 0;
+
+    for (; view != NULL && copied < len; view = mmpkt_get_next_segment(view))
+    {
+        uint32_t seg_len = mmpkt_get_data_length(view);
+        uint32_t n;
+
+        if (offset >= seg_len)
+        {
+            offset -= seg_len;
+            continue;
+        }
+
+        n = MM_MIN(seg_len - offset, len - copied);
+        memcpy(dst + copied, mmpkt_get_data_start(view) + offset, n);
+        copied += n;
+        offset = 0;
+    }
+
+    return copied;
 }
@@ -2376,6 +2376,30 @@ enum dot11_aci
 };
 
 
+static inline enum dot11_aci dot11_tid_to_aci(uint8_t tid)
+{
+    switch (tid)
+    {
+        case 1:
+        case 2:
+            return DOT11_ACI_AC_BK;
+
+        case 4:
+        case 5:
+            return DOT11_ACI_AC_VI;
+
+        case 6:
+        case 7:
+            return DOT11_ACI_AC_VO;
+
+        case 0:
+        case 3:
+        default:
+            return DOT11_ACI_AC_BE;
+    }
+}
+
+
 enum dot11_twt_setup_cmd
 {
     DOT11_TWT_SETUP_CMD_REQUEST = 0,
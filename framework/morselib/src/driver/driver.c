@@ -13,6 +13,7 @@
 #include "mmdrv.h"
 #include "mmutils.h"
 #include "mmwlan.h"
+#include "driver/morse_driver/benchmark.h"
 #include "driver/morse_driver/firmware.h"
 #include "driver/morse_driver/skb_header.h"
 #include "driver/morse_driver/command.h"
@@ -410,6 +411,16 @@ enum mmwlan_status mmdrv_get_bcf_metadata(struct mmwlan_bcf_metadata *metadata)
     return errno_to_status(morse_bcf_get_metadata(metadata));
 }
 
+void mmdrv_set_fw_load_mode(enum mmwlan_fw_load_mode mode)
+{
+    morse_firmware_set_load_mode(mode);
+}
+
+void mmdrv_get_fw_load_stats(struct mmwlan_fw_load_stats *stats)
+{
+    morse_firmware_get_load_stats(stats);
+}
+
 enum mmwlan_status mmdrv_set_param(uint16_t vif_id, enum morse_param_id param_id, uint32_t value)
 {
     struct morse_cmd_req_get_set_generic_param cmd =
@@ -1087,6 +1098,27 @@ enum mmwlan_status mmdrv_set_dynamic_ps_timeout(uint32_t timeout_ms)
     return errno_to_status(morse_ps_set_dynamic_ps_timeout(&driver_data, timeout_ms));
 }
 
+enum mmwlan_status mmdrv_set_adaptive_ps(const struct mmwlan_adaptive_ps_args *args)
+{
+    if (!driver_data.started)
+    {
+        return MMWLAN_NOT_RUNNING;
+    }
+
+    return errno_to_status(morse_ps_set_adaptive(&driver_data, args));
+}
+
+enum mmwlan_status mmdrv_get_adaptive_ps_stats(struct mmwlan_adaptive_ps_stats *stats)
+{
+    if (!driver_data.started)
+    {
+        return MMWLAN_NOT_RUNNING;
+    }
+
+    morse_ps_get_adaptive_stats(&driver_data, stats);
+    return MMWLAN_SUCCESS;
+}
+
 enum mmwlan_status mmdrv_tx_frame(struct mmpkt *mmpkt, bool is_mgmt)
 {
     struct mmdrv_tx_metadata *tx_metadata = mmdrv_get_tx_metadata(mmpkt);
@@ -1362,6 +1394,17 @@ enum mmwlan_status mmdrv_trigger_core_assert(uint32_t core_id)
     return morse_cmd_tx(&driver_data, NULL, (struct morse_cmd_req *)&cmd, 0, 0, false);
 }
 
+enum mmwlan_status mmdrv_bus_benchmark(const struct mmwlan_bus_benchmark_args *args,
+                                       struct mmwlan_bus_benchmark_result *result)
+{
+    if (!driver_data.started)
+    {
+        return MMWLAN_NOT_RUNNING;
+    }
+
+    return morse_benchmark_run(&driver_data, args, result);
+}
+
 enum mmwlan_status mmdrv_set_cqm_rssi(uint16_t vif_id, int32_t threshold, uint32_t hysteresis)
 {
     if (!driver_data.started)
@@ -8,6 +8,7 @@
 #include <stdatomic.h>
 #include "mmosal.h"
 #include "driver.h"
+#include "driver/morse_driver/benchmark.h"
 #include "driver/morse_driver/morse.h"
 #include "driver/morse_driver/ps.h"
 #include "driver/beacon/beacon.h"
@@ -146,6 +147,8 @@ void driver_task_main(void *arg)
         int32_t relative_next_evt_time;
         uint32_t next_scheduled_evt_time = 0;
 
+        uint32_t busy_start_ms = mmosal_get_time_ms();
+
         driver_task_process_scheduled_evts(driverd);
 
         while (driverd->driver_task.pending_evts != 0)
@@ -179,6 +182,10 @@ void driver_task_main(void *arg)
             break;
         }
 
+        uint32_t busy_ms = mmosal_get_time_ms() - busy_start_ms;
+        morse_benchmark_add_driver_busy_time(busy_ms);
+        mmdrv_host_stats_add_driver_task_busy_time(busy_ms);
+
         MMLOG_DBG("No more events...\n");
 
         relative_next_evt_time = DRV_TASK_MAX_SLEEP_MS;
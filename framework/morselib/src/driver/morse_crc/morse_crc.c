@@ -83,3 +83,23 @@ uint8_t morse_yaps_crc(uint32_t word)
     word = htobe32(word & 0x1ffffff);
     return morse_crc7_sd(0, &word, sizeof(word));
 }
+
+
+static const uint32_t crc32_nibble_lookup_table[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+};
+
+
+uint32_t morse_crc32(uint32_t crc, const void *data, size_t data_len)
+{
+    const uint8_t *d = (const uint8_t *)data;
+
+    crc = ~crc;
+    while (data_len--)
+    {
+        crc = crc32_nibble_lookup_table[(crc ^ *d) & 0x0f] ^ (crc >> 4);
+        crc = crc32_nibble_lookup_table[(crc ^ (*d++ >> 4)) & 0x0f] ^ (crc >> 4);
+    }
+    return ~crc;
+}
@@ -17,3 +17,6 @@ uint16_t morse_crc16_xmodem(uint16_t crc, const void *data, size_t data_len);
 
 
 uint8_t morse_yaps_crc(uint32_t word);
+
+
+uint32_t morse_crc32(uint32_t crc, const void *data, size_t data_len);
@@ -0,0 +1,287 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "mmdrv.h"
+#include "mmhist.h"
+#include "mmhal_wlan.h"
+#include "mmosal.h"
+#include "mmutils.h"
+#include "morse.h"
+#include "ps.h"
+#include "skbq.h"
+#include "driver/driver.h"
+
+
+#define BENCHMARK_MAGIC (0x4d4d4c42ul)
+
+
+#define BENCHMARK_ALLOC_RETRY_MS (2)
+
+
+#define BENCHMARK_HIST_SUB_BUCKET_BITS (2)
+#define BENCHMARK_HIST_MAX_VALUE_BITS  (24)
+#define BENCHMARK_HIST_NUM_BUCKETS \
+    MMHIST_NUM_BUCKETS(BENCHMARK_HIST_SUB_BUCKET_BITS, BENCHMARK_HIST_MAX_VALUE_BITS)
+
+
+struct MM_PACKED benchmark_pkt_hdr
+{
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t tx_time_ticks;
+    uint32_t run_id;
+};
+
+MM_STATIC_ASSERT(sizeof(struct benchmark_pkt_hdr) <= MMWLAN_BUS_BENCHMARK_MIN_PKT_LEN,
+                 "Benchmark header must fit in the smallest packet");
+
+struct benchmark_state
+{
+    volatile bool active;
+    uint32_t run_id;
+    struct mmosal_semb *semb;
+    volatile uint32_t num_outstanding;
+    volatile uint32_t num_received;
+    volatile uint32_t last_rx_time_ms;
+    volatile uint32_t driver_busy_ms;
+    uint32_t latency_min_us;
+    uint32_t latency_max_us;
+    uint16_t latency_hist[BENCHMARK_HIST_NUM_BUCKETS];
+};
+
+static struct benchmark_state benchmark;
+
+static uint32_t benchmark_ticks_to_us(uint32_t ticks)
+{
+    return (uint32_t)((uint64_t)ticks * 1000000 / mmosal_ticks_per_second());
+}
+
+static uint32_t benchmark_hist_percentile(uint32_t count, uint32_t per_mille)
+{
+    uint32_t rank = mmhist_percentile_rank(count, per_mille);
+    uint32_t cumulative = 0;
+    unsigned ii;
+
+    for (ii = 0; ii < BENCHMARK_HIST_NUM_BUCKETS; ii++)
+    {
+        cumulative += benchmark.latency_hist[ii];
+        if (cumulative >= rank)
+        {
+            break;
+        }
+    }
+
+    return mmhist_clamp(mmhist_bucket_upper_bound(ii, BENCHMARK_HIST_SUB_BUCKET_BITS),
+                        benchmark.latency_min_us,
+                        benchmark.latency_max_us);
+}
+
+void morse_benchmark_process_rx(struct driver_data *driverd, struct mmpkt *mmpkt)
+{
+    struct benchmark_pkt_hdr hdr;
+    uint32_t now_ticks = mmosal_get_time_ticks();
+
+    MM_UNUSED(driverd);
+
+    struct mmpktview *view = mmpkt_open(mmpkt);
+    bool valid = (mmpkt_get_data_length(view) >= sizeof(hdr));
+    if (valid)
+    {
+        memcpy(&hdr, mmpkt_get_data_start(view), sizeof(hdr));
+    }
+    mmpkt_close(&view);
+    mmpkt_release(mmpkt);
+
+    if (!valid ||
+        !benchmark.active ||
+        le32toh(hdr.magic) != BENCHMARK_MAGIC ||
+        le32toh(hdr.run_id) != benchmark.run_id)
+    {
+        MMLOG_DBG("Dropping stray loopback packet\n");
+        return;
+    }
+
+    uint32_t latency_us = benchmark_ticks_to_us(now_ticks - le32toh(hdr.tx_time_ticks));
+
+    mmosal_task_enter_critical();
+    if (!benchmark.active)
+    {
+        mmosal_task_exit_critical();
+        return;
+    }
+    if (benchmark.num_received == 0 || latency_us < benchmark.latency_min_us)
+    {
+        benchmark.latency_min_us = latency_us;
+    }
+    if (latency_us > benchmark.latency_max_us)
+    {
+        benchmark.latency_max_us = latency_us;
+    }
+    benchmark.latency_hist[mmhist_bucket_index(latency_us,
+                                               BENCHMARK_HIST_SUB_BUCKET_BITS,
+                                               BENCHMARK_HIST_MAX_VALUE_BITS)]++;
+    benchmark.num_received++;
+    if (benchmark.num_outstanding > 0)
+    {
+        benchmark.num_outstanding--;
+    }
+    benchmark.last_rx_time_ms = mmosal_get_time_ms();
+
+    mmosal_semb_give(benchmark.semb);
+    mmosal_task_exit_critical();
+}
+
+void morse_benchmark_add_driver_busy_time(uint32_t busy_ms)
+{
+    if (benchmark.active)
+    {
+        benchmark.driver_busy_ms += busy_ms;
+    }
+}
+
+static int benchmark_send_pkt(struct driver_data *driverd, uint32_t pkt_len, uint32_t seq)
+{
+    struct mmpkt *mmpkt = mmdrv_alloc_mmpkt_for_tx(MMHAL_WLAN_PKT_DATA_TID0, 0, pkt_len);
+    if (mmpkt == NULL)
+    {
+        return -ENOMEM;
+    }
+
+    struct mmdrv_tx_metadata *tx_metadata = mmdrv_get_tx_metadata(mmpkt);
+    memset(tx_metadata, 0, sizeof(*tx_metadata));
+    tx_metadata->tid = MORSE_QOS_TID_UP_BE;
+
+    struct mmpktview *view = mmpkt_open(mmpkt);
+    uint8_t *payload = mmpkt_append(view, pkt_len);
+    unsigned ii;
+    for (ii = sizeof(struct benchmark_pkt_hdr); ii < pkt_len; ii++)
+    {
+        payload[ii] = (uint8_t)ii;
+    }
+
+    struct benchmark_pkt_hdr hdr = {
+        .magic = htole32(BENCHMARK_MAGIC),
+        .seq = htole32(seq),
+        .tx_time_ticks = htole32(mmosal_get_time_ticks()),
+        .run_id = htole32(benchmark.run_id),
+    };
+    memcpy(payload, &hdr, sizeof(hdr));
+    mmpkt_close(&view);
+
+    mmosal_task_enter_critical();
+    benchmark.num_outstanding++;
+    mmosal_task_exit_critical();
+
+    struct morse_skbq *mq = driverd->cfg->ops->skbq_tc_q_from_aci(driverd, MORSE_ACI_BE);
+    int ret = morse_skbq_mmpkt_tx(mq, mmpkt, MORSE_SKB_CHAN_LOOPBACK);
+    if (ret != 0)
+    {
+        mmosal_task_enter_critical();
+        benchmark.num_outstanding--;
+        mmosal_task_exit_critical();
+    }
+    return ret;
+}
+
+enum mmwlan_status morse_benchmark_run(struct driver_data *driverd,
+                                       const struct mmwlan_bus_benchmark_args *args,
+                                       struct mmwlan_bus_benchmark_result *result)
+{
+    enum mmwlan_status status = MMWLAN_SUCCESS;
+    uint32_t num_sent = 0;
+
+    memset(result, 0, sizeof(*result));
+
+    if (benchmark.active)
+    {
+        return MMWLAN_UNAVAILABLE;
+    }
+
+    uint32_t run_id = benchmark.run_id + 1;
+    memset(&benchmark, 0, sizeof(benchmark));
+    benchmark.run_id = run_id;
+    benchmark.semb = mmosal_semb_create("bench");
+    if (benchmark.semb == NULL)
+    {
+        return MMWLAN_NO_MEM;
+    }
+
+    morse_ps_disable_async(driverd, PS_WAKER_BENCHMARK);
+
+    uint32_t start_time_ms = mmosal_get_time_ms();
+    uint32_t timeout_at_ms = start_time_ms + args->timeout_ms;
+    benchmark.last_rx_time_ms = start_time_ms;
+    benchmark.active = true;
+
+    while (num_sent < args->num_pkts || benchmark.num_outstanding > 0)
+    {
+        if (mmosal_time_has_passed(timeout_at_ms))
+        {
+            status = MMWLAN_TIMED_OUT;
+            break;
+        }
+
+        while (num_sent < args->num_pkts && benchmark.num_outstanding < args->batch_depth)
+        {
+            int ret = benchmark_send_pkt(driverd, args->pkt_len, num_sent);
+            if (ret != 0)
+            {
+                break;
+            }
+            num_sent++;
+        }
+
+        uint32_t wait_ms = timeout_at_ms - mmosal_get_time_ms();
+        if (num_sent < args->num_pkts && benchmark.num_outstanding < args->batch_depth)
+        {
+            wait_ms = BENCHMARK_ALLOC_RETRY_MS;
+        }
+        if ((int32_t)wait_ms > 0)
+        {
+            mmosal_semb_wait(benchmark.semb, wait_ms);
+        }
+    }
+
+    mmosal_task_enter_critical();
+    benchmark.active = false;
+    mmosal_task_exit_critical();
+    morse_ps_enable_async(driverd, PS_WAKER_BENCHMARK);
+
+    result->num_sent = num_sent;
+    result->num_received = benchmark.num_received;
+    result->duration_ms = benchmark.last_rx_time_ms - start_time_ms;
+    result->driver_busy_ms = benchmark.driver_busy_ms;
+    if (result->duration_ms > 0)
+    {
+        result->throughput_bytes_per_s =
+            (uint32_t)((uint64_t)result->num_received * args->pkt_len * 1000 /
+                       result->duration_ms);
+        result->pkts_per_s =
+            (uint32_t)((uint64_t)result->num_received * 1000 / result->duration_ms);
+    }
+    if (result->num_received > 0)
+    {
+        result->latency_min_us = benchmark.latency_min_us;
+        result->latency_p50_us = benchmark_hist_percentile(result->num_received, 500);
+        result->latency_p90_us = benchmark_hist_percentile(result->num_received, 900);
+        result->latency_p99_us = benchmark_hist_percentile(result->num_received, 990);
+        result->latency_max_us = benchmark.latency_max_us;
+    }
+
+    mmosal_semb_delete(benchmark.semb);
+    benchmark.semb = NULL;
+
+    MMLOG_INF("Bus benchmark: %lu/%lu pkts of %lu bytes in %lu ms\n",
+              result->num_received,
+              result->num_sent,
+              args->pkt_len,
+              result->duration_ms);
+
+    return status;
+}
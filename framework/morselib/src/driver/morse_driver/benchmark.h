@@ -0,0 +1,23 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "mmpkt.h"
+#include "mmwlan.h"
+
+struct driver_data;
+
+
+enum mmwlan_status morse_benchmark_run(struct driver_data *driverd,
+                                       const struct mmwlan_bus_benchmark_args *args,
+                                       struct mmwlan_bus_benchmark_result *result);
+
+
+void morse_benchmark_process_rx(struct driver_data *driverd, struct mmpkt *mmpkt);
+
+
+void morse_benchmark_add_driver_busy_time(uint32_t busy_ms);
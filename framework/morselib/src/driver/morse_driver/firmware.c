@@ -12,6 +12,15 @@
 #include "driver/transport/morse_transport.h"
 #include "ext_host_table.h"
 
+
+static enum mmwlan_fw_load_mode fw_load_mode = MMWLAN_FW_LOAD_FULL;
+
+
+static uint32_t last_host_table_ptr;
+
+
+static struct mmwlan_fw_load_stats fw_load_stats;
+
 static int morse_firmware_reset(struct driver_data *driverd)
 {
     MMOSAL_ASSERT(driverd->cfg->digital_reset);
@@ -290,14 +299,58 @@ exit:
     return ret;
 }
 
+static bool morse_firmware_is_memory_retained(struct driver_data *driverd)
+{
+    uint32_t magic = ~MORSE_REG_HOST_MAGIC_VALUE(driverd);
+
+    if (last_host_table_ptr == 0)
+    {
+        return false;
+    }
+
+    morse_trns_claim(driverd);
+    morse_trns_read_le32(driverd,
+                         last_host_table_ptr + offsetof(struct host_table, magic_number),
+                         &magic);
+    morse_trns_release(driverd);
+
+    return magic == MORSE_REG_HOST_MAGIC_VALUE(driverd);
+}
+
+void morse_firmware_set_load_mode(enum mmwlan_fw_load_mode mode)
+{
+    fw_load_mode = mode;
+}
+
+void morse_firmware_get_load_stats(struct mmwlan_fw_load_stats *stats)
+{
+    *stats = fw_load_stats;
+}
+
 int morse_firmware_init(struct driver_data *driverd,
                         morse_file_read_cb_t fw_callback,
                         morse_file_read_cb_t bcf_callback)
 {
     int ret = 0, retries = 3;
+    enum mmwlan_fw_load_mode mode = fw_load_mode;
+    uint32_t start_time = mmosal_get_time_ms();
+
+    memset(&fw_load_stats, 0, sizeof(fw_load_stats));
+    fw_load_stats.mode = mode;
+
+    if (mode != MMWLAN_FW_LOAD_FULL && !morse_firmware_is_memory_retained(driverd))
+    {
+        MMLOG_INF("Transceiver memory not retained, loading full firmware\n");
+        mode = MMWLAN_FW_LOAD_FULL;
+        fw_load_stats.memory_not_retained = true;
+    }
+    last_host_table_ptr = 0;
 
     while (retries--)
     {
+        fw_load_stats.segments_total = 0;
+        fw_load_stats.segments_loaded = 0;
+        fw_load_stats.segments_skipped = 0;
 
         if (driverd->cfg->pre_load_prepare)
         {
@@ -305,7 +358,7 @@ int morse_firmware_init(struct driver_data *driverd,
         }
 
         ret = ret ? ret : morse_firmware_invalidate_host_ptr(driverd);
-        ret = ret ? ret : morse_firmware_load_mbin(driverd, fw_callback);
+        ret = ret ? ret : morse_firmware_load_mbin(driverd, fw_callback, mode, &fw_load_stats);
         ret = ret ? ret : morse_bcf_load_mbin(driverd, bcf_callback, driverd->bcf_address);
         ret = ret ? ret : morse_firmware_trigger(driverd);
         ret = ret ? ret : morse_firmware_get_host_table_ptr(driverd);
@@ -316,15 +369,39 @@ int morse_firmware_init(struct driver_data *driverd,
 
         if (!ret)
         {
+            last_host_table_ptr = driverd->host_table_ptr;
             break;
         }
 
 
+        if (mode != MMWLAN_FW_LOAD_FULL)
+        {
+            MMLOG_WRN("Warm firmware load failed (%d), falling back to full load\n", ret);
+            mode = MMWLAN_FW_LOAD_FULL;
+            fw_load_stats.full_reload_fallback = true;
+            retries++;
+        }
+
         if (retries != 0)
         {
             ret = morse_firmware_reset(driverd);
         }
     }
 
+    fw_load_stats.load_time_ms = mmosal_get_time_ms() - start_time;
+    MMLOG_INF("Firmware load took %lu ms (%u/%u segments loaded, %u skipped)\n",
+              fw_load_stats.load_time_ms,
+              fw_load_stats.segments_loaded,
+              fw_load_stats.segments_total,
+              fw_load_stats.segments_skipped);
+    MMLOG_INF("  read %lu ms, inflate %lu ms, verify %lu ms, write %lu ms (%lu writes), "
+              "write wait %lu ms\n",
+              fw_load_stats.read_time_ms,
+              fw_load_stats.inflate_time_ms,
+              fw_load_stats.verify_time_ms,
+              fw_load_stats.write_time_ms,
+              fw_load_stats.bus_writes,
+              fw_load_stats.write_wait_time_ms);
+
     return ret;
 }
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "mmhal_wlan.h"
+#include "mmwlan.h"
 
 #include "driver/shim/driver_types.h"
 
@@ -51,7 +52,16 @@ int morse_firmware_init(struct driver_data *driverd,
                         morse_file_read_cb_t fw_callback,
                         morse_file_read_cb_t bcf_callback);
 
-int morse_firmware_load_mbin(struct driver_data *driverd, morse_file_read_cb_t file_read_cb);
+int morse_firmware_load_mbin(struct driver_data *driverd,
+                             morse_file_read_cb_t file_read_cb,
+                             enum mmwlan_fw_load_mode mode,
+                             struct mmwlan_fw_load_stats *stats);
+
+
+void morse_firmware_set_load_mode(enum mmwlan_fw_load_mode mode);
+
+
+void morse_firmware_get_load_stats(struct mmwlan_fw_load_stats *stats);
 
 int morse_bcf_load_mbin(struct driver_data *driverd,
                         morse_file_read_cb_t file_read_cb,
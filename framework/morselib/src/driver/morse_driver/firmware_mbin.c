@@ -12,9 +12,54 @@
 #include "driver/puff/puff.h"
 #include "mbin.h"
 #include "driver/transport/morse_transport.h"
+#include "driver/morse_crc/morse_crc.h"
+#include "fw_pipeline.h"
 #include "mmhal_wlan.h"
 
 
+#ifndef MORSE_FW_DIGEST_CACHE_ENTRIES
+#define MORSE_FW_DIGEST_CACHE_ENTRIES (128)
+#endif
+
+
+#define FW_READBACK_CHUNK_SIZE (512)
+
+
+struct fw_segment_digest
+{
+    uint32_t base_address;
+    uint32_t length;
+    uint32_t src_crc;
+    uint32_t crc;
+};
+
+
+struct fw_digest_cache
+{
+    bool valid;
+    uint16_t num_entries;
+    struct fw_segment_digest entries[MORSE_FW_DIGEST_CACHE_ENTRIES];
+};
+
+
+static struct fw_digest_cache *fw_digest_cache;
+
+
+struct fw_load_ctx
+{
+    enum mmwlan_fw_load_mode mode;
+    struct mmwlan_fw_load_stats *stats;
+    uint16_t segment_index;
+    bool track_digests;
+    bool have_pending_digest;
+    struct mbin_segment_digest pending_digest;
+    struct fw_pipeline pipeline;
+    uint32_t read_ticks;
+    uint32_t inflate_ticks;
+    uint32_t verify_ticks;
+};
+
+
 static void robuf_cleanup(struct mmhal_robuf *robuf)
 {
     if (robuf->free_cb != NULL)
@@ -212,6 +257,198 @@ static int process_coredump_mem_region(struct driver_data *driverd,
     return 0;
 }
 
+static uint32_t fw_ticks_to_ms(uint32_t ticks)
+{
+    return (uint32_t)(((uint64_t)ticks * 1000) / mmosal_ticks_per_second());
+}
+
+static int process_segment_digest(struct fw_load_ctx *ctx,
+                                  morse_file_read_cb_t file_read_cb,
+                                  uint32_t *file_read_offset,
+                                  struct mbin_tlv_hdr tlv_hdr)
+{
+    struct mmhal_robuf robuf = { 0 };
+    struct mbin_segment_digest raw_digest = { 0 };
+    uint32_t received = 0;
+
+    if (tlv_hdr.len != sizeof(raw_digest))
+    {
+        MMLOG_WRN("mbin SEGMENT_DIGEST section wrong length\n");
+        return -EINVAL;
+    }
+
+    while (received < sizeof(raw_digest))
+    {
+        uint32_t remaining = sizeof(raw_digest) - received;
+        int ret = read_into_robuf(&robuf, file_read_cb, file_read_offset, remaining);
+        if (ret != 0)
+        {
+            return ret;
+        }
+
+        memcpy(((uint8_t *)&raw_digest) + received, robuf.buf, robuf.len);
+        received += robuf.len;
+        robuf_cleanup(&robuf);
+    }
+
+    ctx->pending_digest.base_address = le32toh(raw_digest.base_address);
+    ctx->pending_digest.length = le32toh(raw_digest.length);
+    ctx->pending_digest.crc32 = le32toh(raw_digest.crc32);
+    ctx->have_pending_digest = true;
+
+    return 0;
+}
+
+static bool fw_digest_lookup(struct fw_load_ctx *ctx,
+                             uint32_t base_address,
+                             uint32_t length,
+                             uint32_t src_crc,
+                             uint32_t *crc)
+{
+    if (ctx->have_pending_digest)
+    {
+        if (ctx->pending_digest.base_address == base_address &&
+            ctx->pending_digest.length == length)
+        {
+            *crc = ctx->pending_digest.crc32;
+            return true;
+        }
+        MMLOG_WRN("Segment digest does not match segment @ %08lx\n", base_address);
+    }
+
+    if (fw_digest_cache == NULL || !fw_digest_cache->valid ||
+        ctx->segment_index >= fw_digest_cache->num_entries)
+    {
+        return false;
+    }
+
+    const struct fw_segment_digest *entry = &fw_digest_cache->entries[ctx->segment_index];
+    if (entry->base_address != base_address || entry->length != length ||
+        entry->src_crc != src_crc)
+    {
+        return false;
+    }
+
+    *crc = entry->crc;
+    return true;
+}
+
+static void fw_digest_record(struct fw_load_ctx *ctx,
+                             uint32_t base_address,
+                             uint32_t length,
+                             uint32_t src_crc,
+                             uint32_t crc)
+{
+    if (fw_digest_cache == NULL || ctx->segment_index >= MORSE_FW_DIGEST_CACHE_ENTRIES)
+    {
+        return;
+    }
+
+    struct fw_segment_digest *entry = &fw_digest_cache->entries[ctx->segment_index];
+    entry->base_address = base_address;
+    entry->length = length;
+    entry->src_crc = src_crc;
+    entry->crc = crc;
+}
+
+static int file_crc32(morse_file_read_cb_t file_read_cb,
+                      uint32_t offset,
+                      uint32_t length,
+                      uint32_t *crc)
+{
+    struct mmhal_robuf robuf = { 0 };
+
+    *crc = 0;
+    while (length > 0)
+    {
+        int ret = read_into_robuf(&robuf, file_read_cb, &offset, length);
+        if (ret != 0)
+        {
+            return ret;
+        }
+
+        *crc = morse_crc32(*crc, robuf.buf, robuf.len);
+        length -= robuf.len;
+        robuf_cleanup(&robuf);
+    }
+
+    return 0;
+}
+
+static int chip_crc32(struct driver_data *driverd,
+                      uint32_t address,
+                      uint32_t length,
+                      uint32_t *crc)
+{
+    int ret = 0;
+    uint8_t *buf = (uint8_t *)mmosal_malloc(FW_READBACK_CHUNK_SIZE);
+    if (buf == NULL)
+    {
+        return -ENOMEM;
+    }
+
+    *crc = 0;
+    while (length > 0)
+    {
+        uint32_t chunk_len = MM_MIN(length, FW_READBACK_CHUNK_SIZE);
+
+        morse_trns_claim(driverd);
+        ret = morse_trns_read_multi_byte(driverd, address, buf, FAST_ROUND_UP(chunk_len, 4));
+        morse_trns_release(driverd);
+        if (ret != 0)
+        {
+            MMLOG_WRN("Failed to read back %lu octets from %08lx\n", chunk_len, address);
+            break;
+        }
+
+        *crc = morse_crc32(*crc, buf, chunk_len);
+        length -= chunk_len;
+        address += chunk_len;
+    }
+
+    mmosal_free(buf);
+    return ret;
+}
+
+static int fw_segment_check_unchanged(struct driver_data *driverd,
+                                      struct fw_load_ctx *ctx,
+                                      uint32_t base_address,
+                                      uint32_t length,
+                                      uint32_t src_crc)
+{
+    uint32_t expected_crc;
+    uint32_t chip_crc;
+
+    if (!fw_digest_lookup(ctx, base_address, length, src_crc, &expected_crc))
+    {
+        MMLOG_DBG("No digest for segment @ %08lx\n", base_address);
+        ctx->stats->segments_mismatched++;
+        return -ENOENT;
+    }
+
+    uint32_t start = mmosal_get_time_ticks();
+    int ret = chip_crc32(driverd, base_address, length, &chip_crc);
+    ctx->verify_ticks += mmosal_get_time_ticks() - start;
+    if (ret != 0)
+    {
+        return ret;
+    }
+
+    if (chip_crc != expected_crc)
+    {
+        MMLOG_DBG("Segment @ %08lx changed (%08lx != %08lx)\n",
+                  base_address,
+                  chip_crc,
+                  expected_crc);
+        ctx->stats->segments_mismatched++;
+        return -ESTALE;
+    }
+
+    fw_digest_record(ctx, base_address, length, src_crc, expected_crc);
+    ctx->stats->segments_skipped++;
+    return 0;
+}
+
 static int load_from_file_to_chip(struct driver_data *driverd,
                                   morse_file_read_cb_t file_read_cb,
                                   uint32_t *file_read_offset,
@@ -253,13 +490,57 @@ static int load_from_file_to_chip(struct driver_data *driverd,
     return 0;
 }
 
+static int load_from_file_to_pipeline(struct fw_load_ctx *ctx,
+                                      morse_file_read_cb_t file_read_cb,
+                                      uint32_t *file_read_offset,
+                                      uint32_t base_address,
+                                      uint32_t length)
+{
+    struct mmhal_robuf robuf = { 0 };
+
+    MMLOG_DBG("Queueing %lu bytes to 0x%08lx\n", length, base_address);
+
+    while (length > 0)
+    {
+        uint32_t start = mmosal_get_time_ticks();
+        int ret = read_into_robuf(&robuf, file_read_cb, file_read_offset, length);
+        ctx->read_ticks += mmosal_get_time_ticks() - start;
+        if (ret != 0)
+        {
+            return ret;
+        }
+
+        uint8_t *dst;
+        uint32_t write_length = robuf.len;
+
+        ret = fw_pipeline_reserve(&ctx->pipeline, base_address, write_length, &dst);
+        if (ret != 0)
+        {
+            robuf_cleanup(&robuf);
+            return ret;
+        }
+
+        memcpy(dst, robuf.buf, write_length);
+        fw_pipeline_commit(&ctx->pipeline, write_length);
+        robuf_cleanup(&robuf);
+
+        MMOSAL_ASSERT(write_length <= length);
+        length -= write_length;
+        base_address += write_length;
+    }
+
+    return 0;
+}
+
 static int process_segment(struct driver_data *driverd,
+                           struct fw_load_ctx *ctx,
                            morse_file_read_cb_t file_read_cb,
                            uint32_t *file_read_offset,
                            struct mbin_tlv_hdr tlv_hdr)
 {
     struct mmhal_robuf robuf = { 0 };
     const struct mbin_segment_hdr *seg_hdr;
+    uint32_t src_crc = 0;
 
 
     MM_STATIC_ASSERT(sizeof(*seg_hdr) <= MMHAL_WLAN_FW_BCF_MIN_READ_LENGTH,
@@ -276,18 +557,48 @@ static int process_segment(struct driver_data *driverd,
     seg_hdr = (const struct mbin_segment_hdr *)robuf.buf;
 
     uint32_t base_address = le32toh(seg_hdr->base_address);
+    uint32_t length = tlv_hdr.len - sizeof(*seg_hdr);
 
-    ret = load_from_file_to_chip(driverd,
-                                 file_read_cb,
-                                 file_read_offset,
-                                 base_address,
-                                 tlv_hdr.len - sizeof(*seg_hdr));
     robuf_cleanup(&robuf);
 
+    if (ctx->track_digests)
+    {
+        ret = file_crc32(file_read_cb, *file_read_offset, length, &src_crc);
+        if (ret != 0)
+        {
+            return ret;
+        }
+    }
+
+    if (ctx->mode != MMWLAN_FW_LOAD_FULL)
+    {
+        ret = fw_segment_check_unchanged(driverd, ctx, base_address, length, src_crc);
+        if (ret == 0)
+        {
+            *file_read_offset += length;
+            return 0;
+        }
+        else if (ctx->mode == MMWLAN_FW_LOAD_VERIFY_ONLY)
+        {
+            return ret;
+        }
+    }
+
+    ret = load_from_file_to_pipeline(ctx, file_read_cb, file_read_offset, base_address, length);
+    if (ret == 0)
+    {
+        if (ctx->track_digests)
+        {
+            fw_digest_record(ctx, base_address, length, src_crc, src_crc);
+        }
+        ctx->stats->segments_loaded++;
+    }
+
     return ret;
 }
 
 static int process_segment_deflated(struct driver_data *driverd,
+                                    struct fw_load_ctx *ctx,
                                     morse_file_read_cb_t file_read_cb,
                                     uint32_t *file_read_offset,
                                     struct mbin_tlv_hdr tlv_hdr)
@@ -296,8 +607,11 @@ static int process_segment_deflated(struct driver_data *driverd,
     uint8_t *buf = NULL;
     unsigned long src_len;
     unsigned long dst_len;
+    uint32_t src_crc = 0;
+    uint32_t start = mmosal_get_time_ticks();
 
     int ret = read_into_robuf(&robuf, file_read_cb, file_read_offset, tlv_hdr.len);
+    ctx->read_ticks += mmosal_get_time_ticks() - start;
     if (ret != 0)
     {
         return ret;
@@ -318,16 +632,28 @@ static int process_segment_deflated(struct driver_data *driverd,
     uint16_t chunk_size = le16toh(seg_hdr->chunk_size);
     uint16_t rounded_chunk_size = FAST_ROUND_UP(chunk_size, 4);
 
-    buf = (uint8_t *)mmosal_malloc(rounded_chunk_size);
-    if (buf == NULL)
+    if (ctx->track_digests)
+    {
+        src_crc = morse_crc32(0, robuf.buf, tlv_hdr.len);
+    }
+
+    if (ctx->mode != MMWLAN_FW_LOAD_FULL)
+    {
+        ret = fw_segment_check_unchanged(driverd, ctx, base_address, chunk_size, src_crc);
+        if (ret == 0 || ctx->mode == MMWLAN_FW_LOAD_VERIFY_ONLY)
+        {
+            goto cleanup;
+        }
+    }
+
+    ret = fw_pipeline_reserve(&ctx->pipeline, base_address, rounded_chunk_size, &buf);
+    if (ret != 0)
     {
-        MMLOG_WRN("Failed to allocate %u octets for fw chunk\n", rounded_chunk_size);
-        ret = -ENOMEM;
         goto cleanup;
     }
 
 
-    *((uint32_t *)buf + rounded_chunk_size - 4) = 0;
+    memset(buf + rounded_chunk_size - 4, 0, 4);
 
     src_len = tlv_hdr.len - sizeof(*seg_hdr);
     dst_len = chunk_size;
@@ -345,7 +671,9 @@ static int process_segment_deflated(struct driver_data *driverd,
                   seg_hdr->zlib_header[1]);
     }
 
+    start = mmosal_get_time_ticks();
     ret = puff(buf, &dst_len, robuf.buf + sizeof(*seg_hdr), &src_len);
+    ctx->inflate_ticks += mmosal_get_time_ticks() - start;
     if (ret != 0)
     {
         MMLOG_WRN("Failed to decompress fw chunk for %08lx: %d\n", base_address, ret);
@@ -359,30 +687,46 @@ static int process_segment_deflated(struct driver_data *driverd,
         goto cleanup;
     }
 
-    MMLOG_DBG("Writing segment dest=0x%08lx, len=%u\n", base_address, tlv_hdr.len);
+    MMLOG_DBG("Queueing segment dest=0x%08lx, len=%u\n", base_address, tlv_hdr.len);
 
-    morse_trns_claim(driverd);
-    ret = morse_trns_write_multi_byte(driverd, base_address, buf, rounded_chunk_size);
-    if (ret != 0)
+    if (ctx->track_digests)
     {
-        MMLOG_WRN("Failed to write %u octets to %08lx\n", rounded_chunk_size, base_address);
+        fw_digest_record(ctx, base_address, chunk_size, src_crc, morse_crc32(0, buf, chunk_size));
     }
-    morse_trns_release(driverd);
+
+    fw_pipeline_commit(&ctx->pipeline, rounded_chunk_size);
+    ctx->stats->segments_loaded++;
 
 cleanup:
-    mmosal_free(buf);
     robuf_cleanup(&robuf);
     return ret;
 }
 
-int morse_firmware_load_mbin(struct driver_data *driverd, morse_file_read_cb_t file_read_cb)
+int morse_firmware_load_mbin(struct driver_data *driverd,
+                             morse_file_read_cb_t file_read_cb,
+                             enum mmwlan_fw_load_mode mode,
+                             struct mmwlan_fw_load_stats *stats)
 {
     struct mbin_tlv_hdr tlv_hdr;
     uint32_t offset = 0;
     int ret;
     bool eof = false;
+    struct fw_load_ctx ctx = {
+        .mode = mode,
+        .stats = stats,
+    };
+
+    MMLOG_DBG("Beginning firmware load (mode %u)\n", mode);
 
-    MMLOG_DBG("Beginning firmware load\n");
+    if (mode != MMWLAN_FW_LOAD_FULL && fw_digest_cache == NULL)
+    {
+        fw_digest_cache = (struct fw_digest_cache *)mmosal_malloc(sizeof(*fw_digest_cache));
+        if (fw_digest_cache != NULL)
+        {
+            memset(fw_digest_cache, 0, sizeof(*fw_digest_cache));
+        }
+    }
+    ctx.track_digests = (fw_digest_cache != NULL);
 
     ret = validate_mbin_magic(file_read_cb, &offset, MBIN_FW_MAGIC_NUMBER);
     if (ret != 0)
@@ -391,40 +735,40 @@ int morse_firmware_load_mbin(struct driver_data *driverd, morse_file_read_cb_t f
         return ret;
     }
 
+    ret = fw_pipeline_init(&ctx.pipeline, driverd);
+    if (ret != 0)
+    {
+        return ret;
+    }
+
     while (!eof && ((ret = read_tlv_hdr(file_read_cb, &offset, &tlv_hdr)) == 0))
     {
         switch (tlv_hdr.type)
         {
             case FIELD_TYPE_FW_TLV_BCF_ADDR:
                 ret = process_bcf_addr(driverd, file_read_cb, &offset, tlv_hdr);
-                if (ret != 0)
-                {
-                    return ret;
-                }
                 break;
 
             case FIELD_TYPE_COREDUMP_MEM_REGION:
                 ret = process_coredump_mem_region(driverd, file_read_cb, &offset, tlv_hdr);
-                if (ret != 0)
-                {
-                    return ret;
-                }
+                break;
+
+            case FIELD_TYPE_FW_SEGMENT_DIGEST:
+                ret = process_segment_digest(&ctx, file_read_cb, &offset, tlv_hdr);
                 break;
 
             case FIELD_TYPE_FW_SEGMENT:
-                ret = process_segment(driverd, file_read_cb, &offset, tlv_hdr);
-                if (ret != 0)
-                {
-                    return ret;
-                }
+                ret = process_segment(driverd, &ctx, file_read_cb, &offset, tlv_hdr);
+                ctx.segment_index++;
+                ctx.have_pending_digest = false;
+                stats->segments_total++;
                 break;
 
             case FIELD_TYPE_FW_SEGMENT_DEFLATED:
-                ret = process_segment_deflated(driverd, file_read_cb, &offset, tlv_hdr);
-                if (ret != 0)
-                {
-                    return ret;
-                }
+                ret = process_segment_deflated(driverd, &ctx, file_read_cb, &offset, tlv_hdr);
+                ctx.segment_index++;
+                ctx.have_pending_digest = false;
+                stats->segments_total++;
                 break;
 
             case FIELD_TYPE_EOF:
@@ -438,6 +782,27 @@ int morse_firmware_load_mbin(struct driver_data *driverd, morse_file_read_cb_t f
                 offset += tlv_hdr.len;
                 break;
         }
+
+        if (ret != 0)
+        {
+            break;
+        }
+    }
+
+    int finish_ret = fw_pipeline_finish(&ctx.pipeline);
+    ret = ret ? ret : finish_ret;
+
+    stats->read_time_ms += fw_ticks_to_ms(ctx.read_ticks);
+    stats->inflate_time_ms += fw_ticks_to_ms(ctx.inflate_ticks);
+    stats->verify_time_ms += fw_ticks_to_ms(ctx.verify_ticks);
+    stats->write_time_ms += fw_ticks_to_ms(ctx.pipeline.write_ticks);
+    stats->write_wait_time_ms += fw_ticks_to_ms(ctx.pipeline.wait_ticks);
+    stats->bus_writes += ctx.pipeline.num_writes;
+
+    if (ctx.track_digests)
+    {
+        fw_digest_cache->valid = (ret == 0);
+        fw_digest_cache->num_entries = MM_MIN(ctx.segment_index, MORSE_FW_DIGEST_CACHE_ENTRIES);
     }
 
     if (ret != 0)
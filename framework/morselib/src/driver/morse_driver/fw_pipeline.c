@@ -0,0 +1,251 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ *
+ * Double-buffered writer used to overlap firmware download bus writes with reading and
+ * decompressing the firmware image.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "fw_pipeline.h"
+#include "morse.h"
+#include "driver/transport/morse_transport.h"
+
+#define FW_PIPELINE_WRITER_PRIORITY   (MMOSAL_TASK_PRI_HIGH)
+#define FW_PIPELINE_WRITER_STACK      (512)
+
+static int fw_pipeline_write(struct fw_pipeline *pl, struct fw_write_buf *buf)
+{
+    uint32_t start = mmosal_get_time_ticks();
+
+    morse_trns_claim(pl->driverd);
+    int ret = morse_trns_write_multi_byte(pl->driverd, buf->address, buf->data, buf->len);
+    morse_trns_release(pl->driverd);
+
+    pl->write_ticks += mmosal_get_time_ticks() - start;
+    pl->num_writes++;
+
+    if (ret != 0)
+    {
+        MMLOG_WRN("Failed to write %lu octets to %08lx\n", buf->len, buf->address);
+        return -EIO;
+    }
+
+    return 0;
+}
+
+static void fw_pipeline_writer_main(void *arg)
+{
+    struct fw_pipeline *pl = (struct fw_pipeline *)arg;
+    struct fw_write_buf *buf;
+
+    while (mmosal_queue_pop(pl->full_q, &buf, UINT32_MAX))
+    {
+        if (buf == NULL)
+        {
+            break;
+        }
+
+        if (pl->write_err == 0)
+        {
+            pl->write_err = fw_pipeline_write(pl, buf);
+        }
+
+        buf->len = 0;
+        mmosal_queue_push(pl->free_q, &buf, UINT32_MAX);
+    }
+
+    pl->writer_running = false;
+}
+
+static int fw_pipeline_submit(struct fw_pipeline *pl)
+{
+    struct fw_write_buf *buf = pl->cur;
+
+    pl->cur = NULL;
+    if (buf == NULL || buf->len == 0)
+    {
+        return 0;
+    }
+
+    if (pl->writer == NULL)
+    {
+        int ret = fw_pipeline_write(pl, buf);
+        buf->len = 0;
+        return ret;
+    }
+
+    mmosal_queue_push(pl->full_q, &buf, UINT32_MAX);
+    return 0;
+}
+
+static struct fw_write_buf *fw_pipeline_get_free(struct fw_pipeline *pl)
+{
+    struct fw_write_buf *buf = &pl->bufs[0];
+
+    if (pl->writer != NULL)
+    {
+        uint32_t start = mmosal_get_time_ticks();
+        mmosal_queue_pop(pl->free_q, &buf, UINT32_MAX);
+        pl->wait_ticks += mmosal_get_time_ticks() - start;
+    }
+
+    return buf;
+}
+
+int fw_pipeline_init(struct fw_pipeline *pl, struct driver_data *driverd)
+{
+    unsigned ii;
+
+    memset(pl, 0, sizeof(*pl));
+    pl->driverd = driverd;
+
+    for (ii = 0; ii < FW_PIPELINE_NUM_BUFS; ii++)
+    {
+        pl->bufs[ii].data = (uint8_t *)mmosal_malloc(FW_PIPELINE_BUF_SIZE);
+        if (pl->bufs[ii].data == NULL)
+        {
+            break;
+        }
+        pl->bufs[ii].capacity = FW_PIPELINE_BUF_SIZE;
+    }
+
+    if (ii == 0)
+    {
+        return -ENOMEM;
+    }
+
+    if (ii < FW_PIPELINE_NUM_BUFS)
+    {
+        MMLOG_INF("Insufficient memory for pipelined firmware download\n");
+        return 0;
+    }
+
+    pl->full_q = mmosal_queue_create(FW_PIPELINE_NUM_BUFS + 1, sizeof(pl->cur), "fwq");
+    pl->free_q = mmosal_queue_create(FW_PIPELINE_NUM_BUFS, sizeof(pl->cur), "fwfq");
+    if (pl->full_q == NULL || pl->free_q == NULL)
+    {
+        goto sync;
+    }
+
+    for (ii = 0; ii < FW_PIPELINE_NUM_BUFS; ii++)
+    {
+        struct fw_write_buf *buf = &pl->bufs[ii];
+        mmosal_queue_push(pl->free_q, &buf, 0);
+    }
+
+    pl->writer_running = true;
+    pl->writer = mmosal_task_create(fw_pipeline_writer_main,
+                                    pl,
+                                    FW_PIPELINE_WRITER_PRIORITY,
+                                    FW_PIPELINE_WRITER_STACK,
+                                    "fwload");
+    if (pl->writer != NULL)
+    {
+        return 0;
+    }
+    pl->writer_running = false;
+
+sync:
+    MMLOG_INF("Pipelined firmware download unavailable\n");
+    if (pl->full_q != NULL)
+    {
+        mmosal_queue_delete(pl->full_q);
+        pl->full_q = NULL;
+    }
+    if (pl->free_q != NULL)
+    {
+        mmosal_queue_delete(pl->free_q);
+        pl->free_q = NULL;
+    }
+    return 0;
+}
+
+int fw_pipeline_reserve(struct fw_pipeline *pl, uint32_t address, uint32_t len, uint8_t **dst)
+{
+    struct fw_write_buf *buf = pl->cur;
+    int ret;
+
+    if (pl->write_err != 0)
+    {
+        return pl->write_err;
+    }
+
+    if (buf != NULL && (buf->address + buf->len != address || buf->len + len > buf->capacity))
+    {
+        ret = fw_pipeline_submit(pl);
+        if (ret != 0)
+        {
+            return ret;
+        }
+        buf = NULL;
+    }
+
+    if (buf == NULL)
+    {
+        buf = fw_pipeline_get_free(pl);
+        if (buf->capacity < len)
+        {
+            uint32_t capacity = FAST_ROUND_UP(len, FW_PIPELINE_ALIGN);
+
+            mmosal_free(buf->data);
+            buf->data = (uint8_t *)mmosal_malloc(capacity);
+            buf->capacity = (buf->data != NULL) ? capacity : 0;
+            if (buf->data == NULL)
+            {
+                MMLOG_WRN("Failed to allocate %lu octets for fw chunk\n", capacity);
+                if (pl->writer != NULL)
+                {
+                    mmosal_queue_push(pl->free_q, &buf, UINT32_MAX);
+                }
+                return -ENOMEM;
+            }
+        }
+        buf->address = address;
+        buf->len = 0;
+        pl->cur = buf;
+    }
+
+    *dst = buf->data + buf->len;
+    return 0;
+}
+
+void fw_pipeline_commit(struct fw_pipeline *pl, uint32_t len)
+{
+    MMOSAL_ASSERT(pl->cur != NULL && pl->cur->len + len <= pl->cur->capacity);
+    pl->cur->len += len;
+}
+
+int fw_pipeline_finish(struct fw_pipeline *pl)
+{
+    unsigned ii;
+    int ret = 0;
+
+    if (pl->write_err == 0)
+    {
+        ret = fw_pipeline_submit(pl);
+    }
+
+    if (pl->writer != NULL)
+    {
+        struct fw_write_buf *stop = NULL;
+        mmosal_queue_push(pl->full_q, &stop, UINT32_MAX);
+        while (pl->writer_running)
+        {
+            mmosal_task_sleep(1);
+        }
+        mmosal_queue_delete(pl->full_q);
+        mmosal_queue_delete(pl->free_q);
+        pl->writer = NULL;
+    }
+
+    for (ii = 0; ii < FW_PIPELINE_NUM_BUFS; ii++)
+    {
+        mmosal_free(pl->bufs[ii].data);
+        pl->bufs[ii].data = NULL;
+    }
+
+    return (ret != 0) ? ret : pl->write_err;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mmosal.h"
+
+#ifndef FW_PIPELINE_BUF_SIZE
+#define FW_PIPELINE_BUF_SIZE       (4096)
+#endif
+
+#define FW_PIPELINE_NUM_BUFS       (2)
+
+#define FW_PIPELINE_ALIGN          (512)
+
+struct driver_data;
+
+struct fw_write_buf
+{
+    uint8_t *data;
+
+    uint32_t capacity;
+
+    uint32_t address;
+
+    uint32_t len;
+};
+
+struct fw_pipeline
+{
+    struct driver_data *driverd;
+
+    struct fw_write_buf bufs[FW_PIPELINE_NUM_BUFS];
+
+    struct fw_write_buf *cur;
+
+    struct mmosal_task *writer;
+
+    struct mmosal_queue *full_q;
+
+    struct mmosal_queue *free_q;
+
+    volatile bool writer_running;
+
+    volatile int write_err;
+
+    uint32_t write_ticks;
+
+    uint32_t wait_ticks;
+
+    uint16_t num_writes;
+};
+
+
+int fw_pipeline_init(struct fw_pipeline *pl, struct driver_data *driverd);
+
+
+int fw_pipeline_reserve(struct fw_pipeline *pl, uint32_t address, uint32_t len, uint8_t **dst);
+
+
+void fw_pipeline_commit(struct fw_pipeline *pl, uint32_t len);
+
+
+int fw_pipeline_finish(struct fw_pipeline *pl);
@@ -312,6 +312,23 @@ int morse_pager_hw_page_write(struct morse_pager *pager,
     return ret;
 }
 
+int morse_pager_hw_page_write_pkt(struct morse_pager *pager,
+                                  struct morse_page *page,
+                                  struct mmpktview *view)
+{
+    if (mmpkt_get_total_length(view) > page->size_bytes)
+    {
+        return -EMSGSIZE;
+    }
+
+    if (page->addr == 0)
+    {
+        return -EFAULT;
+    }
+
+    return morse_trns_write_pkt(pager->driverd, page->addr, view);
+}
+
 int morse_pager_hw_page_read(struct morse_pager *pager,
                              struct morse_page *page,
                              int offset,
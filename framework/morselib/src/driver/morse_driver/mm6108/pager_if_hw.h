@@ -46,6 +46,11 @@ int morse_pager_hw_page_write(struct morse_pager *pager,
                               uint32_t num_bytes);
 
 
+int morse_pager_hw_page_write_pkt(struct morse_pager *pager,
+                                  struct morse_page *page,
+                                  struct mmpktview *view);
+
+
 int morse_pager_hw_page_read(struct morse_pager *pager,
                              struct morse_page *page,
                              int offset,
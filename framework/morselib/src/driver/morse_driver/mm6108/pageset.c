@@ -438,21 +438,17 @@ static int morse_pageset_write(struct morse_pageset *pageset, struct mmpkt *mmpk
         goto exit;
     }
 
-    if (mmpkt_get_data_length(view) > page.size_bytes)
+    if (mmpkt_get_total_length(view) > page.size_bytes)
     {
         MMLOG_ERR("%s Data larger than pagesize: [%lu:%lu]\n",
                   __func__,
-                  mmpkt_get_data_length(view),
+                  mmpkt_get_total_length(view),
                   page.size_bytes);
         ret = -ENOSPC;
         goto exit;
     }
 
-    ret = morse_pager_hw_page_write(populated_pager,
-                                    &page,
-                                    0,
-                                    mmpkt_get_data_start(view),
-                                    mmpkt_get_data_length(view));
+    ret = morse_pager_hw_page_write_pkt(populated_pager, &page, view);
     if (ret)
     {
         MMLOG_ERR("Failed to write page: %d\n", ret);
@@ -24,6 +24,18 @@
 
 #define YAPS_MAX_RX_PAYLOAD 1628
 #define YAPS_MAX_TX_PAYLOAD 1514
+
+
+#ifndef YAPS_RX_READ_AHEAD
+#define YAPS_RX_READ_AHEAD 0
+#endif
+
+
+#if YAPS_RX_READ_AHEAD
+#define YAPS_RX_READ_AHEAD_LEN MORSE_YAPS_DELIM_SIZE
+#else
+#define YAPS_RX_READ_AHEAD_LEN 0
+#endif
 #define TX_DATA_HEADER_LEN                  \
     (sizeof(struct dot11_data_hdr) +        \
      sizeof(struct dot11_qos_ctrl) +        \
@@ -31,7 +43,8 @@
      MORSE_PKT_WORD_ALIGN +                 \
      MORSE_YAPS_DELIM_SIZE)
 
-MM_STATIC_ASSERT((sizeof(struct mmpkt) + YAPS_MAX_RX_PAYLOAD + sizeof(struct mmdrv_rx_metadata) <=
+MM_STATIC_ASSERT((sizeof(struct mmpkt) + YAPS_MAX_RX_PAYLOAD + YAPS_RX_READ_AHEAD_LEN +
+                      sizeof(struct mmdrv_rx_metadata) <=
                   MMHAL_WLAN_MMPKT_RX_MAX_SIZE),
                  "RX pool size must be larger to accommodate packets from the chip");
 MM_STATIC_ASSERT(TX_DATA_HEADER_LEN + YAPS_MAX_TX_PAYLOAD + sizeof(struct mmdrv_tx_metadata) <=
@@ -163,6 +176,9 @@ struct morse_yaps_hw_aux_data
 
 
     struct morse_yaps_status_registers status_regs;
+
+
+    uint32_t rx_next_delim;
 };
 
 static struct morse_chip_if_state chip_if_state;
@@ -236,7 +252,7 @@ void morse_yaps_hw_read_table(struct driver_data *driverd, struct morse_yaps_hw_
 
 static unsigned int morse_yaps_pages_required(struct morse_yaps *yaps, const struct mmpkt *mmpkt)
 {
-    uint32_t size_bytes = mmpkt_peek_data_length(mmpkt);
+    uint32_t size_bytes = mmpkt_peek_total_length(mmpkt);
 
     return MORSE_INT_CEIL(size_bytes + yaps->aux_data->reserved_yaps_page_size, YAPS_PAGE_SIZE) +
            YAPS_METADATA_PAGE_COUNT +
@@ -360,9 +376,7 @@ static int morse_yaps_hw_write_pkt_err_check(struct morse_yaps *yaps,
                                              struct mmpkt *mmpkt,
                                              enum morse_yaps_to_chip_q tc_queue)
 {
-    struct mmpktview *view = mmpkt_open(mmpkt);
-    uint32_t data_len = mmpkt_get_data_length(view);
-    mmpkt_close(&view);
+    uint32_t data_len = mmpkt_peek_total_length(mmpkt);
 
     if (data_len + yaps->aux_data->reserved_yaps_page_size > YAPS_MAX_PKT_SIZE_BYTES)
     {
@@ -409,14 +423,11 @@ int morse_yaps_hw_write_pkt(struct morse_yaps *yaps,
 
 
     bool set_irq = (next_pkt == NULL) || !morse_yaps_will_fit(yaps, next_pkt, tc_queue);
-    uint32_t delim = morse_yaps_delimiter(yaps, mmpkt_get_data_length(view), tc_queue, set_irq);
+    uint32_t delim = morse_yaps_delimiter(yaps, mmpkt_get_total_length(view), tc_queue, set_irq);
     delim = htole32(delim);
     mmpkt_prepend_data(view, (uint8_t *)&delim, sizeof(delim));
 
-    ret = morse_trns_write_multi_byte(yaps->driverd,
-                                      yaps->aux_data->yds_addr,
-                                      mmpkt_get_data_start(view),
-                                      mmpkt_get_data_length(view));
+    ret = morse_trns_write_pkt(yaps->driverd, yaps->aux_data->yds_addr, view);
 
 
     mmpkt_remove_from_start(view, sizeof(delim));
@@ -457,11 +468,18 @@ static bool morse_yaps_is_valid_delimiter(uint32_t delim)
     return true;
 }
 
+static int morse_yaps_hw_read(struct morse_yaps *yaps, uint32_t addr, uint8_t *buf, uint32_t len)
+{
+    mmdrv_host_stats_increment_datapath_driver_rx_read_transactions();
+    return morse_trns_read_multi_byte(yaps->driverd, addr, buf, len);
+}
+
 int morse_yaps_hw_read_pkt(struct morse_yaps *yaps, struct mmpkt **mmpkt)
 {
     int ret = 0;
     uint32_t delim;
     int total_len;
+    int read_len;
     int pkt_len;
     struct mmpktview *view;
     uint8_t *buf;
@@ -474,17 +492,25 @@ int morse_yaps_hw_read_pkt(struct morse_yaps *yaps, struct mmpkt **mmpkt)
     }
 
 
-    ret = morse_trns_read_multi_byte(yaps->driverd,
-                                     yaps->aux_data->ysl_addr,
-                                     (uint8_t *)&delim,
-                                     sizeof(delim));
-    if (ret)
+    if (yaps->aux_data->rx_next_delim != 0)
     {
-        MMLOG_WRN("Failed to read delim %d\n", ret);
-        goto exit;
+        delim = yaps->aux_data->rx_next_delim;
+        yaps->aux_data->rx_next_delim = 0;
     }
+    else
+    {
+        ret = morse_yaps_hw_read(yaps,
+                                 yaps->aux_data->ysl_addr,
+                                 (uint8_t *)&delim,
+                                 sizeof(delim));
+        if (ret)
+        {
+            MMLOG_WRN("Failed to read delim %d\n", ret);
+            goto exit;
+        }
 
-    delim = le32toh(delim);
+        delim = le32toh(delim);
+    }
 
     if (delim == 0x0)
     {
@@ -505,6 +531,9 @@ int morse_yaps_hw_read_pkt(struct morse_yaps *yaps, struct mmpkt **mmpkt)
 
     MMOSAL_ASSERT(total_len <= YAPS_MAX_RX_PAYLOAD);
 
+
+    read_len = total_len + YAPS_RX_READ_AHEAD_LEN;
+
     enum morse_yaps_from_chip_q fc_queue =
         (enum morse_yaps_from_chip_q)YAPS_DELIM_GET_POOL_ID(delim);
 
@@ -512,7 +541,7 @@ int morse_yaps_hw_read_pkt(struct morse_yaps *yaps, struct mmpkt **mmpkt)
                                                         MMHAL_WLAN_PKT_COMMAND;
 
 
-    *mmpkt = mmhal_wlan_alloc_mmpkt_for_rx(pkt_class, total_len, sizeof(struct mmdrv_rx_metadata));
+    *mmpkt = mmhal_wlan_alloc_mmpkt_for_rx(pkt_class, read_len, sizeof(struct mmdrv_rx_metadata));
     if (!*mmpkt)
     {
         mmdrv_host_stats_increment_datapath_driver_rx_alloc_failures();
@@ -534,13 +563,13 @@ int morse_yaps_hw_read_pkt(struct morse_yaps *yaps, struct mmpkt **mmpkt)
 
     view = mmpkt_open(*mmpkt);
 
-    buf = mmpkt_append(view, total_len);
+    buf = mmpkt_append(view, read_len);
 
-    ret = morse_trns_read_multi_byte(yaps->driverd,
+    ret = morse_yaps_hw_read(yaps,
 
-                                     yaps->aux_data->ysl_addr + 4,
-                                     buf,
-                                     total_len);
+                             yaps->aux_data->ysl_addr + 4,
+                             buf,
+                             read_len);
     if (ret)
     {
         mmdrv_host_stats_increment_datapath_driver_rx_read_failures();
@@ -555,6 +584,15 @@ int morse_yaps_hw_read_pkt(struct morse_yaps *yaps, struct mmpkt **mmpkt)
         goto exit;
     }
 
+    mmdrv_host_stats_increment_datapath_driver_rx_packets();
+
+#if YAPS_RX_READ_AHEAD
+
+    memcpy(&delim, buf + total_len, sizeof(delim));
+    yaps->aux_data->rx_next_delim = le32toh(delim);
+    mmpkt_remove_from_end(view, YAPS_RX_READ_AHEAD_LEN);
+#endif
+
     mmpkt_close(&view);
 
 
@@ -676,7 +714,8 @@ int morse_yaps_hw_init(struct driver_data *driverd)
 
 
     yaps->rx_scratch_pkt = mmhal_wlan_alloc_mmpkt_for_rx(MORSE_YAPS_RX_Q,
-                                                         YAPS_MAX_RX_PAYLOAD,
+                                                         YAPS_MAX_RX_PAYLOAD +
+                                                             YAPS_RX_READ_AHEAD_LEN,
                                                          sizeof(struct mmdrv_rx_metadata));
     if (yaps->rx_scratch_pkt == NULL)
     {
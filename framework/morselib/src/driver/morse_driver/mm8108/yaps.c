@@ -36,9 +36,6 @@ static mmtrace_channel yaps_channel_handle;
     } while (0)
 #endif
 
-#define BENCHMARK_PKT_LEN (1496)
-#define BENCHMARK_WAIT_MS (5000)
-
 
 #define CHIP_FULL_RECOVERY_TIMEOUT_MS 30
 
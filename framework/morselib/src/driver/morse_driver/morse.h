@@ -10,6 +10,7 @@
 #include "mmpkt.h"
 #include "mmdrv.h"
 #include "coredump.h"
+#include "ps_policy.h"
 
 #define MORSE_DRIVER_SEMVER_MAJOR 56
 #define MORSE_DRIVER_SEMVER_MINOR 0
@@ -47,6 +48,26 @@ struct morse_ps
     struct mmosal_semb *wake;
 
     volatile atomic_bool pending_wake;
+
+    bool adaptive_enabled;
+
+    struct ps_policy policy;
+
+    uint32_t last_activity_time_ms;
+
+    bool activity_seen;
+
+    enum mmwlan_ps_wake_reason wake_reason;
+
+    uint32_t state_change_time_ms;
+
+    struct mmwlan_adaptive_ps_stats stats;
+
+    uint32_t acct_reasons;
+
+    uint32_t acct_wakers;
+
+    uint32_t acct_time_ms;
 };
 
 struct morse_stale_tx_status
@@ -3,12 +3,17 @@
  * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
  */
 
+#include <errno.h>
+#include <string.h>
+
 #include "ps.h"
 #include "mmhal_wlan.h"
 #include "mmosal.h"
 #include "driver/driver.h"
 #include "driver/transport/morse_transport.h"
 #include "mmwlan.h"
+#include "mmwlan_stats.h"
+#include "mmutils.h"
 #include "umac/core/umac_core.h"
 
 #ifdef ENABLE_PS_TRACE
@@ -41,6 +46,12 @@ static mmtrace_channel ps_evt_channel_handle;
 #define DEFAULT_BUS_TIMEOUT_MS (5)
 
 
+#define WAKE_LATENCY_EWMA_SHIFT (3)
+
+MM_STATIC_ASSERT((int)MMWLAN_STATS_PS_WAKER_N_ENTRIES == (int)PS_WAKER_COUNT,
+                 "PS waker stats do not match waker IDs");
+
+
 static struct driver_data *volatile ps_mors;
 
 static void morse_ps_wait_after_wake_pin_raise(struct driver_data *driverd)
@@ -79,7 +90,38 @@ static void morse_ps_update_timeout(struct driver_data *driverd, int timeout_ms)
     }
 }
 
-static void morse_ps_wakeup(struct driver_data *driverd)
+static void morse_ps_update_wake_latency(struct driver_data *driverd, uint32_t latency_ms)
+{
+    int32_t sample_us = latency_ms * 1000;
+    int32_t avg_us = driverd->ps.stats.wake_latency_us;
+
+    if (driverd->ps.stats.wake_count <= 1)
+    {
+        driverd->ps.stats.wake_latency_us = sample_us;
+        return;
+    }
+
+    avg_us += (sample_us - avg_us) / (1 << WAKE_LATENCY_EWMA_SHIFT);
+    driverd->ps.stats.wake_latency_us = avg_us;
+}
+
+static void morse_ps_account(struct driver_data *driverd, uint32_t reasons)
+{
+    uint32_t now = mmosal_get_time_ms();
+
+    if (!driverd->ps.suspended)
+    {
+        mmdrv_host_stats_add_ps_awake_time(driverd->ps.acct_reasons,
+                                           driverd->ps.acct_wakers,
+                                           now - driverd->ps.acct_time_ms);
+    }
+
+    driverd->ps.acct_time_ms = now;
+    driverd->ps.acct_reasons = reasons;
+    driverd->ps.acct_wakers = driverd->ps.wakers;
+}
+
+static void morse_ps_wakeup(struct driver_data *driverd, enum mmwlan_ps_wake_reason reason)
 {
     MMOSAL_DEV_ASSERT(mmosal_mutex_is_held_by_active_task(driverd->ps.lock));
     if (!driverd->ps.suspended)
@@ -87,7 +129,17 @@ static void morse_ps_wakeup(struct driver_data *driverd)
         return;
     }
 
-    PS_TRACE_STATE("wakeup");
+    uint32_t wake_start = mmosal_get_time_ms();
+    uint32_t slept_ms = wake_start - driverd->ps.state_change_time_ms;
+
+    driverd->ps.stats.wake_count++;
+    mmdrv_host_stats_increment_ps_wake_count(driverd->ps.acct_reasons, driverd->ps.acct_wakers);
+    if (slept_ms < driverd->ps.policy.args.wake_energy_ms)
+    {
+        driverd->ps.stats.mispredicted_sleeps++;
+    }
+
+    PS_TRACE_STATE("wakeup %u", reason);
     MMLOG_DBG("Wakeup Pin Set\n");
     atomic_store(&driverd->ps.pending_wake, true);
     mmhal_wlan_wake_assert();
@@ -96,6 +148,10 @@ static void morse_ps_wakeup(struct driver_data *driverd)
     driverd->ps.suspended = false;
     atomic_store(&driverd->ps.pending_wake, false);
 
+    driverd->ps.state_change_time_ms = mmosal_get_time_ms();
+    driverd->ps.wake_reason = reason;
+    morse_ps_update_wake_latency(driverd, driverd->ps.state_change_time_ms - wake_start);
+
 
     morse_ps_update_timeout(driverd, DEFAULT_BUS_TIMEOUT_MS);
 }
@@ -108,6 +164,10 @@ static void morse_ps_sleep(struct driver_data *driverd)
         return;
     }
 
+    uint32_t now = mmosal_get_time_ms();
+    driverd->ps.stats.awake_ms[driverd->ps.wake_reason] += now - driverd->ps.state_change_time_ms;
+    driverd->ps.state_change_time_ms = now;
+
     PS_TRACE_STATE("suspend");
     MMLOG_DBG("Wakeup Pin Clear\n");
     driverd->ps.suspended = true;
@@ -137,6 +197,8 @@ static void morse_ps_irq_handle(void)
 static void morse_ps_evaluate(struct driver_data *driverd)
 {
     bool needs_wake = false;
+    enum mmwlan_ps_wake_reason reason = MMWLAN_PS_WAKE_REASON_NETWORK_ACTIVITY;
+    uint32_t reasons = 0;
 
     uint32_t blocking_evt_mask = DRV_EVT_MASK_PAGESET;
     bool blocking_evt_is_pending = driver_task_notification_is_pending(driverd, blocking_evt_mask);
@@ -156,12 +218,28 @@ static void morse_ps_evaluate(struct driver_data *driverd)
         mmosal_timer_stop(driverd->stale_status.timer);
     }
     needs_wake = (driverd->ps.wakers != 0) || blocking_evt_is_pending || skbs_pending;
+    if (skbs_pending)
+    {
+        reasons |= 1ul << MMWLAN_PS_WAKE_REASON_TX_BUFFERED;
+        reason = MMWLAN_PS_WAKE_REASON_TX_BUFFERED;
+    }
+    if (blocking_evt_is_pending)
+    {
+        reasons |= 1ul << MMWLAN_PS_WAKE_REASON_PENDING_EVENT;
+        reason = MMWLAN_PS_WAKE_REASON_PENDING_EVENT;
+    }
+    if (driverd->ps.wakers != 0)
+    {
+        reasons |= 1ul << MMWLAN_PS_WAKE_REASON_WAKER;
+        reason = MMWLAN_PS_WAKE_REASON_WAKER;
+    }
 
     if (driver_is_data_tx_allowed(driverd) && !mmosal_time_has_passed(driverd->ps.bus_ps_timeout))
     {
 
 
         needs_wake = true;
+        reasons |= 1ul << MMWLAN_PS_WAKE_REASON_NETWORK_ACTIVITY;
 
 
         driver_task_schedule_notification_at(driverd,
@@ -180,25 +258,60 @@ static void morse_ps_evaluate(struct driver_data *driverd)
             (!mmosal_time_has_passed(driverd->ps.bus_ps_timeout) ? 0x00040000 : 0);
         PS_TRACE_EVT("eval wake %x", wake_reason);
 #endif
-        morse_ps_wakeup(driverd);
+        morse_ps_account(driverd, reasons);
+        morse_ps_wakeup(driverd, reason);
     }
     else if (mmhal_wlan_busy_is_asserted())
     {
         PS_TRACE_EVT("eval sleep blocked");
+        morse_ps_account(driverd, 1ul << MMWLAN_PS_WAKE_REASON_CHIP);
 
         morse_ps_update_timeout(driverd, DEFAULT_BUS_TIMEOUT_MS);
     }
     else
     {
         PS_TRACE_EVT("eval sleep");
+        morse_ps_account(driverd, 0);
         morse_ps_sleep(driverd);
     }
 }
 
+static uint32_t morse_ps_get_activity_timeout(struct driver_data *driverd)
+{
+    if (driverd->ps.adaptive_enabled)
+    {
+        return driverd->ps.policy.timeout_ms;
+    }
+    return driverd->ps.dynamic_ps_timout_ms;
+}
+
+static void morse_ps_record_activity(struct driver_data *driverd)
+{
+    uint32_t now = mmosal_get_time_ms();
+    uint32_t gap_ms = now - driverd->ps.last_activity_time_ms;
+    bool first = !driverd->ps.activity_seen;
+
+    driverd->ps.last_activity_time_ms = now;
+    driverd->ps.activity_seen = true;
+    if (first)
+    {
+        return;
+    }
+
+    PS_TRACE_EVT("activity gap %u", gap_ms);
+    if (ps_policy_add_sample(&driverd->ps.policy, gap_ms, driverd->ps.stats.wake_latency_us) &&
+        driverd->ps.adaptive_enabled)
+    {
+        PS_TRACE_EVT("adaptive timeout %u", driverd->ps.policy.timeout_ms);
+        MMLOG_DBG("Adaptive PS timeout %lu\n", driverd->ps.policy.timeout_ms);
+    }
+}
+
 void morse_ps_network_activity(struct driver_data *driverd)
 {
     MMOSAL_MUTEX_GET_INF(driverd->ps.lock);
-    morse_ps_update_timeout(driverd, driverd->ps.dynamic_ps_timout_ms);
+    morse_ps_record_activity(driverd);
+    morse_ps_update_timeout(driverd, morse_ps_get_activity_timeout(driverd));
     MMOSAL_MUTEX_RELEASE(driverd->ps.lock);
 }
 
@@ -220,6 +333,49 @@ int morse_ps_set_dynamic_ps_timeout(struct driver_data *driverd, uint32_t timeou
     return ret;
 }
 
+int morse_ps_set_adaptive(struct driver_data *driverd, const struct mmwlan_adaptive_ps_args *args)
+{
+    if (!driverd->ps.initialized)
+    {
+        return -ENODEV;
+    }
+
+    MMOSAL_MUTEX_GET_INF(driverd->ps.lock);
+    ps_policy_set_args(&driverd->ps.policy, args);
+    driverd->ps.policy.timeout_ms =
+        ps_policy_compute_timeout(&driverd->ps.policy, driverd->ps.stats.wake_latency_us);
+    driverd->ps.adaptive_enabled = args->enabled;
+    MMOSAL_MUTEX_RELEASE(driverd->ps.lock);
+
+    MMLOG_INF("Adaptive PS %s\n", args->enabled ? "enabled" : "disabled");
+
+    return 0;
+}
+
+void morse_ps_get_adaptive_stats(struct driver_data *driverd,
+                                 struct mmwlan_adaptive_ps_stats *stats)
+{
+    if (!driverd->ps.initialized)
+    {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+
+    MMOSAL_MUTEX_GET_INF(driverd->ps.lock);
+    *stats = driverd->ps.stats;
+    stats->timeout_ms = morse_ps_get_activity_timeout(driverd);
+    memcpy(stats->inter_arrival_hist,
+           driverd->ps.policy.hist,
+           sizeof(stats->inter_arrival_hist));
+    if (!driverd->ps.suspended)
+    {
+
+        stats->awake_ms[driverd->ps.wake_reason] +=
+            mmosal_get_time_ms() - driverd->ps.state_change_time_ms;
+    }
+    MMOSAL_MUTEX_RELEASE(driverd->ps.lock);
+}
+
 void morse_ps_work(struct driver_data *driverd)
 {
     bool async_wakeup;
@@ -241,7 +397,11 @@ void morse_ps_work(struct driver_data *driverd)
 
         MMLOG_DBG("Aysnc wakeup Request from IRQ, waking up.\n");
         MMOSAL_MUTEX_GET_INF(driverd->ps.lock);
-        morse_ps_wakeup(driverd);
+        if (driverd->ps.suspended)
+        {
+            morse_ps_account(driverd, 1ul << MMWLAN_PS_WAKE_REASON_CHIP);
+        }
+        morse_ps_wakeup(driverd, MMWLAN_PS_WAKE_REASON_CHIP);
         MMOSAL_MUTEX_RELEASE(driverd->ps.lock);
     }
 
@@ -356,7 +516,18 @@ int morse_ps_init(struct driver_data *driverd)
     driverd->ps.dynamic_ps_timout_ms = MMWLAN_DEFAULT_DYNAMIC_PS_TIMEOUT_MS;
     driverd->ps.suspended = false;
 
+    const struct mmwlan_adaptive_ps_args adaptive_args = MMWLAN_ADAPTIVE_PS_ARGS_INIT;
+    ps_policy_init(&driverd->ps.policy, &adaptive_args);
+    driverd->ps.adaptive_enabled = false;
+    driverd->ps.activity_seen = false;
+    memset(&driverd->ps.stats, 0, sizeof(driverd->ps.stats));
+    driverd->ps.wake_reason = MMWLAN_PS_WAKE_REASON_WAKER;
+    driverd->ps.state_change_time_ms = mmosal_get_time_ms();
+
     driverd->ps.wakers = (1ul << PS_WAKER_UMAC);
+    driverd->ps.acct_reasons = 1ul << MMWLAN_PS_WAKE_REASON_WAKER;
+    driverd->ps.acct_wakers = driverd->ps.wakers;
+    driverd->ps.acct_time_ms = driverd->ps.state_change_time_ms;
     driverd->ps.lock = mmosal_mutex_create("ps");
     MMOSAL_ASSERT(driverd->ps.lock);
     driverd->ps.wake = mmosal_semb_create("ps_wake");
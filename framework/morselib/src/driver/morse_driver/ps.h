@@ -12,6 +12,8 @@ enum ps_waker_id
     PS_WAKER_PAGESET,
     PS_WAKER_COMMAND,
     PS_WAKER_IRQ,
+    PS_WAKER_BENCHMARK,
+    PS_WAKER_COUNT,
 };
 
 
@@ -33,6 +35,13 @@ void morse_ps_network_activity(struct driver_data *driverd);
 int morse_ps_set_dynamic_ps_timeout(struct driver_data *driverd, uint32_t timeout_ms);
 
 
+int morse_ps_set_adaptive(struct driver_data *driverd, const struct mmwlan_adaptive_ps_args *args);
+
+
+void morse_ps_get_adaptive_stats(struct driver_data *driverd,
+                                 struct mmwlan_adaptive_ps_stats *stats);
+
+
 int morse_ps_init(struct driver_data *driverd);
 
 
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ */
+
+#include <string.h>
+
+#include "ps_policy.h"
+
+static uint32_t ps_policy_clamp(uint32_t value, uint32_t lower, uint32_t upper)
+{
+    if (value < lower)
+    {
+        return lower;
+    }
+    if (value > upper)
+    {
+        return upper;
+    }
+    return value;
+}
+
+void ps_policy_set_args(struct ps_policy *policy, const struct mmwlan_adaptive_ps_args *args)
+{
+    policy->args = *args;
+    if (policy->args.max_timeout_ms < policy->args.min_timeout_ms)
+    {
+        policy->args.max_timeout_ms = policy->args.min_timeout_ms;
+    }
+}
+
+void ps_policy_init(struct ps_policy *policy, const struct mmwlan_adaptive_ps_args *args)
+{
+    memset(policy, 0, sizeof(*policy));
+    ps_policy_set_args(policy, args);
+    policy->timeout_ms = policy->args.max_timeout_ms;
+}
+
+unsigned ps_policy_bin_index(uint32_t gap_ms)
+{
+    unsigned index;
+
+    if (gap_ms == 0)
+    {
+        return 0;
+    }
+
+    index = 32 - __builtin_clz(gap_ms);
+    if (index >= PS_POLICY_NUM_BINS)
+    {
+        index = PS_POLICY_NUM_BINS - 1;
+    }
+    return index;
+}
+
+uint32_t ps_policy_bin_upper_bound(unsigned index)
+{
+    if (index >= PS_POLICY_NUM_BINS - 1)
+    {
+        return UINT32_MAX;
+    }
+    return (1ul << index) - 1;
+}
+
+static uint64_t ps_policy_expected_cost(const struct ps_policy *policy,
+                                        uint32_t timeout_ms,
+                                        uint32_t *late_count)
+{
+    uint64_t cost = 0;
+    unsigned ii;
+
+    *late_count = 0;
+    for (ii = 0; ii < PS_POLICY_NUM_BINS; ii++)
+    {
+        uint32_t count = policy->hist[ii];
+        uint32_t upper = ps_policy_bin_upper_bound(ii);
+        uint32_t gap_ms;
+
+        if (count == 0)
+        {
+            continue;
+        }
+
+        if (upper <= timeout_ms)
+        {
+
+            gap_ms = (ii == 0) ? 0 : (upper + (1ul << (ii - 1))) / 2;
+            cost += (uint64_t)count * gap_ms;
+        }
+        else
+        {
+
+            cost += (uint64_t)count * (timeout_ms + policy->args.wake_energy_ms);
+            *late_count += count;
+        }
+    }
+
+    return cost;
+}
+
+uint32_t ps_policy_compute_timeout(const struct ps_policy *policy, uint32_t wake_latency_us)
+{
+    uint32_t best_timeout = policy->args.max_timeout_ms;
+    uint64_t best_cost = UINT64_MAX;
+    unsigned ii;
+
+    if (policy->total == 0)
+    {
+        return best_timeout;
+    }
+
+    for (ii = 0; ii < PS_POLICY_NUM_BINS; ii++)
+    {
+        uint32_t candidate = ps_policy_clamp(ps_policy_bin_upper_bound(ii),
+                                             policy->args.min_timeout_ms,
+                                             policy->args.max_timeout_ms);
+        uint32_t late_count;
+        uint64_t cost = ps_policy_expected_cost(policy, candidate, &late_count);
+
+        if ((uint64_t)late_count * wake_latency_us >
+            (uint64_t)policy->total * policy->args.max_avg_wake_latency_us)
+        {
+            continue;
+        }
+
+        if (cost < best_cost || (cost == best_cost && candidate < best_timeout))
+        {
+            best_cost = cost;
+            best_timeout = candidate;
+        }
+    }
+
+    return best_timeout;
+}
+
+bool ps_policy_add_sample(struct ps_policy *policy, uint32_t gap_ms, uint32_t wake_latency_us)
+{
+    uint32_t new_timeout;
+    unsigned ii;
+
+    policy->hist[ps_policy_bin_index(gap_ms)]++;
+    policy->total++;
+
+    if (policy->total >= PS_POLICY_DECAY_THRESHOLD)
+    {
+        policy->total = 0;
+        for (ii = 0; ii < PS_POLICY_NUM_BINS; ii++)
+        {
+            policy->hist[ii] /= 2;
+            policy->total += policy->hist[ii];
+        }
+    }
+
+    if (++policy->samples_since_recompute < PS_POLICY_RECOMPUTE_INTERVAL)
+    {
+        return false;
+    }
+
+    policy->samples_since_recompute = 0;
+    new_timeout = ps_policy_compute_timeout(policy, wake_latency_us);
+    if (new_timeout == policy->timeout_ms)
+    {
+        return false;
+    }
+
+    policy->timeout_ms = new_timeout;
+    return true;
+}
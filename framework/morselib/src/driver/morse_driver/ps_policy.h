@@ -0,0 +1,47 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mmwlan.h"
+
+#define PS_POLICY_NUM_BINS            MMWLAN_ADAPTIVE_PS_HIST_BINS
+
+#define PS_POLICY_DECAY_THRESHOLD     (256)
+
+#define PS_POLICY_RECOMPUTE_INTERVAL  (16)
+
+struct ps_policy
+{
+    struct mmwlan_adaptive_ps_args args;
+
+    uint16_t hist[PS_POLICY_NUM_BINS];
+
+    uint32_t total;
+
+    uint32_t samples_since_recompute;
+
+    uint32_t timeout_ms;
+};
+
+
+void ps_policy_init(struct ps_policy *policy, const struct mmwlan_adaptive_ps_args *args);
+
+
+void ps_policy_set_args(struct ps_policy *policy, const struct mmwlan_adaptive_ps_args *args);
+
+
+unsigned ps_policy_bin_index(uint32_t gap_ms);
+
+
+uint32_t ps_policy_bin_upper_bound(unsigned index);
+
+
+bool ps_policy_add_sample(struct ps_policy *policy, uint32_t gap_ms, uint32_t wake_latency_us);
+
+
+uint32_t ps_policy_compute_timeout(const struct ps_policy *policy, uint32_t wake_latency_us);
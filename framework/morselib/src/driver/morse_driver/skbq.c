@@ -10,6 +10,7 @@
 #include "mmpkt_list.h"
 #include "morse.h"
 #include "skbq.h"
+#include "benchmark.h"
 #include "command.h"
 #include "skb_header.h"
 #include "dot11/dot11.h"
@@ -187,7 +188,7 @@ static void morse_skb_remove_padding_after_sent_to_chip(struct mmpktview *view)
     mmpkt_remove_from_start(view, sizeof(*hdr) + hdr->offset);
 
     struct mmdrv_tx_metadata *tx_metadata = mmdrv_get_tx_metadata(mmpkt_from_view(view));
-    mmpkt_remove_from_end(view, tx_metadata->tail_padding);
+    mmpkt_remove_from_end(mmpkt_get_last_segment(view), tx_metadata->tail_padding);
     tx_metadata->tail_padding = 0;
 }
 
@@ -286,7 +287,7 @@ void morse_skbq_process_rx(struct driver_data *driverd, struct mmpkt *mmpkt)
     else if (channel == MORSE_SKB_CHAN_LOOPBACK)
     {
         mmpkt_close(&view);
-        mmpkt_release(mmpkt);
+        morse_benchmark_process_rx(driverd, mmpkt);
     }
     else
     {
@@ -539,7 +540,8 @@ static int __skbq_data_tx_finish(struct mmpkt_list *skbq,
 
     mmpkt_list_remove(skbq, mmpkt);
 
-    if (tx_sts && tx_sts->channel == MORSE_SKB_CHAN_BEACON)
+    if (tx_sts &&
+        (tx_sts->channel == MORSE_SKB_CHAN_BEACON || tx_sts->channel == MORSE_SKB_CHAN_LOOPBACK))
     {
 
         mmpkt_release(mmpkt);
@@ -777,14 +779,14 @@ static void morse_skbq_ensure_word_alignment(struct mmpktview *view,
     }
 
 
-    mmpkt_data_len = (uint32_t)mmpkt_get_data_length(view);
+    mmpkt_data_len = mmpkt_get_total_length(view);
     tail_pad = FAST_ROUND_UP(mmpkt_data_len, 4) - mmpkt_data_len;
 
     if (tail_pad != 0)
     {
         MMLOG_DBG("mmpkt align: append %lu bytes\n", tail_pad);
         const uint8_t padding[] = { 0, 0, 0 };
-        mmpkt_append_data(view, padding, tail_pad);
+        mmpkt_append_data(mmpkt_get_last_segment(view), padding, tail_pad);
         tx_metadata->tail_padding = tail_pad;
     }
 }
@@ -808,7 +810,7 @@ int morse_skbq_mmpkt_tx(struct morse_skbq *mq, struct mmpkt *mmpkt, uint8_t chan
     tx_metadata->timeout_abs_ms = mmosal_get_time_ms() + morse_skbq_get_tx_status_lifetime_ms();
 
     view = mmpkt_open(mmpkt);
-    payload_len = mmpkt_get_data_length(view);
+    payload_len = mmpkt_get_total_length(view);
 
     unaligned_hdr = (struct morse_buff_skb_header *)mmpkt_prepend(view, sizeof(*hdr));
     MMOSAL_ASSERT(unaligned_hdr != NULL);
@@ -43,6 +43,11 @@ morse_error_t morse_trns_write_multi_byte(struct driver_data *driverd,
                                           uint32_t len);
 
 
+morse_error_t morse_trns_write_pkt(struct driver_data *driverd,
+                                   uint32_t address,
+                                   struct mmpktview *view);
+
+
 morse_error_t morse_trns_read_le32(struct driver_data *driverd, uint32_t address, uint32_t *data);
 
 
@@ -583,6 +583,69 @@ exit:
     return result;
 }
 
+static morse_error_t morse_trns_write_pkt_bounce(struct driver_data *driverd,
+                                                 uint32_t address,
+                                                 struct mmpktview *view,
+                                                 uint32_t len)
+{
+    morse_error_t result;
+    uint8_t *bounce = (uint8_t *)mmosal_malloc(len);
+
+    if (bounce == NULL)
+    {
+        MMLOG_WRN("Failed to allocate %lu octet bounce buffer\n", len);
+        return MORSE_ENOMEM;
+    }
+
+    mmpkt_copy_data(view, 0, bounce, len);
+    result = morse_trns_write_multi_byte(driverd, address, bounce, len);
+    mmosal_free(bounce);
+    return result;
+}
+
+morse_error_t morse_trns_write_pkt(struct driver_data *driverd,
+                                   uint32_t address,
+                                   struct mmpktview *view)
+{
+    struct mmpktview *segment;
+    morse_error_t result = MORSE_SUCCESS;
+
+    if (mmpkt_get_next_segment(view) == NULL)
+    {
+        return morse_trns_write_multi_byte(driverd,
+                                           address,
+                                           mmpkt_get_data_start(view),
+                                           mmpkt_get_data_length(view));
+    }
+
+    for (segment = view; segment != NULL; segment = mmpkt_get_next_segment(segment))
+    {
+        if ((mmpkt_get_data_length(segment) & 0x03) != 0)
+        {
+            return morse_trns_write_pkt_bounce(driverd, address, view,
+                                               mmpkt_get_total_length(view));
+        }
+    }
+
+    for (segment = view; segment != NULL; segment = mmpkt_get_next_segment(segment))
+    {
+        uint32_t len = mmpkt_get_data_length(segment);
+        if (len == 0)
+        {
+            continue;
+        }
+
+        result = morse_trns_write_multi_byte(driverd, address, mmpkt_get_data_start(segment), len);
+        if (result != MORSE_SUCCESS)
+        {
+            break;
+        }
+        address += len;
+    }
+
+    return result;
+}
+
 morse_error_t morse_trns_read_le32(struct driver_data *driverd, uint32_t address, uint32_t *data)
 {
     TRANSPORT_FSM_TRACE("read_word");
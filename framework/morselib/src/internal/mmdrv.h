@@ -158,6 +158,12 @@ void mmdrv_deinit(void);
 
 enum mmwlan_status mmdrv_get_bcf_metadata(struct mmwlan_bcf_metadata *metadata);
 
+
+void mmdrv_set_fw_load_mode(enum mmwlan_fw_load_mode mode);
+
+
+void mmdrv_get_fw_load_stats(struct mmwlan_fw_load_stats *stats);
+
 #define MMDRV_DUTY_CYCLE_MIN (1lu)
 #define MMDRV_DUTY_CYCLE_MAX (10000lu)
 
@@ -379,6 +385,12 @@ enum mmwlan_status mmdrv_set_frag_threshold(uint32_t frag_threshold);
 enum mmwlan_status mmdrv_set_dynamic_ps_timeout(uint32_t timeout_ms);
 
 
+enum mmwlan_status mmdrv_set_adaptive_ps(const struct mmwlan_adaptive_ps_args *args);
+
+
+enum mmwlan_status mmdrv_get_adaptive_ps_stats(struct mmwlan_adaptive_ps_stats *stats);
+
+
 enum mmwlan_status mmdrv_tx_frame(struct mmpkt *mmpkt, bool is_mgmt);
 
 
@@ -394,6 +406,10 @@ enum mmwlan_status mmdrv_reset_stats(uint32_t core_num);
 enum mmwlan_status mmdrv_trigger_core_assert(uint32_t core_id);
 
 
+enum mmwlan_status mmdrv_bus_benchmark(const struct mmwlan_bus_benchmark_args *args,
+                                       struct mmwlan_bus_benchmark_result *result);
+
+
 #define MORSE_CAPS_MAX_FW_VAL (128)
 
 
@@ -682,6 +698,21 @@ void mmdrv_host_stats_increment_datapath_driver_rx_alloc_failures(void);
 void mmdrv_host_stats_increment_datapath_driver_rx_read_failures(void);
 
 
+void mmdrv_host_stats_increment_datapath_driver_rx_packets(void);
+
+
+void mmdrv_host_stats_increment_datapath_driver_rx_read_transactions(void);
+
+
+void mmdrv_host_stats_add_ps_awake_time(uint32_t reasons, uint32_t wakers, uint32_t awake_ms);
+
+
+void mmdrv_host_stats_increment_ps_wake_count(uint32_t reasons, uint32_t wakers);
+
+
+void mmdrv_host_stats_add_driver_task_busy_time(uint32_t busy_ms);
+
+
 void mmdrv_host_stats_increment_datapath_driver_tx_skbq_timeout(void);
 
 
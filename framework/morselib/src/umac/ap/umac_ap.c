@@ -5,6 +5,7 @@
 
 #include "common/common.h"
 #include "mmlog.h"
+#include "mmpkt_list.h"
 
 #include "dot11/dot11_utils.h"
 
@@ -25,6 +26,12 @@
 #include "umac/supplicant_shim/umac_supp_shim.h"
 
 
+#define UMAC_AP_TX_DRR_QUANTUM (1600)
+
+
+#define UMAC_AP_PS_LIFETIME_LISTEN_INTERVALS (2)
+
+
 uint32_t ieee80211_crc32(const u8 *frame, size_t frame_len);
 
 
@@ -49,6 +56,65 @@ static bool umac_ap_set_stad_state_(struct umac_sta_data *stad, enum morse_sta_s
     return changed;
 }
 
+
+static void umac_ap_tx_ring_insert(struct umac_ap_data *data, struct umac_sta_data *stad)
+{
+    struct umac_ap_sta_data *sta_data = umac_sta_data_get_ap(stad);
+    if (sta_data->tx_next != NULL)
+    {
+        return;
+    }
+
+    if (data->tx_ring == NULL)
+    {
+        sta_data->tx_next = stad;
+        sta_data->tx_prev = stad;
+        data->tx_ring = stad;
+        data->tx_quantum_granted = false;
+    }
+    else
+    {
+
+        struct umac_sta_data *next = data->tx_ring;
+        struct umac_sta_data *prev = umac_sta_data_get_ap(next)->tx_prev;
+        sta_data->tx_next = next;
+        sta_data->tx_prev = prev;
+        umac_sta_data_get_ap(prev)->tx_next = stad;
+        umac_sta_data_get_ap(next)->tx_prev = stad;
+    }
+    data->tx_ring_len++;
+}
+
+
+static void umac_ap_tx_ring_remove(struct umac_ap_data *data, struct umac_sta_data *stad)
+{
+    struct umac_ap_sta_data *sta_data = umac_sta_data_get_ap(stad);
+    if (sta_data->tx_next == NULL)
+    {
+        return;
+    }
+
+    if (sta_data->tx_next == stad)
+    {
+        data->tx_ring = NULL;
+    }
+    else
+    {
+        umac_sta_data_get_ap(sta_data->tx_prev)->tx_next = sta_data->tx_next;
+        umac_sta_data_get_ap(sta_data->tx_next)->tx_prev = sta_data->tx_prev;
+        if (data->tx_ring == stad)
+        {
+            data->tx_ring = sta_data->tx_next;
+            data->tx_quantum_granted = false;
+        }
+    }
+
+    sta_data->tx_next = NULL;
+    sta_data->tx_prev = NULL;
+    sta_data->tx_deficit = 0;
+    data->tx_ring_len--;
+}
+
 #if MMLOG_LEVEL >= MMLOG_LEVEL_VRB
 static void dump_sta_list(struct umac_ap_data *data)
 {
@@ -77,8 +143,9 @@ bool umac_ap_validate_ap_args(struct umac_data *umacd, const struct mmwlan_ap_ar
         return false;
     }
 
-    const struct mmwlan_s1g_channel *chan = umac_regdb_get_channel(umacd, args->s1g_chan_num);
-    if (chan == NULL || !umac_regdb_op_class_match(umacd, args->op_class, chan))
+    const struct mmwlan_s1g_channel *chan =
+        umac_regdb_get_channel_for_op_class(umacd, args->s1g_chan_num, args->op_class);
+    if (chan == NULL)
     {
         MMLOG_ERR("No matching channel (reg_dom=%s, op_class=%u, chan#=%u)\n",
                   umac_regdb_get_country_code(umacd),
@@ -121,6 +188,12 @@ bool umac_ap_validate_ap_args(struct umac_data *umacd, const struct mmwlan_ap_ar
         return false;
     }
 
+    if (args->intra_bss_policy > MMWLAN_AP_INTRA_BSS_ISOLATE)
+    {
+        MMLOG_ERR("Invalid intra-BSS policy %u\n", args->intra_bss_policy);
+        return false;
+    }
+
     return true;
 }
 
@@ -175,10 +248,10 @@ enum mmwlan_status umac_ap_enable_ap(struct umac_data *umacd, const struct mmwla
     }
 
 
-    data->specified_chan = umac_regdb_get_channel(umacd, args->s1g_chan_num);
+    data->specified_chan =
+        umac_regdb_get_channel_for_op_class(umacd, args->s1g_chan_num, args->op_class);
 
-    if (data->specified_chan == NULL ||
-        !umac_regdb_op_class_match(umacd, args->op_class, data->specified_chan))
+    if (data->specified_chan == NULL)
     {
         MMLOG_ERR("No matching channel (reg_dom=%s, op_class=%u, chan#=%u)\n",
                   umac_regdb_get_country_code(umacd),
@@ -197,6 +270,14 @@ enum mmwlan_status umac_ap_enable_ap(struct umac_data *umacd, const struct mmwla
     {
         data->args.dtim_period = MMWLAN_DEFAULT_AP_DTIM_PERIOD;
     }
+    if (data->args.ps_max_buffered_frames == 0)
+    {
+        data->args.ps_max_buffered_frames = MMWLAN_DEFAULT_AP_PS_MAX_BUFFERED_FRAMES;
+    }
+    if (data->args.ps_max_buffered_bytes == 0)
+    {
+        data->args.ps_max_buffered_bytes = MMWLAN_DEFAULT_AP_PS_MAX_BUFFERED_BYTES;
+    }
     if (data->args.pri_bw_mhz == 0)
     {
         if (data->specified_chan->bw_mhz == 1)
@@ -363,17 +444,65 @@ void umac_ap_build_beacon(struct umac_data *umacd, struct consbuf *buf, void *pa
     consbuf_append(buf, data->config.tail, data->config.tail_len);
 }
 
+static void umac_ap_ps_expire_(struct umac_data *umacd,
+                               struct umac_ap_data *data,
+                               struct umac_sta_data *stad,
+                               uint32_t now_ms,
+                               struct mmpkt_list *dropped)
+{
+    struct mmpkt *expired;
+
+    while ((expired = umac_sta_data_pop_expired_pkt(stad, now_ms)) != NULL)
+    {
+        mmpkt_list_append(dropped, expired);
+        data->num_pkts_queued--;
+        umac_stats_increment_datapath_txq_ps_frames_expired(umacd);
+    }
+}
+
+
+static void umac_ap_ps_expire_sleeping_(struct umac_data *umacd,
+                                        struct umac_ap_data *data,
+                                        struct mmpkt_list *expired)
+{
+    struct umac_sta_data *stad = data->tx_ring;
+    uint32_t now_ms = mmosal_get_time_ms();
+    uint32_t ii;
+
+    for (ii = 0; ii < data->tx_ring_len; ii++)
+    {
+        struct umac_ap_sta_data *sta_data = umac_sta_data_get_ap(stad);
+        uint16_t aid = umac_sta_data_get_aid(stad);
+
+        if (sta_data->asleep && aid)
+        {
+            umac_ap_ps_expire_(umacd, data, stad, now_ms, expired);
+            if (umac_sta_data_get_queued_len(stad) == 0)
+            {
+                ap_traffic_bitmap_clear_aid_bit(data->bitmap, aid);
+            }
+        }
+        stad = sta_data->tx_next;
+    }
+}
+
 struct mmpkt *umac_ap_get_beacon(struct umac_data *umacd)
 {
     struct umac_ap_data *data = umac_data_get_ap(umacd);
     MMOSAL_ASSERT(data != NULL);
 
 
+    struct mmpkt_list expired = MMPKT_LIST_INIT;
     MMOSAL_TASK_ENTER_CRITICAL();
     umac_ap_set_stad_sleep_state_(data->sta_common, true);
     bool traffic_indicator = (data->dtim_count == 0) &&
                              umac_sta_data_get_queued_len(data->sta_common);
+    if (data->dtim_count == 0)
+    {
+        umac_ap_ps_expire_sleeping_(umacd, data, &expired);
+    }
     MMOSAL_TASK_EXIT_CRITICAL();
+    mmpkt_list_clear(&expired);
     struct mmpkt *beacon = build_mgmt_frame(umacd, umac_ap_build_beacon, &traffic_indicator);
 
 
@@ -606,9 +735,27 @@ static void umac_ap_dealloc_sta(struct umac_ap_data *data, struct umac_sta_data
         MMOSAL_ASSERT(false);
     }
     data->stas[aid] = NULL;
+    MMOSAL_TASK_ENTER_CRITICAL();
+    umac_ap_tx_ring_remove(data, stad);
+    MMOSAL_TASK_EXIT_CRITICAL();
     mmosal_free(stad);
 }
 
+static uint32_t umac_ap_ps_lifetime_ms(struct umac_ap_data *data, uint16_t listen_interval)
+{
+    static const uint16_t scale[] = { 1, 10, 1000, 10000 };
+    uint64_t beacons = (uint64_t)(listen_interval & 0x3fff) * scale[listen_interval >> 14];
+
+    if (beacons == 0)
+    {
+        return MMWLAN_DEFAULT_AP_PS_BUFFER_LIFETIME_MS;
+    }
+
+    uint64_t lifetime_ms = (beacons * UMAC_AP_PS_LIFETIME_LISTEN_INTERVALS *
+                            data->args.beacon_interval_tus * 1024) / 1000;
+    return (lifetime_ms > INT32_MAX) ? INT32_MAX : (uint32_t)lifetime_ms;
+}
+
 enum mmwlan_status umac_ap_add_sta(struct umac_data *umacd,
                                    uint16_t aid,
                                    const struct umac_ap_sta_info *sta_info)
@@ -640,6 +787,7 @@ enum mmwlan_status umac_ap_add_sta(struct umac_data *umacd,
     umac_sta_data_set_security(stad, data->args.security_type, data->args.pmf_mode);
     struct umac_ap_sta_data *sta_data = umac_sta_data_get_ap(stad);
     sta_data->last_active_ms = mmosal_get_time_ms();
+    sta_data->ps_lifetime_ms = umac_ap_ps_lifetime_ms(data, sta_info->listen_interval);
 
     umac_keys_init(stad);
 
@@ -760,6 +908,9 @@ static enum mmwlan_status umac_ap_remove_sta_record(struct umac_data *umacd,
     umac_rc_stop(stad);
     umac_rc_deinit(stad);
     umac_datapath_stad_flush_txq(umacd, stad);
+    MMOSAL_TASK_ENTER_CRITICAL();
+    umac_ap_tx_ring_remove(data, stad);
+    MMOSAL_TASK_EXIT_CRITICAL();
 
     mmosal_free(stad);
 
@@ -898,6 +1049,32 @@ static bool umac_ap_get_stad_sleep_state(struct umac_sta_data *stad)
     return sta_data->asleep;
 }
 
+static struct mmpkt *umac_ap_ps_make_room_(struct umac_data *umacd,
+                                           struct umac_ap_data *data,
+                                           struct umac_sta_data *stad,
+                                           struct mmpkt *mmpkt,
+                                           struct mmpkt_list *dropped)
+{
+    uint32_t len = mmpkt_peek_total_length(mmpkt);
+
+    while (umac_sta_data_get_queued_len(stad) != 0 &&
+           (umac_sta_data_get_queued_len(stad) >= data->args.ps_max_buffered_frames ||
+            umac_sta_data_get_queued_bytes(stad) + len > data->args.ps_max_buffered_bytes))
+    {
+        umac_stats_increment_datapath_txq_ps_frames_dropped(umacd);
+        if (data->args.ps_drop_policy == MMWLAN_AP_PS_DROP_NEWEST)
+        {
+            mmpkt_list_append(dropped, mmpkt);
+            return NULL;
+        }
+
+        mmpkt_list_append(dropped, umac_sta_data_pop_oldest_pkt(stad));
+        data->num_pkts_queued--;
+    }
+
+    return mmpkt;
+}
+
 void umac_ap_queue_pkt(struct umac_data *umacd, struct umac_sta_data *stad, struct mmpkt *mmpkt)
 {
     struct umac_ap_data *data = umac_data_get_ap(umacd);
@@ -908,13 +1085,32 @@ void umac_ap_queue_pkt(struct umac_data *umacd, struct umac_sta_data *stad, stru
         return;
     }
 
+    bool asleep = umac_ap_get_stad_sleep_state(stad);
+    uint16_t aid = umac_sta_data_get_aid(stad);
+    struct mmpkt_list dropped = MMPKT_LIST_INIT;
+    uint32_t now_ms = mmosal_get_time_ms();
+
     MMOSAL_TASK_ENTER_CRITICAL();
-    umac_sta_data_queue_pkt(stad, mmpkt);
-    umac_stats_update_datapath_txq_high_water_mark(umacd, ++data->num_pkts_queued);
+    if (asleep && aid)
+    {
+        struct umac_ap_sta_data *sta_data = umac_sta_data_get_ap(stad);
+        mmdrv_get_tx_metadata(mmpkt)->timeout_abs_ms = now_ms + sta_data->ps_lifetime_ms;
+        umac_ap_ps_expire_(umacd, data, stad, now_ms, &dropped);
+        mmpkt = umac_ap_ps_make_room_(umacd, data, stad, mmpkt, &dropped);
+    }
+    if (mmpkt != NULL)
+    {
+        umac_sta_data_queue_pkt(stad, mmpkt);
+        if (stad != data->sta_common)
+        {
+            umac_ap_tx_ring_insert(data, stad);
+        }
+        umac_stats_update_datapath_txq_high_water_mark(umacd, ++data->num_pkts_queued);
+    }
     MMOSAL_TASK_EXIT_CRITICAL();
 
-    bool asleep = umac_ap_get_stad_sleep_state(stad);
-    uint16_t aid = umac_sta_data_get_aid(stad);
+    mmpkt_list_clear(&dropped);
+
     if (asleep && aid)
     {
         ap_traffic_bitmap_set_aid_bit(data->bitmap, aid);
@@ -928,31 +1124,59 @@ bool umac_ap_is_stad_paused(struct umac_sta_data *stad)
 }
 
 
-static struct umac_sta_data *umac_ap_get_next_sta_for_tx(struct umac_ap_data *data)
+static struct mmpkt *umac_ap_tx_ring_pop(struct umac_data *umacd,
+                                         struct umac_ap_data *data,
+                                         struct mmpkt_list *expired,
+                                         struct umac_sta_data **stad_ptr)
 {
+    uint32_t num_paused = 0;
+    uint32_t now_ms = mmosal_get_time_ms();
 
-    struct umac_sta_data *stad = data->sta_common;
-    if (!umac_ap_is_stad_paused(stad))
+    while (data->tx_ring != NULL && num_paused < data->tx_ring_len)
     {
+        struct umac_sta_data *stad = data->tx_ring;
+        struct umac_ap_sta_data *sta_data = umac_sta_data_get_ap(stad);
 
-        bool has_traffic = umac_sta_data_get_queued_len(stad);
-        if (has_traffic)
+        if (sta_data->asleep)
         {
-            return stad;
+            umac_ap_ps_expire_(umacd, data, stad, now_ms, expired);
+        }
+        struct mmpkt *head = umac_sta_data_peek_pkt(stad);
+        if (head == NULL)
+        {
+            umac_ap_tx_ring_remove(data, stad);
+            continue;
         }
 
-        umac_ap_set_stad_sleep_state_(stad, true);
-        MMLOG_DBG("No more queued traffic for common STA, restoring sleep\n");
-    }
-
-    for (size_t ii = 1; ii < data->max_stas; ++ii)
-    {
-        stad = data->stas[ii];
-
-        if (stad != NULL && !umac_ap_is_stad_paused(stad) && umac_sta_data_get_queued_len(stad))
+        if (umac_ap_is_stad_paused(stad))
         {
-            return stad;
+            num_paused++;
         }
+        else
+        {
+            num_paused = 0;
+            if (!data->tx_quantum_granted)
+            {
+                sta_data->tx_deficit += UMAC_AP_TX_DRR_QUANTUM;
+                data->tx_quantum_granted = true;
+            }
+
+            uint32_t len = mmpkt_peek_total_length(head);
+            if (sta_data->tx_deficit >= len)
+            {
+                sta_data->tx_deficit -= len;
+                struct mmpkt *txbuf = umac_sta_data_pop_pkt(stad);
+                if (umac_sta_data_get_queued_len(stad) == 0)
+                {
+                    umac_ap_tx_ring_remove(data, stad);
+                }
+                *stad_ptr = stad;
+                return txbuf;
+            }
+        }
+
+        data->tx_ring = sta_data->tx_next;
+        data->tx_quantum_granted = false;
     }
 
     return NULL;
@@ -972,15 +1196,31 @@ bool umac_ap_tx_dequeue_frame(struct umac_data *umacd,
         return false;
     }
 
-    struct umac_sta_data *stad = umac_ap_get_next_sta_for_tx(data);
-    if (stad == NULL)
+
+    struct umac_sta_data *stad = data->sta_common;
+    bool serve_common = false;
+    if (!umac_ap_is_stad_paused(stad))
     {
-        return false;
+        serve_common = umac_sta_data_get_queued_len(stad);
+        if (!serve_common)
+        {
+            umac_ap_set_stad_sleep_state_(stad, true);
+            MMLOG_DBG("No more queued traffic for common STA, restoring sleep\n");
+        }
     }
 
     bool has_more = false;
+    struct mmpkt *txbuf = NULL;
+    struct mmpkt_list expired = MMPKT_LIST_INIT;
     MMOSAL_TASK_ENTER_CRITICAL();
-    struct mmpkt *txbuf = umac_sta_data_pop_pkt(stad);
+    if (serve_common)
+    {
+        txbuf = umac_sta_data_pop_pkt(stad);
+    }
+    else
+    {
+        txbuf = umac_ap_tx_ring_pop(umacd, data, &expired, &stad);
+    }
     if (txbuf != NULL)
     {
         has_more = --data->num_pkts_queued;
@@ -991,6 +1231,8 @@ bool umac_ap_tx_dequeue_frame(struct umac_data *umacd,
     }
     MMOSAL_TASK_EXIT_CRITICAL();
 
+    mmpkt_list_clear(&expired);
+
     *stad_ptr = stad;
     *txbuf_ptr = txbuf;
     return has_more;
@@ -1018,8 +1260,14 @@ bool umac_ap_set_stad_sleep_state(struct umac_sta_data *stad, bool asleep)
     if (!asleep)
     {
         ap_traffic_bitmap_clear_aid_bit(data->bitmap, aid);
+        return true;
     }
-    else if (umac_sta_data_get_queued_len(stad))
+
+    struct umac_ap_sta_data *sta_data = umac_sta_data_get_ap(stad);
+    MMOSAL_TASK_ENTER_CRITICAL();
+    umac_sta_data_set_pkts_timeout(stad, mmosal_get_time_ms() + sta_data->ps_lifetime_ms);
+    MMOSAL_TASK_EXIT_CRITICAL();
+    if (umac_sta_data_get_queued_len(stad))
     {
 
         ap_traffic_bitmap_set_aid_bit(data->bitmap, aid);
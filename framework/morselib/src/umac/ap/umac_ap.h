@@ -79,6 +79,8 @@ struct umac_ap_sta_info
     uint8_t mac_addr[MMWLAN_MAC_ADDR_LEN];
 
     enum morse_sta_state sta_state;
+
+    uint16_t listen_interval;
 };
 
 
@@ -30,6 +30,12 @@ struct umac_ap_data
     uint8_t bitmap[S1G_BITMAP_SUBBLOCKS];
 
     uint32_t num_pkts_queued;
+
+    struct umac_sta_data *tx_ring;
+
+    uint32_t tx_ring_len;
+
+    bool tx_quantum_granted;
 };
 
 MM_STATIC_ASSERT(MM_MEMBER_SIZE(struct umac_ap_data, bitmap) * 8 >= MAX_SUPPORTED_AID,
@@ -45,4 +51,12 @@ struct umac_ap_sta_data
     bool asleep;
 
     uint32_t last_active_ms;
+
+    struct umac_sta_data *tx_next;
+
+    struct umac_sta_data *tx_prev;
+
+    uint32_t tx_deficit;
+
+    uint32_t ps_lifetime_ms;
 };
@@ -72,6 +72,8 @@ void umac_config_init(struct umac_data *umacd)
     data->listen_interval = 0;
     data->ndp_probe_request_enabled = false;
     data->dynamic_ps_timeout_ms = MMWLAN_DEFAULT_DYNAMIC_PS_TIMEOUT_MS;
+    data->adaptive_ps_args = (struct mmwlan_adaptive_ps_args)MMWLAN_ADAPTIVE_PS_ARGS_INIT;
+    data->twt_tx_hold_args = (struct mmwlan_twt_tx_hold_args)MMWLAN_TWT_TX_HOLD_ARGS_INIT;
     data->ps_mode = MMWLAN_PS_ENABLED;
     data->supp_scan_dwell_time_ms = MMWLAN_SCAN_DEFAULT_DWELL_TIME_MS;
     data->beacon_vendor_ie_filter = NULL;
@@ -325,6 +327,32 @@ uint32_t umac_config_get_dynamic_ps_timeout(struct umac_data *umacd)
     return data->dynamic_ps_timeout_ms;
 }
 
+void umac_config_set_adaptive_ps(struct umac_data *umacd,
+                                 const struct mmwlan_adaptive_ps_args *args)
+{
+    struct umac_config_data *data = umac_data_get_config(umacd);
+    data->adaptive_ps_args = *args;
+}
+
+const struct mmwlan_adaptive_ps_args *umac_config_get_adaptive_ps(struct umac_data *umacd)
+{
+    struct umac_config_data *data = umac_data_get_config(umacd);
+    return &data->adaptive_ps_args;
+}
+
+void umac_config_set_twt_tx_hold(struct umac_data *umacd,
+                                 const struct mmwlan_twt_tx_hold_args *args)
+{
+    struct umac_config_data *data = umac_data_get_config(umacd);
+    data->twt_tx_hold_args = *args;
+}
+
+const struct mmwlan_twt_tx_hold_args *umac_config_get_twt_tx_hold(struct umac_data *umacd)
+{
+    struct umac_config_data *data = umac_data_get_config(umacd);
+    return &data->twt_tx_hold_args;
+}
+
 void umac_config_set_ps_mode(struct umac_data *umacd, enum mmwlan_ps_mode mode)
 {
     struct umac_config_data *data = umac_data_get_config(umacd);
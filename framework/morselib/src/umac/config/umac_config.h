@@ -142,6 +142,20 @@ void umac_config_set_dynamic_ps_timeout(struct umac_data *umacd, uint32_t timeou
 uint32_t umac_config_get_dynamic_ps_timeout(struct umac_data *umacd);
 
 
+void umac_config_set_adaptive_ps(struct umac_data *umacd,
+                                 const struct mmwlan_adaptive_ps_args *args);
+
+
+const struct mmwlan_adaptive_ps_args *umac_config_get_adaptive_ps(struct umac_data *umacd);
+
+
+void umac_config_set_twt_tx_hold(struct umac_data *umacd,
+                                 const struct mmwlan_twt_tx_hold_args *args);
+
+
+const struct mmwlan_twt_tx_hold_args *umac_config_get_twt_tx_hold(struct umac_data *umacd);
+
+
 bool umac_config_is_ndp_probe_supported(struct umac_data *umacd);
 
 
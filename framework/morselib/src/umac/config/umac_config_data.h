@@ -27,6 +27,8 @@ struct umac_config_data
     uint16_t listen_interval;
     bool ndp_probe_request_enabled;
     uint32_t dynamic_ps_timeout_ms;
+    struct mmwlan_adaptive_ps_args adaptive_ps_args;
+    struct mmwlan_twt_tx_hold_args twt_tx_hold_args;
     enum mmwlan_ps_mode ps_mode;
     uint32_t supp_scan_dwell_time_ms;
     const struct mmwlan_beacon_vendor_ie_filter *beacon_vendor_ie_filter;
@@ -251,6 +251,16 @@ struct umac_evt
             volatile enum mmwlan_status *status;
         } set_dynamic_ps_timeout;
 
+        struct
+        {
+
+            const struct mmwlan_adaptive_ps_args *args;
+
+            struct mmosal_semb *semb;
+
+            volatile enum mmwlan_status *status;
+        } set_adaptive_ps;
+
         struct
         {
 
@@ -308,6 +318,9 @@ bool umac_core_is_running(struct umac_data *umacd);
 
 bool umac_core_evtloop_is_active(struct umac_data *umacd);
 
+
+void umac_core_service_datapath_until(struct umac_data *umacd, volatile bool *done);
+
 #if defined(ENABLE_EXTERNAL_EVENT_LOOP) && ENABLE_EXTERNAL_EVENT_LOOP
 
 uint32_t umac_core_dispatch_events(struct umac_data *umacd);
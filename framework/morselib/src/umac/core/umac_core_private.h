@@ -10,6 +10,7 @@
 
 #define MAX_EVTS_DISPATCHED_AT_ONCE     (5)
 #define MAX_TIMEOUTS_DISPATCHED_AT_ONCE (5)
+#define UMAC_CORE_SERVICE_POLL_MS       (10)
 
 
 
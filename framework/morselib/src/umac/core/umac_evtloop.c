@@ -152,6 +152,25 @@ void umac_core_stop(struct umac_data *umacd)
 #endif
 }
 
+void umac_core_service_datapath_until(struct umac_data *umacd, volatile bool *done)
+{
+#if !(defined(ENABLE_EXTERNAL_EVENT_LOOP) && ENABLE_EXTERNAL_EVENT_LOOP)
+    struct umac_core_data *core = umac_data_get_core(umacd);
+
+    MMOSAL_ASSERT(umac_core_evtloop_is_active(umacd));
+    while (!*done)
+    {
+        if (!umac_datapath_process_data_frames(umacd))
+        {
+            mmosal_semb_wait(core->evtloop_semb, UMAC_CORE_SERVICE_POLL_MS);
+        }
+    }
+#else
+    MM_UNUSED(umacd);
+    MMOSAL_ASSERT(*done);
+#endif
+}
+
 bool umac_core_is_running(struct umac_data *umacd)
 {
     struct umac_core_data *core = umac_data_get_core(umacd);
@@ -14,6 +14,7 @@
 #include "umac/interface/umac_interface_data.h"
 #include "umac/ps/umac_ps_data.h"
 #include "umac/rc/umac_rc_data.h"
+#include "umac/regdb/umac_regdb_data.h"
 #include "umac/scan/umac_scan_data.h"
 #include "umac/health_check/umac_health_check_data.h"
 #include "umac/supplicant_shim/umac_supp_shim_data.h"
@@ -29,6 +30,7 @@ static struct umac_data
     struct umac_datapath_data datapath;
     struct umac_interface_data interface;
     struct umac_ps_data ps;
+    struct umac_regdb_data regdb;
     struct umac_scan_data scan;
     struct mmwlan_stats_umac_data stats;
     struct umac_supp_shim_data supp_shim;
@@ -106,6 +108,12 @@ struct umac_ps_data *umac_data_get_ps(struct umac_data *umacd)
     return &umacd->ps;
 }
 
+struct umac_regdb_data *umac_data_get_regdb(struct umac_data *umacd)
+{
+    UMAC_DATA_SANITY_CHECK(umacd);
+    return &umacd->regdb;
+}
+
 struct umac_scan_data *umac_data_get_scan(struct umac_data *umacd)
 {
     UMAC_DATA_SANITY_CHECK(umacd);
@@ -50,6 +50,9 @@ struct umac_interface_vif_data *umac_data_get_interface_vif(struct umac_data *um
 struct umac_ps_data *umac_data_get_ps(struct umac_data *umacd);
 
 
+struct umac_regdb_data *umac_data_get_regdb(struct umac_data *umacd);
+
+
 struct umac_scan_data *umac_data_get_scan(struct umac_data *umacd);
 
 
@@ -175,9 +178,24 @@ void umac_sta_data_queue_pkt(struct umac_sta_data *stad, struct mmpkt *mmpkt);
 struct mmpkt *umac_sta_data_pop_pkt(struct umac_sta_data *stad);
 
 
+struct mmpkt *umac_sta_data_peek_pkt(struct umac_sta_data *stad);
+
+
+struct mmpkt *umac_sta_data_pop_oldest_pkt(struct umac_sta_data *stad);
+
+
+struct mmpkt *umac_sta_data_pop_expired_pkt(struct umac_sta_data *stad, uint32_t now_ms);
+
+
+void umac_sta_data_set_pkts_timeout(struct umac_sta_data *stad, uint32_t timeout_abs_ms);
+
+
 uint32_t umac_sta_data_get_queued_len(struct umac_sta_data *stad);
 
 
+uint32_t umac_sta_data_get_queued_bytes(struct umac_sta_data *stad);
+
+
 bool umac_sta_data_is_paused(struct umac_sta_data *stad);
 
 
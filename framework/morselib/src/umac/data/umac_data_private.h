@@ -9,6 +9,8 @@
 
 #include "umac_data.h"
 
+#include "dot11/dot11.h"
+
 #include "umac/ap/umac_ap_data.h"
 #include "umac/ba/umac_ba_data.h"
 #include "umac/keys/umac_keys_data.h"
@@ -38,5 +40,8 @@ struct umac_sta_data
     struct umac_keys_sta_data keys;
     struct umac_datapath_sta_data datapath;
     struct umac_rc_sta_data rc;
-    struct mmpkt_list txq;
+    struct mmpkt_list txq[DOT11_ACI_NUM_ACS];
+    uint32_t txq_len;
+    uint32_t txq_bytes;
+    uint8_t txq_burst;
 };
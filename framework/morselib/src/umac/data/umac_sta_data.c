@@ -5,6 +5,16 @@
 
 #include "mmwlan.h"
 #include "umac_data_private.h"
+#include "umac/stats/umac_stats.h"
+
+
+#define UMAC_STA_DATA_TXQ_MAX_BURST (16)
+
+MM_STATIC_ASSERT((int)MMWLAN_STATS_AC_BE == DOT11_ACI_AC_BE &&
+                 (int)MMWLAN_STATS_AC_BK == DOT11_ACI_AC_BK &&
+                 (int)MMWLAN_STATS_AC_VI == DOT11_ACI_AC_VI &&
+                 (int)MMWLAN_STATS_AC_VO == DOT11_ACI_AC_VO,
+                 "Stats AC indexes must match ACI values");
 
 struct umac_data *umac_sta_data_get_umacd(struct umac_sta_data *stad)
 {
@@ -106,22 +116,155 @@ enum mmwlan_security_type umac_sta_data_get_security_type(struct umac_sta_data *
     return stad->security_type;
 }
 
+static const uint8_t umac_sta_data_txq_priority[DOT11_ACI_NUM_ACS] = {
+    DOT11_ACI_AC_VO, DOT11_ACI_AC_VI, DOT11_ACI_AC_BE, DOT11_ACI_AC_BK,
+};
+
+
+static struct mmpkt_list *umac_sta_data_select_txq(struct umac_sta_data *stad, bool *preempted)
+{
+    struct mmpkt_list *top = NULL;
+
+    for (unsigned ii = 0; ii < DOT11_ACI_NUM_ACS; ii++)
+    {
+        struct mmpkt_list *txq = &stad->txq[umac_sta_data_txq_priority[ii]];
+        if (mmpkt_list_is_empty(txq))
+        {
+            continue;
+        }
+
+        if (top == NULL)
+        {
+            top = txq;
+            *preempted = false;
+            if (stad->txq_burst < UMAC_STA_DATA_TXQ_MAX_BURST)
+            {
+                break;
+            }
+        }
+        else
+        {
+
+            *preempted = true;
+            return txq;
+        }
+    }
+
+    return top;
+}
+
+static struct mmpkt *umac_sta_data_dequeue_from(struct umac_sta_data *stad,
+                                                struct mmpkt_list *txq)
+{
+    struct mmpkt *pkt = mmpkt_list_dequeue(txq);
+    if (pkt != NULL)
+    {
+        stad->txq_len--;
+        stad->txq_bytes -= mmpkt_peek_total_length(pkt);
+    }
+    return pkt;
+}
+
 void umac_sta_data_queue_pkt(struct umac_sta_data *stad, struct mmpkt *pkt)
 {
     MMOSAL_ASSERT(stad != NULL);
     MMOSAL_DEV_ASSERT(pkt);
-    mmpkt_list_append(&stad->txq, pkt);
+    enum dot11_aci aci = dot11_tid_to_aci(mmdrv_get_tx_metadata(pkt)->tid);
+    mmpkt_list_append(&stad->txq[aci], pkt);
+    stad->txq_len++;
+    stad->txq_bytes += mmpkt_peek_total_length(pkt);
+    umac_stats_increment_datapath_txq_frames_queued_by_ac(stad->umacd, aci);
 }
 
 struct mmpkt *umac_sta_data_pop_pkt(struct umac_sta_data *stad)
 {
     MMOSAL_ASSERT(stad != NULL);
-    return mmpkt_list_dequeue(&stad->txq);
+    bool preempted = false;
+    struct mmpkt_list *txq = umac_sta_data_select_txq(stad, &preempted);
+    if (txq == NULL)
+    {
+        stad->txq_burst = 0;
+        return NULL;
+    }
+
+    if (preempted || mmpkt_list_length(txq) == stad->txq_len)
+    {
+        stad->txq_burst = 0;
+    }
+    else
+    {
+        stad->txq_burst++;
+    }
+    return umac_sta_data_dequeue_from(stad, txq);
+}
+
+struct mmpkt *umac_sta_data_peek_pkt(struct umac_sta_data *stad)
+{
+    MMOSAL_ASSERT(stad != NULL);
+    bool preempted = false;
+    struct mmpkt_list *txq = umac_sta_data_select_txq(stad, &preempted);
+    return (txq != NULL) ? mmpkt_list_peek(txq) : NULL;
+}
+
+struct mmpkt *umac_sta_data_pop_oldest_pkt(struct umac_sta_data *stad)
+{
+    MMOSAL_ASSERT(stad != NULL);
+    struct mmpkt_list *oldest = NULL;
+    uint32_t oldest_timeout_ms = 0;
+    for (int ii = DOT11_ACI_NUM_ACS - 1; ii >= 0; ii--)
+    {
+        struct mmpkt_list *txq = &stad->txq[umac_sta_data_txq_priority[ii]];
+        struct mmpkt *head = mmpkt_list_peek(txq);
+        if (head == NULL)
+        {
+            continue;
+        }
+        uint32_t timeout_ms = mmdrv_get_tx_metadata(head)->timeout_abs_ms;
+        if (oldest == NULL || mmosal_time_lt(timeout_ms, oldest_timeout_ms))
+        {
+            oldest = txq;
+            oldest_timeout_ms = timeout_ms;
+        }
+    }
+    return (oldest != NULL) ? umac_sta_data_dequeue_from(stad, oldest) : NULL;
+}
+
+struct mmpkt *umac_sta_data_pop_expired_pkt(struct umac_sta_data *stad, uint32_t now_ms)
+{
+    MMOSAL_ASSERT(stad != NULL);
+    for (unsigned ii = 0; ii < DOT11_ACI_NUM_ACS; ii++)
+    {
+        struct mmpkt *head = mmpkt_list_peek(&stad->txq[ii]);
+        if (head != NULL && mmosal_time_le(mmdrv_get_tx_metadata(head)->timeout_abs_ms, now_ms))
+        {
+            return umac_sta_data_dequeue_from(stad, &stad->txq[ii]);
+        }
+    }
+    return NULL;
+}
+
+void umac_sta_data_set_pkts_timeout(struct umac_sta_data *stad, uint32_t timeout_abs_ms)
+{
+    MMOSAL_ASSERT(stad != NULL);
+    for (unsigned ii = 0; ii < DOT11_ACI_NUM_ACS; ii++)
+    {
+        struct mmpkt *walk;
+        struct mmpkt *next;
+        MMPKT_LIST_WALK(&stad->txq[ii], walk, next)
+        {
+            mmdrv_get_tx_metadata(walk)->timeout_abs_ms = timeout_abs_ms;
+        }
+    }
 }
 
 uint32_t umac_sta_data_get_queued_len(struct umac_sta_data *stad)
 {
-    return mmpkt_list_length(&stad->txq);
+    return stad->txq_len;
+}
+
+uint32_t umac_sta_data_get_queued_bytes(struct umac_sta_data *stad)
+{
+    return stad->txq_bytes;
 }
 
 bool umac_sta_data_is_paused(struct umac_sta_data *stad)
@@ -0,0 +1,450 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ */
+
+#include "mmlog.h"
+#include "mmdrv.h"
+#include "umac/core/umac_core.h"
+#include "umac/datapath/datapath_airtime.h"
+#include "umac/datapath/umac_datapath_private.h"
+#include "umac/interface/umac_interface.h"
+#include "umac/stats/umac_stats.h"
+
+
+#define DATAPATH_AIRTIME_SPREAD_WINDOW_MS (1000)
+
+
+#define DATAPATH_AIRTIME_DEFAULT_RATE_BPS (300000)
+
+
+#define DATAPATH_AIRTIME_FRAME_OVERHEAD_US (600)
+
+
+#define DATAPATH_AIRTIME_RESERVE_DIVISOR (4)
+
+
+#define DATAPATH_AIRTIME_MAX_DEFER_MS (2000)
+
+
+#define DATAPATH_AIRTIME_MAX_HELD_PER_AC (4)
+
+
+static const enum dot11_aci datapath_airtime_aci_priority[DOT11_ACI_NUM_ACS] = {
+    DOT11_ACI_AC_VO,
+    DOT11_ACI_AC_VI,
+    DOT11_ACI_AC_BE,
+    DOT11_ACI_AC_BK,
+};
+
+static bool datapath_airtime_is_limited(const struct datapath_airtime_data *airtime)
+{
+    return airtime->duty_cycle != 0 && airtime->duty_cycle < MMDRV_DUTY_CYCLE_MAX;
+}
+
+static bool datapath_airtime_is_high_priority(uint8_t tid)
+{
+    enum dot11_aci aci = dot11_tid_to_aci(tid);
+    return aci == DOT11_ACI_AC_VI || aci == DOT11_ACI_AC_VO;
+}
+
+static void datapath_airtime_refill(struct datapath_airtime_data *airtime)
+{
+    uint32_t now_ms = mmosal_get_time_ms();
+    uint64_t credit_us = (uint64_t)(now_ms - airtime->last_refill_ms) * airtime->duty_cycle / 10;
+
+    airtime->last_refill_ms = now_ms;
+    if ((int64_t)airtime->budget_us + (int64_t)credit_us >= (int64_t)airtime->capacity_us)
+    {
+        airtime->budget_us = airtime->capacity_us;
+    }
+    else
+    {
+        airtime->budget_us += (int32_t)credit_us;
+    }
+}
+
+static uint32_t datapath_airtime_estimate_us(const struct datapath_airtime_data *airtime,
+                                             uint32_t len)
+{
+    return DATAPATH_AIRTIME_FRAME_OVERHEAD_US +
+           (uint32_t)(((uint64_t)len * 8 * 1000000) / airtime->rate_bps);
+}
+
+
+static uint32_t datapath_airtime_required_us(const struct datapath_airtime_data *airtime,
+                                             struct mmpkt *txbuf,
+                                             uint32_t *cost_us)
+{
+    const struct mmdrv_tx_metadata *tx_metadata = mmdrv_get_tx_metadata(txbuf);
+    uint32_t required_us;
+
+    *cost_us = datapath_airtime_estimate_us(airtime, mmpkt_peek_data_length(txbuf));
+    required_us = *cost_us;
+    if (!datapath_airtime_is_high_priority(tx_metadata->tid))
+    {
+        required_us += airtime->capacity_us / DATAPATH_AIRTIME_RESERVE_DIVISOR;
+    }
+    return MM_MIN(required_us, airtime->capacity_us);
+}
+
+static uint32_t datapath_airtime_wait_ms(const struct datapath_airtime_data *airtime,
+                                         uint32_t required_us)
+{
+    uint32_t deficit_us = required_us - airtime->budget_us;
+    return (deficit_us * 10 + airtime->duty_cycle - 1) / airtime->duty_cycle;
+}
+
+static void datapath_airtime_timeout_handler(void *arg1, void *arg2)
+{
+    struct umac_data *umacd = (struct umac_data *)arg1;
+    MM_UNUSED(arg2);
+
+    umac_data_get_datapath(umacd)->airtime.timer_pending = false;
+    umac_core_evt_wake(umacd);
+}
+
+static bool datapath_airtime_schedule(struct umac_data *umacd,
+                                      struct datapath_airtime_data *airtime,
+                                      uint32_t wait_ms)
+{
+    uint32_t due_ms = mmosal_get_time_ms() + wait_ms;
+
+    if (airtime->timer_pending && !mmosal_time_lt(due_ms, airtime->timer_due_ms))
+    {
+        return true;
+    }
+
+    umac_core_cancel_timeout(umacd, datapath_airtime_timeout_handler, umacd, NULL);
+    airtime->timer_pending = umac_core_register_timeout(umacd,
+                                                        wait_ms,
+                                                        datapath_airtime_timeout_handler,
+                                                        umacd,
+                                                        NULL);
+    if (!airtime->timer_pending)
+    {
+        MMLOG_WRN("Failed to register airtime timeout\n");
+        return false;
+    }
+
+    airtime->timer_due_ms = due_ms;
+    return true;
+}
+
+
+static void datapath_airtime_update_pause(struct umac_data *umacd,
+                                          struct datapath_airtime_data *airtime)
+{
+    bool pause = false;
+    unsigned ii;
+
+    for (ii = 0; ii < DOT11_ACI_NUM_ACS; ii++)
+    {
+        pause |= mmpkt_list_length(&airtime->held[ii]) >= DATAPATH_AIRTIME_MAX_HELD_PER_AC;
+    }
+
+    if (pause == airtime->paused)
+    {
+        return;
+    }
+
+    airtime->paused = pause;
+    if (pause)
+    {
+        umac_datapath_pause(umacd, UMAC_DATAPATH_PAUSE_SOURCE_AIRTIME);
+    }
+    else
+    {
+        umac_datapath_unpause(umacd, UMAC_DATAPATH_PAUSE_SOURCE_AIRTIME);
+    }
+}
+
+static void datapath_airtime_hold(struct umac_data *umacd,
+                                  struct datapath_airtime_data *airtime,
+                                  struct mmpkt_list *held,
+                                  struct mmpkt *txbuf)
+{
+    mmpkt_list_append(held, txbuf);
+    umac_stats_increment_datapath_tx_airtime_deferrals(umacd);
+    datapath_airtime_update_pause(umacd, airtime);
+}
+
+static bool datapath_airtime_has_held(struct datapath_airtime_data *airtime)
+{
+    unsigned ii;
+
+    for (ii = 0; ii < DOT11_ACI_NUM_ACS; ii++)
+    {
+        if (!mmpkt_list_is_empty(&airtime->held[ii]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void datapath_airtime_configure(struct umac_data *umacd,
+                                 uint32_t duty_cycle,
+                                 uint32_t centre_freq_hz)
+{
+    struct datapath_airtime_data *airtime = &umac_data_get_datapath(umacd)->airtime;
+    struct mmwlan_duty_cycle_stats stats = { 0 };
+    bool reseed = duty_cycle != airtime->duty_cycle || centre_freq_hz != airtime->centre_freq_hz;
+
+    if (!reseed && datapath_airtime_is_limited(airtime))
+    {
+        datapath_airtime_refill(airtime);
+    }
+
+    airtime->duty_cycle = duty_cycle;
+    airtime->centre_freq_hz = centre_freq_hz;
+    airtime->capacity_us = DATAPATH_AIRTIME_SPREAD_WINDOW_MS * duty_cycle / 10;
+    if (airtime->rate_bps == 0)
+    {
+        airtime->rate_bps = DATAPATH_AIRTIME_DEFAULT_RATE_BPS;
+    }
+
+    if (datapath_airtime_is_limited(airtime) &&
+        mmdrv_get_duty_cycle(&stats) == MMWLAN_SUCCESS &&
+        stats.mode == MMWLAN_DUTY_CYCLE_MODE_BURST &&
+        stats.burst_window_duration_us != 0)
+    {
+        airtime->capacity_us =
+            (uint32_t)((uint64_t)stats.burst_window_duration_us * duty_cycle /
+                       MMDRV_DUTY_CYCLE_MAX);
+        if (reseed)
+        {
+            airtime->budget_us = MM_MIN(stats.burst_airtime_remaining_us, airtime->capacity_us);
+        }
+    }
+    else if (reseed)
+    {
+        airtime->budget_us = airtime->capacity_us;
+    }
+
+    if (reseed)
+    {
+        airtime->last_refill_ms = mmosal_get_time_ms();
+    }
+    else
+    {
+        airtime->budget_us = MM_MIN(airtime->budget_us, (int32_t)airtime->capacity_us);
+    }
+
+    MMLOG_DBG("Airtime budget %ld/%lu us at duty cycle %lu%s\n",
+              airtime->budget_us,
+              airtime->capacity_us,
+              duty_cycle,
+              reseed ? "" : " (kept)");
+
+    if (datapath_airtime_has_held(airtime))
+    {
+        umac_core_evt_wake(umacd);
+    }
+}
+
+bool datapath_airtime_admit(struct umac_data *umacd, struct mmpkt *txbuf)
+{
+    struct datapath_airtime_data *airtime = &umac_data_get_datapath(umacd)->airtime;
+    const struct mmdrv_tx_metadata *tx_metadata = mmdrv_get_tx_metadata(txbuf);
+    struct mmpkt_list *held = &airtime->held[dot11_tid_to_aci(tx_metadata->tid)];
+
+
+    if (!mmpkt_list_is_empty(held))
+    {
+        datapath_airtime_hold(umacd, airtime, held, txbuf);
+        return false;
+    }
+
+    if (!datapath_airtime_is_limited(airtime))
+    {
+        return true;
+    }
+
+    datapath_airtime_refill(airtime);
+
+    uint32_t cost_us;
+    uint32_t required_us = datapath_airtime_required_us(airtime, txbuf, &cost_us);
+    if (airtime->budget_us >= (int32_t)required_us)
+    {
+        airtime->budget_us -= cost_us;
+        return true;
+    }
+
+    uint32_t wait_ms = datapath_airtime_wait_ms(airtime, required_us);
+    if (!datapath_airtime_is_high_priority(tx_metadata->tid) &&
+        wait_ms > DATAPATH_AIRTIME_MAX_DEFER_MS)
+    {
+        MMLOG_DBG("Dropping TID %u frame, airtime budget %lu us short\n",
+                  tx_metadata->tid,
+                  required_us - airtime->budget_us);
+        umac_stats_increment_datapath_txq_airtime_frames_dropped(umacd);
+        mmpkt_release(txbuf);
+        return false;
+    }
+
+    if (!datapath_airtime_schedule(umacd, airtime, wait_ms))
+    {
+        airtime->budget_us -= cost_us;
+        return true;
+    }
+
+    MMLOG_VRB("Deferring TID %u frame for %lu ms\n", tx_metadata->tid, wait_ms);
+    datapath_airtime_hold(umacd, airtime, held, txbuf);
+    return false;
+}
+
+struct mmpkt *datapath_airtime_dequeue_held(struct umac_data *umacd, struct umac_sta_data **stad)
+{
+    struct datapath_airtime_data *airtime = &umac_data_get_datapath(umacd)->airtime;
+    bool limited = datapath_airtime_is_limited(airtime);
+    uint32_t wait_ms = UINT32_MAX;
+    unsigned ii;
+
+    if (!datapath_airtime_has_held(airtime))
+    {
+        return NULL;
+    }
+
+    if (limited)
+    {
+        datapath_airtime_refill(airtime);
+    }
+
+    for (ii = 0; ii < DOT11_ACI_NUM_ACS; ii++)
+    {
+        struct mmpkt_list *held = &airtime->held[datapath_airtime_aci_priority[ii]];
+        struct mmpkt *txbuf;
+
+        while ((txbuf = mmpkt_list_peek(held)) != NULL)
+        {
+            const struct mmdrv_tx_metadata *tx_metadata = mmdrv_get_tx_metadata(txbuf);
+            const struct umac_datapath_ops *datapath_ops =
+                umac_interface_get_datapath_ops_by_vif_id(umacd, tx_metadata->vif_id);
+            *stad = NULL;
+            if (datapath_ops != NULL)
+            {
+                *stad = datapath_ops->lookup_stad_by_aid(umacd, tx_metadata->aid);
+            }
+            if (*stad == NULL)
+            {
+                MMLOG_DBG("Dropping deferred frame for departed AID %u\n", tx_metadata->aid);
+                umac_stats_increment_datapath_txq_frames_dropped(umacd);
+                mmpkt_release(mmpkt_list_dequeue(held));
+                continue;
+            }
+
+            if (limited)
+            {
+                uint32_t cost_us;
+                uint32_t required_us = datapath_airtime_required_us(airtime, txbuf, &cost_us);
+                if (airtime->budget_us < (int32_t)required_us)
+                {
+                    wait_ms = MM_MIN(wait_ms, datapath_airtime_wait_ms(airtime, required_us));
+                    break;
+                }
+                airtime->budget_us -= cost_us;
+            }
+
+            txbuf = mmpkt_list_dequeue(held);
+            datapath_airtime_update_pause(umacd, airtime);
+            return txbuf;
+        }
+    }
+
+    if (wait_ms != UINT32_MAX)
+    {
+        (void)datapath_airtime_schedule(umacd, airtime, wait_ms);
+    }
+    datapath_airtime_update_pause(umacd, airtime);
+    return NULL;
+}
+
+void datapath_airtime_handle_tx_status(struct umac_data *umacd,
+                                       const struct mmdrv_tx_metadata *tx_metadata)
+{
+    struct datapath_airtime_data *airtime = &umac_data_get_datapath(umacd)->airtime;
+
+    if (!datapath_airtime_is_limited(airtime))
+    {
+        return;
+    }
+
+    if (tx_metadata->status_flags & MMDRV_TX_STATUS_DUTY_CYCLE_CANT_SEND)
+    {
+        datapath_airtime_refill(airtime);
+        airtime->budget_us = MM_MIN(airtime->budget_us, 0);
+        return;
+    }
+
+    if (tx_metadata->aid != 0 && tx_metadata->rc_data.rates[0].attempts != 0)
+    {
+        uint32_t rate_bps = mmrc_calculate_theoretical_throughput(tx_metadata->rc_data.rates[0]);
+        if (rate_bps != 0)
+        {
+            airtime->rate_bps = rate_bps;
+        }
+    }
+}
+
+void datapath_airtime_flush(struct umac_data *umacd)
+{
+    struct datapath_airtime_data *airtime = &umac_data_get_datapath(umacd)->airtime;
+
+    unsigned ii;
+
+    airtime->duty_cycle = 0;
+    umac_core_cancel_timeout(umacd, datapath_airtime_timeout_handler, umacd, NULL);
+    airtime->timer_pending = false;
+    airtime->paused = false;
+    for (ii = 0; ii < DOT11_ACI_NUM_ACS; ii++)
+    {
+        uint32_t num_dropped = mmpkt_list_clear(&airtime->held[ii]);
+        while (num_dropped--)
+        {
+            umac_stats_increment_datapath_txq_frames_dropped(umacd);
+        }
+    }
+    umac_datapath_unpause(umacd, UMAC_DATAPATH_PAUSE_SOURCE_AIRTIME);
+}
+
+void datapath_airtime_flush_stad(struct umac_data *umacd, struct umac_sta_data *stad)
+{
+    struct datapath_airtime_data *airtime = &umac_data_get_datapath(umacd)->airtime;
+    uint16_t vif_id = umac_sta_data_get_vif_id(stad);
+    uint16_t aid = umac_sta_data_get_aid(stad);
+    unsigned ii;
+
+    for (ii = 0; ii < DOT11_ACI_NUM_ACS; ii++)
+    {
+        struct mmpkt *walk;
+        struct mmpkt *next;
+        MMPKT_LIST_WALK(&airtime->held[ii], walk, next)
+        {
+            const struct mmdrv_tx_metadata *tx_metadata = mmdrv_get_tx_metadata(walk);
+            if (tx_metadata->vif_id == vif_id && tx_metadata->aid == aid)
+            {
+                mmpkt_list_remove(&airtime->held[ii], walk);
+                mmpkt_release(walk);
+                umac_stats_increment_datapath_txq_frames_dropped(umacd);
+            }
+        }
+    }
+    datapath_airtime_update_pause(umacd, airtime);
+}
+
+uint32_t datapath_airtime_get_budget_us(struct umac_data *umacd)
+{
+    const struct datapath_airtime_data *airtime = &umac_data_get_datapath(umacd)->airtime;
+
+    if (!datapath_airtime_is_limited(airtime))
+    {
+        return UINT32_MAX;
+    }
+
+    uint64_t credit_us =
+        (uint64_t)(mmosal_get_time_ms() - airtime->last_refill_ms) * airtime->duty_cycle / 10;
+    int64_t budget_us = (int64_t)airtime->budget_us + (int64_t)credit_us;
+
+    return (uint32_t)MM_MAX(MM_MIN(budget_us, (int64_t)airtime->capacity_us), 0);
+}
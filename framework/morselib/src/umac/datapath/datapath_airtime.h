@@ -0,0 +1,36 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ */
+
+
+
+#pragma once
+
+#include "mmpkt.h"
+#include "umac/datapath/umac_datapath_data.h"
+
+
+void datapath_airtime_configure(struct umac_data *umacd,
+                                 uint32_t duty_cycle,
+                                 uint32_t centre_freq_hz);
+
+
+bool datapath_airtime_admit(struct umac_data *umacd, struct mmpkt *txbuf);
+
+
+struct mmpkt *datapath_airtime_dequeue_held(struct umac_data *umacd,
+                                            struct umac_sta_data **stad);
+
+
+void datapath_airtime_handle_tx_status(struct umac_data *umacd,
+                                       const struct mmdrv_tx_metadata *tx_metadata);
+
+
+void datapath_airtime_flush(struct umac_data *umacd);
+
+
+void datapath_airtime_flush_stad(struct umac_data *umacd, struct umac_sta_data *stad);
+
+
+uint32_t datapath_airtime_get_budget_us(struct umac_data *umacd);
@@ -6,15 +6,19 @@
 #include "mmlog.h"
 #include "umac/core/umac_core.h"
 #include "umac/datapath/datapath_defrag.h"
+#include "umac/data/umac_data.h"
+#include "umac/stats/umac_stats.h"
 #include "dot11/dot11_utils.h"
+#include "mmhal_wlan.h"
 
 
 #define DEFRAG_TIMEOUT_MS (1000)
 
 
-#define FRAG_CHAIN_MIN_ALLOC_LENGTH (1600)
+#define FRAG_CHAIN_MAX_PAYLOAD_LENGTH (DOT11_MAX_PAYLOAD_LEN)
 
-#define FRAG_CHAIN_MAX_ALLOC_LENGTH (DOT11_MAX_PAYLOAD_LEN + sizeof(struct dot11_data_hdr))
+
+#define DEFRAG_MAX_HELD_BLOCKS (MMPKTMEM_RX_POOL_N_BLOCKS / 2)
 
 
 static struct datapath_defrag_data_chain *datapath_defrag_get_frag_chain(
@@ -38,47 +42,72 @@ static bool datapath_defrag_is_in_frag_chain(struct datapath_defrag_data_chain *
             dot11_sequence_control_get_sequence_number(sequence_control));
 }
 
+static uint32_t datapath_defrag_buf_bytes(const struct mmpkt *mmpkt)
+{
+    return sizeof(*mmpkt) + mmpkt->buf_len;
+}
+
+static void datapath_defrag_account(struct umac_data *umacd, uint16_t blocks, uint32_t len)
+{
+    struct umac_datapath_data *data = umac_data_get_datapath(umacd);
+
+    data->defrag_blocks_held += blocks;
+    data->defrag_bytes_held += len;
+    umac_stats_update_datapath_rx_defrag_bytes_high_water_mark(umacd, data->defrag_bytes_held);
+}
+
+static void datapath_defrag_unaccount(struct umac_data *umacd, uint16_t blocks, uint32_t len)
+{
+    struct umac_datapath_data *data = umac_data_get_datapath(umacd);
+
+    MMOSAL_DEV_ASSERT(data->defrag_blocks_held >= blocks);
+    MMOSAL_DEV_ASSERT(data->defrag_bytes_held >= len);
+    data->defrag_blocks_held -= blocks;
+    data->defrag_bytes_held -= len;
+}
+
+
+static void datapath_defrag_release_chain(struct umac_data *umacd,
+                                          struct datapath_defrag_data_chain *frag_chain)
+{
+    mmpkt_release(frag_chain->buf);
+    frag_chain->buf = NULL;
+
+    datapath_defrag_unaccount(umacd, frag_chain->held_blocks, frag_chain->held_buf_bytes);
+    frag_chain->held_bytes = 0;
+    frag_chain->held_blocks = 0;
+    frag_chain->held_buf_bytes = 0;
+}
+
 void datapath_defrag_timeout(void *arg1, void *arg2)
 {
     struct datapath_defrag_data_chain *frag_chain = (struct datapath_defrag_data_chain *)arg1;
-
-    MM_UNUSED(arg2);
+    struct umac_data *umacd = (struct umac_data *)arg2;
 
     MMOSAL_DEV_ASSERT(frag_chain->buf != NULL);
     MMLOG_INF("Frag chain timed out %p\n", frag_chain);
 
 
-    mmpkt_release(frag_chain->buf);
-    frag_chain->buf = NULL;
+    datapath_defrag_release_chain(umacd, frag_chain);
 }
 
 
-static void datapath_defrag_init_buffer(struct umac_data *umacd,
+static void datapath_defrag_start_chain(struct umac_data *umacd,
                                         struct datapath_defrag_data_chain *frag_chain)
 {
     if (frag_chain->buf != NULL)
     {
         MMLOG_WRN("Dropping existing frag_chain_buffer as new chain has begun.\n");
-        mmpkt_release(frag_chain->buf);
-        frag_chain->buf = NULL;
+        datapath_defrag_release_chain(umacd, frag_chain);
     }
 
-    (void)umac_core_cancel_timeout(umacd, datapath_defrag_timeout, frag_chain, NULL);
-
-    frag_chain->buf =
-        mmdrv_alloc_mmpkt_for_defrag(FRAG_CHAIN_MIN_ALLOC_LENGTH, FRAG_CHAIN_MAX_ALLOC_LENGTH);
-    if (frag_chain->buf == NULL)
-    {
-        MMLOG_WRN("Failed to allocate a frag chain buffer\n");
-        return;
-    }
-    mmpkt_adjust_start_offset(frag_chain->buf, sizeof(struct dot11_data_hdr));
+    (void)umac_core_cancel_timeout(umacd, datapath_defrag_timeout, frag_chain, umacd);
 
     bool ok = umac_core_register_timeout(umacd,
                                          DEFRAG_TIMEOUT_MS,
                                          datapath_defrag_timeout,
                                          frag_chain,
-                                         NULL);
+                                         umacd);
 
     if (!ok)
     {
@@ -88,27 +117,69 @@ static void datapath_defrag_init_buffer(struct umac_data *umacd,
 }
 
 
-static bool datapath_defrag_add_fragment(struct datapath_defrag_data_chain *frag_chain,
-                                         struct mmpktview *rxbufview)
+static bool datapath_defrag_add_fragment(struct umac_data *umacd,
+                                         struct datapath_defrag_data_chain *frag_chain,
+                                         struct mmpkt *rxbuf)
 {
-    struct mmpktview *frag_chain_view = mmpkt_open(frag_chain->buf);
+    struct umac_datapath_data *data = umac_data_get_datapath(umacd);
+    uint32_t len = mmpkt_peek_data_length(rxbuf);
+    uint32_t buf_bytes = datapath_defrag_buf_bytes(rxbuf);
 
-    if (mmpkt_available_space_at_end(frag_chain_view) < mmpkt_get_data_length(rxbufview))
+    if (frag_chain->held_bytes + len > FRAG_CHAIN_MAX_PAYLOAD_LENGTH)
     {
         MMLOG_WRN("Fragment buffer space exceeded.\n");
-        mmpkt_close(&frag_chain_view);
         return false;
     }
 
-    mmpkt_append_data(frag_chain_view,
-                      mmpkt_get_data_start(rxbufview),
-                      mmpkt_get_data_length(rxbufview));
+    if (data->defrag_blocks_held >= DEFRAG_MAX_HELD_BLOCKS)
+    {
+        MMLOG_WRN("Too many RX buffers held for reassembly.\n");
+        return false;
+    }
+
+    if (frag_chain->buf == NULL)
+    {
+        frag_chain->buf = rxbuf;
+    }
+    else
+    {
+        mmpkt_append_segment(frag_chain->buf, rxbuf);
+    }
 
-    mmpkt_close(&frag_chain_view);
+    frag_chain->held_bytes += len;
+    frag_chain->held_blocks++;
+    frag_chain->held_buf_bytes += buf_bytes;
+    datapath_defrag_account(umacd, 1, buf_bytes);
     return true;
 }
 
 
+static struct mmpkt *datapath_defrag_linearize(struct umac_data *umacd,
+                                               struct datapath_defrag_data_chain *frag_chain,
+                                               uint32_t headroom)
+{
+    uint32_t len = frag_chain->held_bytes;
+    struct mmpkt *mmpkt = mmdrv_alloc_mmpkt_for_defrag(headroom + len, headroom + len);
+    if (mmpkt == NULL)
+    {
+        MMLOG_WRN("Failed to allocate a %lu octet defrag buffer\n", headroom + len);
+        return NULL;
+    }
+
+    datapath_defrag_account(umacd, 1, datapath_defrag_buf_bytes(mmpkt));
+
+    mmpkt_adjust_start_offset(mmpkt, headroom);
+    struct mmpktview *view = mmpkt_open(mmpkt);
+    struct mmpktview *chain_view = mmpkt_open(frag_chain->buf);
+    mmpkt_copy_data(chain_view, 0, mmpkt_append(view, len), len);
+    mmpkt_close(&chain_view);
+    mmpkt_close(&view);
+
+    datapath_defrag_unaccount(umacd, 1, datapath_defrag_buf_bytes(mmpkt));
+    return mmpkt;
+}
+
+
 static bool datapath_defrag_is_first_fragment(const struct dot11_hdr *header)
 {
     return (dot11_sequence_control_get_fragment_number(header->sequence_control) == 0);
@@ -146,14 +217,13 @@ struct mmpkt *datapath_defrag(struct umac_data *umacd,
 
     if (datapath_defrag_is_first_fragment(header))
     {
-        datapath_defrag_init_buffer(umacd, frag_chain);
+        datapath_defrag_start_chain(umacd, frag_chain);
         frag_chain->sequence_number =
             dot11_sequence_control_get_sequence_number(header->sequence_control);
         frag_chain->is_protected = dot11_frame_control_get_protected(header->frame_control);
     }
-
-    if (!datapath_defrag_is_in_frag_chain(frag_chain, header->sequence_control) ||
-        frag_chain->buf == NULL)
+    else if (!datapath_defrag_is_in_frag_chain(frag_chain, header->sequence_control) ||
+             frag_chain->buf == NULL)
     {
         MMLOG_INF("Missed the first fragment for this chain.\n");
         goto exit;
@@ -165,32 +235,35 @@ struct mmpkt *datapath_defrag(struct umac_data *umacd,
         goto exit;
     }
 
-    if (!datapath_defrag_add_fragment(frag_chain, *rxbufview))
-    {
-
-        mmpkt_release(frag_chain->buf);
-        frag_chain->buf = NULL;
+    bool more_fragments = dot11_frame_control_get_more_fragments(header->frame_control);
 
-        (void)umac_core_cancel_timeout(umacd, datapath_defrag_timeout, frag_chain, NULL);
+    mmpkt_close(rxbufview);
+    if (!datapath_defrag_add_fragment(umacd, frag_chain, rxbuf))
+    {
+        datapath_defrag_release_chain(umacd, frag_chain);
+        (void)umac_core_cancel_timeout(umacd, datapath_defrag_timeout, frag_chain, umacd);
         goto exit;
     }
+    rxbuf = NULL;
 
-    if (dot11_frame_control_get_more_fragments(header->frame_control))
+    if (more_fragments)
     {
 
         goto exit;
     }
 
 
-    return_buffer = frag_chain->buf;
-    frag_chain->buf = NULL;
-
-    return_view = mmpkt_open(return_buffer);
-    mmpkt_prepend_data(return_view, (const uint8_t *)(*data_hdr), data_hdr_len);
-    *data_hdr = (const struct dot11_data_hdr *)mmpkt_remove_from_start(return_view, data_hdr_len);
-
+    return_buffer = datapath_defrag_linearize(umacd, frag_chain, data_hdr_len);
+    if (return_buffer != NULL)
+    {
+        return_view = mmpkt_open(return_buffer);
+        mmpkt_prepend_data(return_view, (const uint8_t *)(*data_hdr), data_hdr_len);
+        *data_hdr =
+            (const struct dot11_data_hdr *)mmpkt_remove_from_start(return_view, data_hdr_len);
+    }
 
-    (void)umac_core_cancel_timeout(umacd, datapath_defrag_timeout, frag_chain, NULL);
+    datapath_defrag_release_chain(umacd, frag_chain);
+    (void)umac_core_cancel_timeout(umacd, datapath_defrag_timeout, frag_chain, umacd);
 
 exit:
     mmpkt_close(rxbufview);
@@ -207,9 +280,8 @@ void datapath_defrag_deinit(struct umac_data *umacd, struct datapath_defrag_data
         struct datapath_defrag_data_chain *frag_chain = datapath_defrag_get_frag_chain(data, i);
         if (frag_chain->buf != NULL)
         {
-            mmpkt_release(frag_chain->buf);
-            frag_chain->buf = NULL;
+            datapath_defrag_release_chain(umacd, frag_chain);
         }
-        (void)umac_core_cancel_timeout(umacd, datapath_defrag_timeout, frag_chain, NULL);
+        (void)umac_core_cancel_timeout(umacd, datapath_defrag_timeout, frag_chain, umacd);
     }
 }
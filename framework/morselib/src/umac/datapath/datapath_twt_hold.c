@@ -0,0 +1,260 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ */
+
+#include "mmlog.h"
+#include "umac/config/umac_config.h"
+#include "umac/core/umac_core.h"
+#include "umac/datapath/datapath_twt_hold.h"
+#include "umac/stats/umac_stats.h"
+#include "umac/twt/umac_twt.h"
+
+
+enum datapath_twt_hold_release_reason
+{
+    RELEASE_REASON_SP,
+    RELEASE_REASON_DEADLINE,
+    RELEASE_REASON_OVERFLOW,
+    RELEASE_REASON_URGENT,
+    RELEASE_REASON_DISABLED,
+};
+
+static void datapath_twt_hold_timeout_handler(void *arg1, void *arg2);
+
+static void datapath_twt_hold_release(struct umac_data *umacd,
+                                      struct datapath_twt_hold_data *hold,
+                                      enum datapath_twt_hold_release_reason reason)
+{
+    struct umac_datapath_data *data = umac_data_get_datapath(umacd);
+
+    if (hold->releasing || mmpkt_list_is_empty(&hold->queue))
+    {
+        return;
+    }
+
+    MMLOG_DBG("TWT hold release %lu frames (reason %u)\n", mmpkt_list_length(&hold->queue), reason);
+
+    switch (reason)
+    {
+        case RELEASE_REASON_SP:
+            data->twt_hold_stats.released_at_sp++;
+            break;
+
+        case RELEASE_REASON_DEADLINE:
+            data->twt_hold_stats.released_on_deadline++;
+            break;
+
+        case RELEASE_REASON_OVERFLOW:
+            data->twt_hold_stats.released_on_overflow++;
+            break;
+
+        case RELEASE_REASON_URGENT:
+            data->twt_hold_stats.released_with_urgent++;
+            break;
+
+        case RELEASE_REASON_DISABLED:
+            break;
+    }
+
+    hold->releasing = true;
+    hold->release_remaining = mmpkt_list_length(&hold->queue);
+    hold->deadline_valid = 0;
+    umac_core_cancel_timeout(umacd, datapath_twt_hold_timeout_handler, umacd, hold);
+    umac_core_evt_wake(umacd);
+}
+
+static bool datapath_twt_hold_get_earliest_deadline(struct datapath_twt_hold_data *hold,
+                                                    uint32_t *deadline_ms)
+{
+    bool found = false;
+    unsigned tid;
+
+    for (tid = 0; tid <= MMWLAN_MAX_QOS_TID; tid++)
+    {
+        if (!(hold->deadline_valid & (1u << tid)))
+        {
+            continue;
+        }
+        if (!found || mmosal_time_lt(hold->deadline_ms[tid], *deadline_ms))
+        {
+            *deadline_ms = hold->deadline_ms[tid];
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+static void datapath_twt_hold_schedule(struct umac_data *umacd,
+                                       struct datapath_twt_hold_data *hold)
+{
+    uint32_t now_ms = mmosal_get_time_ms();
+    uint32_t sp_start_ms;
+    uint32_t deadline_ms;
+    enum datapath_twt_hold_release_reason reason = RELEASE_REASON_SP;
+
+    if (!umac_twt_get_next_service_period(umacd, now_ms, &sp_start_ms))
+    {
+        datapath_twt_hold_release(umacd, hold, RELEASE_REASON_DISABLED);
+        return;
+    }
+
+    if (datapath_twt_hold_get_earliest_deadline(hold, &deadline_ms) &&
+        mmosal_time_lt(deadline_ms, sp_start_ms))
+    {
+        sp_start_ms = deadline_ms;
+        reason = RELEASE_REASON_DEADLINE;
+    }
+
+    if (!mmosal_time_lt(now_ms, sp_start_ms))
+    {
+        datapath_twt_hold_release(umacd, hold, reason);
+        return;
+    }
+
+    umac_core_cancel_timeout(umacd, datapath_twt_hold_timeout_handler, umacd, hold);
+    bool ok = umac_core_register_timeout(umacd,
+                                         sp_start_ms - now_ms,
+                                         datapath_twt_hold_timeout_handler,
+                                         umacd,
+                                         hold);
+    if (!ok)
+    {
+        MMLOG_WRN("Failed to register TWT hold timeout\n");
+        datapath_twt_hold_release(umacd, hold, reason);
+    }
+}
+
+static void datapath_twt_hold_timeout_handler(void *arg1, void *arg2)
+{
+    struct umac_data *umacd = (struct umac_data *)arg1;
+    struct datapath_twt_hold_data *hold = (struct datapath_twt_hold_data *)arg2;
+
+    datapath_twt_hold_schedule(umacd, hold);
+}
+
+static void datapath_twt_hold_arm(struct umac_data *umacd,
+                                  struct datapath_twt_hold_data *hold,
+                                  const struct mmwlan_twt_tx_hold_args *args)
+{
+    if (!args->enabled)
+    {
+        datapath_twt_hold_release(umacd, hold, RELEASE_REASON_DISABLED);
+    }
+    else if (mmpkt_list_length(&hold->queue) >= args->max_held_frames)
+    {
+        datapath_twt_hold_release(umacd, hold, RELEASE_REASON_OVERFLOW);
+    }
+    else
+    {
+        datapath_twt_hold_schedule(umacd, hold);
+    }
+}
+
+bool datapath_twt_hold_frame(struct umac_data *umacd,
+                             struct datapath_twt_hold_data *hold,
+                             struct mmpkt *txbuf)
+{
+    const struct mmwlan_twt_tx_hold_args *args = umac_config_get_twt_tx_hold(umacd);
+    struct umac_datapath_data *data = umac_data_get_datapath(umacd);
+    const struct mmdrv_tx_metadata *tx_metadata = mmdrv_get_tx_metadata(txbuf);
+    uint8_t tid = tx_metadata->tid;
+    uint32_t sp_start_ms;
+
+    if (!args->enabled ||
+        tid > MMWLAN_MAX_QOS_TID ||
+        args->max_hold_ms[tid] == 0 ||
+        !umac_twt_get_next_service_period(umacd, mmosal_get_time_ms(), &sp_start_ms))
+    {
+
+        datapath_twt_hold_release(umacd,
+                                  hold,
+                                  args->enabled ? RELEASE_REASON_URGENT : RELEASE_REASON_DISABLED);
+        if (!hold->releasing)
+        {
+            return false;
+        }
+
+        mmpkt_list_append(&hold->queue, txbuf);
+        hold->release_remaining = mmpkt_list_length(&hold->queue);
+        data->twt_hold_stats.frames_held++;
+        return true;
+    }
+
+    mmpkt_list_append(&hold->queue, txbuf);
+    data->twt_hold_stats.frames_held++;
+
+    if (!(hold->deadline_valid & (1u << tid)))
+    {
+        hold->deadline_ms[tid] = mmosal_get_time_ms() + args->max_hold_ms[tid];
+        hold->deadline_valid |= (1u << tid);
+    }
+
+    if (!hold->releasing)
+    {
+        datapath_twt_hold_arm(umacd, hold, args);
+    }
+
+    return true;
+}
+
+struct mmpkt *datapath_twt_hold_dequeue(struct umac_data *umacd,
+                                        struct datapath_twt_hold_data *hold)
+{
+    struct umac_datapath_data *data = umac_data_get_datapath(umacd);
+    struct mmpkt *txbuf;
+
+    if (!hold->releasing)
+    {
+        return NULL;
+    }
+
+    txbuf = mmpkt_list_dequeue(&hold->queue);
+    if (txbuf != NULL)
+    {
+        hold->release_remaining--;
+        data->twt_hold_stats.frames_released++;
+        data->twt_hold_stats.bytes_released += mmpkt_peek_data_length(txbuf);
+    }
+    if (hold->release_remaining == 0 || mmpkt_list_is_empty(&hold->queue))
+    {
+        hold->releasing = false;
+        hold->release_remaining = 0;
+        if (!mmpkt_list_is_empty(&hold->queue))
+        {
+            datapath_twt_hold_arm(umacd, hold, umac_config_get_twt_tx_hold(umacd));
+        }
+    }
+
+    return txbuf;
+}
+
+bool datapath_twt_hold_is_releasing(struct datapath_twt_hold_data *hold)
+{
+    return hold->releasing;
+}
+
+void datapath_twt_hold_flush(struct umac_data *umacd, struct datapath_twt_hold_data *hold)
+{
+    struct mmpkt *txbuf;
+
+    umac_core_cancel_timeout(umacd, datapath_twt_hold_timeout_handler, umacd, hold);
+    while ((txbuf = mmpkt_list_dequeue(&hold->queue)) != NULL)
+    {
+        mmpkt_release(txbuf);
+        umac_stats_increment_datapath_txq_frames_dropped(umacd);
+    }
+    hold->releasing = false;
+    hold->release_remaining = 0;
+    hold->deadline_valid = 0;
+}
+
+enum mmwlan_status datapath_twt_hold_get_stats(struct umac_data *umacd,
+                                               struct mmwlan_twt_tx_hold_stats *stats)
+{
+    struct umac_datapath_data *data = umac_data_get_datapath(umacd);
+
+    *stats = data->twt_hold_stats;
+    return MMWLAN_SUCCESS;
+}
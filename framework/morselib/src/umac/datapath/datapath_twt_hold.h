@@ -0,0 +1,30 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ */
+
+
+
+#pragma once
+
+#include "mmpkt.h"
+#include "umac/datapath/umac_datapath_data.h"
+
+
+bool datapath_twt_hold_frame(struct umac_data *umacd,
+                             struct datapath_twt_hold_data *hold,
+                             struct mmpkt *txbuf);
+
+
+struct mmpkt *datapath_twt_hold_dequeue(struct umac_data *umacd,
+                                        struct datapath_twt_hold_data *hold);
+
+
+bool datapath_twt_hold_is_releasing(struct datapath_twt_hold_data *hold);
+
+
+void datapath_twt_hold_flush(struct umac_data *umacd, struct datapath_twt_hold_data *hold);
+
+
+enum mmwlan_status datapath_twt_hold_get_stats(struct umac_data *umacd,
+                                               struct mmwlan_twt_tx_hold_stats *stats);
@@ -13,6 +13,8 @@
 #include "umac/datapath/umac_datapath_private.h"
 #include "umac/data/umac_data.h"
 #include "umac/datapath/datapath_defrag.h"
+#include "umac/datapath/datapath_airtime.h"
+#include "umac/datapath/datapath_twt_hold.h"
 #include "umac/regdb/umac_regdb.h"
 #include "umac/relay/umac_relay.h"
 #include "umac/supplicant_shim/umac_supp_shim.h"
@@ -111,6 +113,12 @@ enum mmwlan_status umac_datapath_wait_for_tx_ready(struct umac_data *umacd, uint
     return umac_datapath_wait_for_tx_ready_(data, timeout_ms, UINT16_MAX);
 }
 
+bool umac_datapath_is_tx_paused(struct umac_data *umacd)
+{
+    struct umac_datapath_data *data = umac_data_get_datapath(umacd);
+    return umac_datapath_tx_is_paused(data, UINT16_MAX);
+}
+
 
 static bool umac_datapath_validate_buf_len(struct mmpktview *view, uint32_t min_length)
 {
@@ -562,6 +570,15 @@ static void umac_datapath_process_rx_data_frame_after_reorder(
         return;
     }
 
+    if (datapath_ops->forward_rx_data_frame != NULL)
+    {
+        datapath_ops->forward_rx_data_frame(stad, tid_index, data_hdr, llc_ethertype, &rxbufview);
+        if (rxbufview == NULL)
+        {
+            return;
+        }
+    }
+
 
     struct umac_8023_hdr header_8023 = { 0 };
     umac_datapath_generate_8023_header(dot11_get_da(header),
@@ -1382,10 +1399,16 @@ void umac_datapath_stad_flush_txq(struct umac_data *umacd, struct umac_sta_data
     {
         struct mmpkt *mmpkt = umac_sta_data_pop_pkt(stad);
         MMOSAL_DEV_ASSERT(mmpkt);
+        umac_stats_increment_datapath_txq_frames_dropped_by_ac(
+            umacd,
+            dot11_tid_to_aci(mmdrv_get_tx_metadata(mmpkt)->tid));
         mmpkt_release(mmpkt);
         umac_stats_increment_datapath_txq_frames_dropped(umacd);
         MMLOG_VRB("Popped and dropped packet for stad AID=%d\n", aid);
     }
+
+    datapath_twt_hold_flush(umacd, &umac_sta_data_get_datapath(stad)->twt_hold);
+    datapath_airtime_flush_stad(umacd, stad);
 }
 
 void umac_datapath_stad_flush(struct umac_data *umacd, struct umac_sta_data *stad)
@@ -1554,15 +1577,16 @@ static void umac_datapath_process_rx_frame(struct umac_data *umacd,
 
 
 static inline bool umac_datapath_process_rx(struct umac_data *umacd,
-                                            struct umac_datapath_data *data)
+                                            struct umac_datapath_data *data,
+                                            bool include_mgmt)
 {
     unsigned ii;
     for (ii = 0; ii < MAX_RX_PROCESS_PER_LOOP; ii++)
     {
         struct mmpkt *mmpkt;
         MMOSAL_TASK_ENTER_CRITICAL();
-        mmpkt = data->rx_mgmt_q.len ? mmpkt_list_dequeue(&data->rx_mgmt_q) :
-                                      mmpkt_list_dequeue(&data->rxq);
+        mmpkt = (include_mgmt && data->rx_mgmt_q.len) ? mmpkt_list_dequeue(&data->rx_mgmt_q) :
+                                                        mmpkt_list_dequeue(&data->rxq);
         MMOSAL_TASK_EXIT_CRITICAL();
 
         if (mmpkt == NULL)
@@ -2017,10 +2041,24 @@ drop:
 
 static bool umac_datapath_dequeue_tx_frame(struct umac_data *umacd,
                                            struct umac_sta_data **stad,
-                                           struct mmpkt **txbuf)
+                                           struct mmpkt **txbuf,
+                                           bool *admitted)
 {
 
     const struct umac_datapath_ops *datapath_ops;
+    struct umac_datapath_data *data = umac_data_get_datapath(umacd);
+
+    *txbuf = datapath_airtime_dequeue_held(umacd, stad);
+    *admitted = (*txbuf != NULL);
+    if (*txbuf != NULL)
+    {
+        return true;
+    }
+
+    if (umac_datapath_tx_is_paused(data, UMAC_DATAPATH_PAUSE_SOURCE_AIRTIME))
+    {
+        return false;
+    }
 
     datapath_ops = umac_interface_get_datapath_ops(umacd, MMWLAN_VIF_STA);
     if (datapath_ops != NULL)
@@ -2053,7 +2091,9 @@ static inline bool umac_datapath_process_tx(struct umac_data *umacd,
     for (unsigned ii = 0; ii < MAX_TX_PROCESS_PER_LOOP; ii++)
     {
 
-        if (umac_datapath_tx_is_paused(data, ~MMDRV_PAUSE_SOURCE_MASK_PKTMEM))
+        if (umac_datapath_tx_is_paused(data,
+                                       ~(MMDRV_PAUSE_SOURCE_MASK_PKTMEM |
+                                         UMAC_DATAPATH_PAUSE_SOURCE_AIRTIME)))
         {
             MMLOG_DBG("TX datapath blocked.\n");
             return false;
@@ -2061,7 +2101,8 @@ static inline bool umac_datapath_process_tx(struct umac_data *umacd,
 
         struct mmpkt *mmpkt = NULL;
         struct umac_sta_data *stad = NULL;
-        has_more = umac_datapath_dequeue_tx_frame(umacd, &stad, &mmpkt);
+        bool admitted = false;
+        has_more = umac_datapath_dequeue_tx_frame(umacd, &stad, &mmpkt, &admitted);
 
         if (mmpkt == NULL)
         {
@@ -2077,6 +2118,11 @@ static inline bool umac_datapath_process_tx(struct umac_data *umacd,
                   umac_sta_data_get_aid(stad),
                   tx_metadata->vif_id);
 
+        if (!admitted && !datapath_airtime_admit(umacd, mmpkt))
+        {
+            continue;
+        }
+
         umac_datapath_process_tx_frame(umacd, stad, mmpkt_open(mmpkt));
     }
     return has_more;
@@ -2086,6 +2132,8 @@ static void umac_datapath_flush_txq(struct umac_data *umacd)
 {
     struct umac_datapath_data *data = umac_data_get_datapath(umacd);
     bool more = true;
+
+    datapath_airtime_flush(umacd);
     do {
 
         more = umac_datapath_process_tx(umacd, data);
@@ -2093,6 +2141,8 @@ static void umac_datapath_flush_txq(struct umac_data *umacd)
 
     umac_stats_clear_datapath_txq_high_water_mark(umacd);
     umac_stats_clear_datapath_txq_frames_dropped(umacd);
+    umac_stats_clear_datapath_tx_airtime_deferrals(umacd);
+    umac_stats_clear_datapath_txq_airtime_frames_dropped(umacd);
 }
 
 enum mmwlan_status umac_datapath_tx_mgmt_frame(struct umac_sta_data *stad, struct mmpkt *txbuf)
@@ -2171,7 +2221,7 @@ enum mmwlan_status umac_datapath_tx_mgmt_frame(struct umac_sta_data *stad, struc
     umac_rc_init_rate_table_mgmt(umacd, &tx_metadata->rc_data, false);
 
 
-    pause_mask = ~MMDRV_PAUSE_SOURCE_MASK_PKTMEM;
+    pause_mask = ~(MMDRV_PAUSE_SOURCE_MASK_PKTMEM | UMAC_DATAPATH_PAUSE_SOURCE_AIRTIME);
     if (is_probe_request)
     {
         pause_mask &= ~UMAC_DATAPATH_PAUSE_SOURCE_SCAN;
@@ -2237,6 +2287,8 @@ static inline void umac_datapath_process_tx_status_queue(struct umac_data *umacd
         struct mmdrv_tx_metadata *tx_metadata = mmdrv_get_tx_metadata(mmpkt);
         MMOSAL_DEV_ASSERT(tx_metadata != NULL);
 
+        datapath_airtime_handle_tx_status(umacd, tx_metadata);
+
         const struct umac_datapath_ops *datapath_ops =
             umac_interface_get_datapath_ops_by_vif_id(umacd, tx_metadata->vif_id);
         if (datapath_ops == NULL)
@@ -2405,7 +2457,8 @@ enum mmwlan_status umac_datapath_build_and_tx_to_ds_qos_null_frame(struct umac_s
 
 
     uint32_t timeout_ms = umac_datapath_calculate_tx_timeout_ms(umacd, true);
-    enum mmwlan_status status = umac_datapath_wait_for_tx_ready_(data, timeout_ms, UINT16_MAX);
+    enum mmwlan_status status =
+        umac_datapath_wait_for_tx_ready_(data, timeout_ms, ~UMAC_DATAPATH_PAUSE_SOURCE_AIRTIME);
     if (status != MMWLAN_SUCCESS)
     {
         MMLOG_DBG("TX datapath blocked.\n");
@@ -2428,7 +2481,8 @@ enum mmwlan_status umac_datapath_build_and_tx_4addr_qos_null_frame(struct umac_s
 
 
     uint32_t timeout_ms = umac_datapath_calculate_tx_timeout_ms(umacd, true);
-    enum mmwlan_status status = umac_datapath_wait_for_tx_ready_(data, timeout_ms, UINT16_MAX);
+    enum mmwlan_status status =
+        umac_datapath_wait_for_tx_ready_(data, timeout_ms, ~UMAC_DATAPATH_PAUSE_SOURCE_AIRTIME);
     if (status != MMWLAN_SUCCESS)
     {
         MMLOG_DBG("TX datapath blocked.\n");
@@ -2486,7 +2540,15 @@ bool umac_datapath_process(struct umac_data *umacd)
 {
     struct umac_datapath_data *data = umac_data_get_datapath(umacd);
     umac_datapath_process_tx_status_queue(umacd, data);
-    bool more_rx = umac_datapath_process_rx(umacd, data);
+    bool more_rx = umac_datapath_process_rx(umacd, data, true);
+    bool more_tx = umac_datapath_process_tx(umacd, data);
+    return more_rx || more_tx;
+}
+
+bool umac_datapath_process_data_frames(struct umac_data *umacd)
+{
+    struct umac_datapath_data *data = umac_data_get_datapath(umacd);
+    bool more_rx = umac_datapath_process_rx(umacd, data, false);
     bool more_tx = umac_datapath_process_tx(umacd, data);
     return more_rx || more_tx;
 }
@@ -2498,6 +2560,12 @@ bool umac_datapath_process(struct umac_data *umacd)
     return false;
 }
 
+bool umac_datapath_process_data_frames(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    return false;
+}
+
 #endif
 
 static bool umac_datapath_pause_protected(struct umac_datapath_data *data, uint16_t source_mask)
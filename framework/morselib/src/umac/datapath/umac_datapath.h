@@ -91,9 +91,15 @@ enum mmwlan_status umac_datapath_tx_frame(struct umac_data *umacd,
 enum mmwlan_status umac_datapath_wait_for_tx_ready(struct umac_data *umacd, uint32_t timeout_ms);
 
 
+bool umac_datapath_is_tx_paused(struct umac_data *umacd);
+
+
 bool umac_datapath_process(struct umac_data *umacd);
 
 
+bool umac_datapath_process_data_frames(struct umac_data *umacd);
+
+
 enum mmwlan_status umac_datapath_tx_mgmt_frame(struct umac_sta_data *stad, struct mmpkt *txbuf);
 
 
@@ -139,6 +145,7 @@ enum umac_datapath_pause_source
     UMAC_DATAPATH_PAUSE_SOURCE_WNM_SLEEP = 0x200,
     UMAC_DATAPATH_PAUSE_SOURCE_STANDBY = 0x400,
     UMAC_DATAPATH_PAUSE_SOURCE_ECSA = 0x800,
+    UMAC_DATAPATH_PAUSE_SOURCE_AIRTIME = 0x1000,
 };
 
 
@@ -173,7 +173,7 @@ enum mmwlan_status umac_datapath_tx_mgmt_frame_ap(struct umac_data *umacd,
     }
 
 
-    pause_mask = ~MMDRV_PAUSE_SOURCE_MASK_PKTMEM;
+    pause_mask = ~(MMDRV_PAUSE_SOURCE_MASK_PKTMEM | UMAC_DATAPATH_PAUSE_SOURCE_AIRTIME);
 
     timeout_ms = MMWLAN_TX_DEFAULT_TIMEOUT_MS;
     status = umac_datapath_wait_for_tx_ready_(data, timeout_ms, pause_mask);
@@ -264,6 +264,92 @@ static void umac_datapath_ap_handle_frame_unknown_sta(struct umac_data *umacd, c
     }
 }
 
+static void umac_datapath_ap_forward_rx_data_frame(struct umac_sta_data *stad,
+                                                   uint8_t rx_tid,
+                                                   const struct dot11_data_hdr *data_hdr,
+                                                   uint16_t llc_ethertype,
+                                                   struct mmpktview **rxbufview)
+{
+    struct umac_data *umacd = umac_sta_data_get_umacd(stad);
+    const struct mmwlan_ap_args *args = umac_ap_get_args(umacd);
+    const uint8_t *da = dot11_get_da(&data_hdr->base);
+    const uint8_t *sa = dot11_get_sa_data(data_hdr);
+
+    if (args == NULL ||
+        args->intra_bss_policy == MMWLAN_AP_INTRA_BSS_TO_HOST ||
+        dot11_is_4addr_hdr(data_hdr->base.frame_control) ||
+        mm_mac_addr_is_multicast(da) ||
+        umac_interface_addr_matches_mac_addr(stad, da))
+    {
+        return;
+    }
+
+    struct umac_sta_data *dest_stad = umac_ap_lookup_sta_by_addr(umacd, da);
+    if (dest_stad == NULL)
+    {
+        return;
+    }
+
+    struct mmpkt *rxbuf = mmpkt_from_view(*rxbufview);
+    uint32_t payload_len = mmpkt_get_data_length(*rxbufview);
+
+    if (args->intra_bss_policy == MMWLAN_AP_INTRA_BSS_ISOLATE)
+    {
+        MMLOG_VRB("Isolating " MM_MAC_ADDR_FMT " from " MM_MAC_ADDR_FMT "\n",
+                  MM_MAC_ADDR_VAL(sa),
+                  MM_MAC_ADDR_VAL(da));
+        umac_stats_increment_datapath_rx_intra_bss_isolated(umacd);
+        goto consumed;
+    }
+
+    if (umac_datapath_is_tx_paused(umacd))
+    {
+        MMLOG_VRB("TX paused, dropping intra-BSS frame for " MM_MAC_ADDR_FMT "\n",
+                  MM_MAC_ADDR_VAL(da));
+        umac_stats_increment_datapath_rx_intra_bss_dropped(umacd);
+        goto consumed;
+    }
+
+    uint8_t tid = (rx_tid <= MMWLAN_MAX_QOS_TID) ? rx_tid : 0;
+    struct mmpkt *txbuf =
+        umac_datapath_alloc_mmpkt_for_qos_data_tx(sizeof(struct umac_8023_hdr) + payload_len,
+                                                  MMDRV_PKT_CLASS_DATA_TID0 + tid);
+    if (txbuf == NULL)
+    {
+        MMLOG_DBG("Failed to allocate intra-BSS frame for " MM_MAC_ADDR_FMT "\n",
+                  MM_MAC_ADDR_VAL(da));
+        umac_stats_increment_datapath_rx_intra_bss_dropped(umacd);
+        goto consumed;
+    }
+
+    struct umac_8023_hdr header_8023;
+    umac_datapath_generate_8023_header(da, sa, llc_ethertype, &header_8023);
+
+    struct mmpktview *txbufview = mmpkt_open(txbuf);
+    mmpkt_append_data(txbufview, (const uint8_t *)&header_8023, sizeof(header_8023));
+    mmpkt_append_data(txbufview, mmpkt_get_data_start(*rxbufview), payload_len);
+    mmpkt_close(&txbufview);
+
+    struct mmdrv_tx_metadata *tx_metadata = mmdrv_get_tx_metadata(txbuf);
+    tx_metadata->tid = tid;
+    tx_metadata->vif_id = umac_sta_data_get_vif_id(dest_stad);
+
+    enum mmwlan_status status = umac_datapath_tx_frame(umacd, txbuf, ENCRYPTION_ENABLED, NULL);
+    if (status == MMWLAN_SUCCESS)
+    {
+        umac_stats_increment_datapath_rx_intra_bss_forwarded(umacd);
+    }
+    else
+    {
+        MMLOG_DBG("Failed to forward to " MM_MAC_ADDR_FMT " (%u)\n", MM_MAC_ADDR_VAL(da), status);
+        umac_stats_increment_datapath_rx_intra_bss_dropped(umacd);
+    }
+
+consumed:
+    mmpkt_close(rxbufview);
+    mmpkt_release(rxbuf);
+}
+
 
 const uint16_t frames_allowed_pre_association_ap_mode[] = {
     DOT11_VER_TYPE_SUBTYPE(0, MGMT, PROBE_REQ),
@@ -286,6 +372,7 @@ static const struct umac_datapath_ops datapath_ops_ap = {
     .get_sta_state = umac_ap_get_sta_state,
     .supp_l2_sock_receive = umac_supp_l2_sock_receive_ap,
     .handle_frame_unknown_sta = umac_datapath_ap_handle_frame_unknown_sta,
+    .forward_rx_data_frame = umac_datapath_ap_forward_rx_data_frame,
     .frames_allowed_pre_association = frames_allowed_pre_association_ap_mode,
     .type = "AP",
 };
@@ -22,6 +22,12 @@ struct datapath_defrag_data_chain
     bool is_protected;
 
     struct mmpkt *buf;
+
+    uint32_t held_bytes;
+
+    uint16_t held_blocks;
+
+    uint32_t held_buf_bytes;
 };
 
 
@@ -34,6 +40,46 @@ struct datapath_defrag_data
 };
 
 
+struct datapath_twt_hold_data
+{
+
+    struct mmpkt_list queue;
+
+    uint32_t deadline_ms[MMWLAN_MAX_QOS_TID + 1];
+
+    uint8_t deadline_valid;
+
+    bool releasing;
+
+    uint32_t release_remaining;
+};
+
+
+struct datapath_airtime_data
+{
+
+    uint32_t duty_cycle;
+
+    uint32_t centre_freq_hz;
+
+    uint32_t capacity_us;
+
+    int32_t budget_us;
+
+    uint32_t last_refill_ms;
+
+    uint32_t rate_bps;
+
+    struct mmpkt_list held[DOT11_ACI_NUM_ACS];
+
+    bool timer_pending;
+
+    uint32_t timer_due_ms;
+
+    bool paused;
+};
+
+
 struct datapath_txq_data
 {
     struct mmpkt_list queue;
@@ -70,6 +116,14 @@ struct umac_datapath_data
     void *rx_frame_cb_arg;
 
     uint32_t rx_frame_filter;
+
+    struct mmwlan_twt_tx_hold_stats twt_hold_stats;
+
+    uint32_t defrag_bytes_held;
+
+    uint16_t defrag_blocks_held;
+
+    struct datapath_airtime_data airtime;
 };
 
 
@@ -85,4 +139,6 @@ struct umac_datapath_sta_data
     struct mmpkt_list rx_reorder_list;
 
     uint16_t rx_reorder_tid;
+
+    struct datapath_twt_hold_data twt_hold;
 };
@@ -69,6 +69,13 @@ struct umac_datapath_ops
     void (*handle_frame_unknown_sta)(struct umac_data *umacd, const uint8_t *ta);
 
 
+    void (*forward_rx_data_frame)(struct umac_sta_data *stad,
+                                  uint8_t rx_tid,
+                                  const struct dot11_data_hdr *data_hdr,
+                                  uint16_t llc_ethertype,
+                                  struct mmpktview **rxbufview);
+
+
     const uint16_t *frames_allowed_pre_association;
 
 
@@ -16,6 +16,8 @@
 #include "umac/scan/umac_scan.h"
 #include "common/mac_address.h"
 #include "umac/stats/umac_stats.h"
+#include "umac/twt/umac_twt.h"
+#include "umac/datapath/datapath_twt_hold.h"
 
 static void umac_datapath_process_rx_mgmt_frame_sta(struct umac_data *umacd,
                                                     struct umac_sta_data *stad,
@@ -156,12 +158,21 @@ const uint16_t frames_allowed_pre_association_sta_mode[] = {
     UINT16_MAX,
 };
 
-static bool nullop_update_stad_state_sta(struct umac_sta_data *stad,
-                                         const struct mmdrv_rx_metadata *metadata,
-                                         uint16_t frame_control_le)
+static bool umac_datapath_update_stad_state_rx_sta(struct umac_sta_data *stad,
+                                                   const struct mmdrv_rx_metadata *metadata,
+                                                   uint16_t frame_control_le)
 {
-    MM_UNUSED(frame_control_le);
-    return stad != NULL && metadata != NULL;
+    if (stad == NULL || metadata == NULL)
+    {
+        return false;
+    }
+
+
+    if (dot11_frame_control_get_type(frame_control_le) == DOT11_FC_TYPE_DATA)
+    {
+        umac_twt_align_service_period(umac_sta_data_get_umacd(stad));
+    }
+    return true;
 }
 
 static void umac_datapath_tx_queue_frame_sta(struct umac_data *umacd,
@@ -189,9 +200,31 @@ static bool umac_datapath_tx_dequeue_frame_sta(struct umac_data *umacd,
     {
         return false;
     }
+
+    struct datapath_twt_hold_data *hold = &umac_sta_data_get_datapath(stad)->twt_hold;
+    while (*txbuf_ptr == NULL)
+    {
+        *txbuf_ptr = datapath_twt_hold_dequeue(umacd, hold);
+        if (*txbuf_ptr != NULL)
+        {
+            break;
+        }
+
+        MMOSAL_TASK_ENTER_CRITICAL();
+        struct mmpkt *txbuf = umac_sta_data_pop_pkt(stad);
+        MMOSAL_TASK_EXIT_CRITICAL();
+        if (txbuf == NULL)
+        {
+            break;
+        }
+        if (!datapath_twt_hold_frame(umacd, hold, txbuf))
+        {
+            *txbuf_ptr = txbuf;
+        }
+    }
+
     MMOSAL_TASK_ENTER_CRITICAL();
-    *txbuf_ptr = umac_sta_data_pop_pkt(stad);
-    has_more = umac_sta_data_get_queued_len(stad);
+    has_more = umac_sta_data_get_queued_len(stad) || datapath_twt_hold_is_releasing(hold);
     MMOSAL_TASK_EXIT_CRITICAL();
     if (*txbuf_ptr != NULL)
     {
@@ -213,7 +246,7 @@ static const struct umac_datapath_ops datapath_ops_sta = {
     .lookup_stad_by_peer_addr = umac_datapath_lookup_stad_by_peer_addr_sta_mode,
     .lookup_stad_by_tx_dest_addr = umac_datapath_lookup_stad_by_tx_dest_addr_sta_mode,
     .lookup_stad_by_aid = umac_datapath_lookup_stad_by_aid_sta,
-    .update_stad_state_rx = nullop_update_stad_state_sta,
+    .update_stad_state_rx = umac_datapath_update_stad_state_rx_sta,
     .is_stad_tx_paused = umac_sta_data_is_paused,
     .enqueue_tx_frame = umac_datapath_tx_queue_frame_sta,
     .dequeue_tx_frame = umac_datapath_tx_dequeue_frame_sta,
@@ -18,6 +18,7 @@
 #include "umac/regdb/umac_regdb.h"
 #include "umac/twt/umac_twt.h"
 #include "umac/core/umac_core.h"
+#include "umac/datapath/datapath_airtime.h"
 #include "umac/supplicant_shim/umac_supp_shim.h"
 #include "umac/health_check/umac_health_check.h"
 #include "mmhal_wlan.h"
@@ -122,6 +123,7 @@ static void umac_interface_init_vif(struct umac_data *umacd,
 
     umac_health_check_start(umacd);
     mmdrv_set_dynamic_ps_timeout(umac_config_get_dynamic_ps_timeout(umacd));
+    mmdrv_set_adaptive_ps(umac_config_get_adaptive_ps(umacd));
 
     if (vif_data->active_interface_types & UMAC_INTERFACE_SCAN)
     {
@@ -732,6 +734,12 @@ static enum mmwlan_status umac_interface_set_channel_internal(
         MMLOG_WRN("Failed to set duty cycle %d\n", s1g_channel_info->duty_cycle_sta);
         return status;
     }
+    if (!is_off_channel)
+    {
+        datapath_airtime_configure(umacd,
+                                   s1g_channel_info->duty_cycle_sta,
+                                   s1g_channel_info->centre_freq_hz);
+    }
 
     status = mmdrv_cfg_mpsw(s1g_channel_info->airtime_min_us,
                             s1g_channel_info->airtime_max_us,
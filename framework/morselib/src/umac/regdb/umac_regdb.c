@@ -4,7 +4,96 @@
  */
 
 #include "umac_regdb.h"
+#include "umac_regdb_data.h"
 #include "umac/config/umac_config.h"
+#include "umac/data/umac_data.h"
+
+
+typedef uint32_t (*umac_regdb_key_fn_t)(const struct mmwlan_s1g_channel *chan);
+
+static uint32_t umac_regdb_chan_num_key(const struct mmwlan_s1g_channel *chan)
+{
+    return chan->s1g_chan_num;
+}
+
+static uint32_t umac_regdb_freq_key(const struct mmwlan_s1g_channel *chan)
+{
+    return chan->centre_freq_hz;
+}
+
+static void umac_regdb_sort_index(const struct mmwlan_s1g_channel_list *channel_list,
+                                  uint8_t *index,
+                                  umac_regdb_key_fn_t key_fn)
+{
+    uint32_t ii;
+
+    for (ii = 0; ii < channel_list->num_channels; ii++)
+    {
+        uint32_t key = key_fn(&channel_list->channels[ii]);
+        uint32_t jj = ii;
+
+        while (jj > 0 && key_fn(&channel_list->channels[index[jj - 1]]) > key)
+        {
+            index[jj] = index[jj - 1];
+            jj--;
+        }
+        index[jj] = ii;
+    }
+}
+
+static uint32_t umac_regdb_lower_bound(const struct mmwlan_s1g_channel_list *channel_list,
+                                       const uint8_t *index,
+                                       umac_regdb_key_fn_t key_fn,
+                                       uint32_t key)
+{
+    uint32_t lo = 0;
+    uint32_t hi = channel_list->num_channels;
+
+    while (lo < hi)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (key_fn(&channel_list->channels[index[mid]]) < key)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+static const struct umac_regdb_data *umac_regdb_get_index(
+    struct umac_data *umacd,
+    const struct mmwlan_s1g_channel_list *channel_list)
+{
+    const struct umac_regdb_data *data = umac_data_get_regdb(umacd);
+    return (data->indexed_list == channel_list) ? data : NULL;
+}
+
+void umac_regdb_build_index(struct umac_data *umacd)
+{
+    struct umac_regdb_data *data = umac_data_get_regdb(umacd);
+    const struct mmwlan_s1g_channel_list *channel_list = umac_config_get_channel_list(umacd);
+
+    data->indexed_list = NULL;
+    if (channel_list == NULL)
+    {
+        return;
+    }
+
+    if (channel_list->num_channels > UMAC_REGDB_INDEX_MAX_CHANNELS)
+    {
+        MMLOG_INF("Channel list too large to index (%u channels)\n", channel_list->num_channels);
+        return;
+    }
+
+    umac_regdb_sort_index(channel_list, data->by_chan_num, umac_regdb_chan_num_key);
+    umac_regdb_sort_index(channel_list, data->by_freq, umac_regdb_freq_key);
+    data->indexed_list = channel_list;
+}
 
 const char *umac_regdb_get_country_code(struct umac_data *umacd)
 {
@@ -49,6 +138,21 @@ const struct mmwlan_s1g_channel *umac_regdb_get_channel(struct umac_data *umacd,
         return NULL;
     }
 
+    const struct umac_regdb_data *index = umac_regdb_get_index(umacd, channel_list);
+    if (index != NULL)
+    {
+        ii = umac_regdb_lower_bound(channel_list,
+                                    index->by_chan_num,
+                                    umac_regdb_chan_num_key,
+                                    s1g_chan_num);
+        if (ii < channel_list->num_channels &&
+            channel_list->channels[index->by_chan_num[ii]].s1g_chan_num == s1g_chan_num)
+        {
+            return &channel_list->channels[index->by_chan_num[ii]];
+        }
+        return NULL;
+    }
+
     for (ii = 0; ii < channel_list->num_channels; ii++)
     {
         const struct mmwlan_s1g_channel *chan = &(channel_list->channels[ii]);
@@ -61,6 +165,54 @@ const struct mmwlan_s1g_channel *umac_regdb_get_channel(struct umac_data *umacd,
     return NULL;
 }
 
+const struct mmwlan_s1g_channel *umac_regdb_get_channel_for_op_class(struct umac_data *umacd,
+                                                                     uint8_t s1g_chan_num,
+                                                                     uint8_t op_class)
+{
+    uint32_t ii;
+    const struct mmwlan_s1g_channel_list *channel_list = umac_config_get_channel_list(umacd);
+
+    if (channel_list == NULL)
+    {
+        MMLOG_WRN("NULL regdom\n");
+        return NULL;
+    }
+
+    const struct umac_regdb_data *index = umac_regdb_get_index(umacd, channel_list);
+    if (index != NULL)
+    {
+        for (ii = umac_regdb_lower_bound(channel_list,
+                                         index->by_chan_num,
+                                         umac_regdb_chan_num_key,
+                                         s1g_chan_num);
+             ii < channel_list->num_channels;
+             ii++)
+        {
+            const struct mmwlan_s1g_channel *chan = &channel_list->channels[index->by_chan_num[ii]];
+            if (chan->s1g_chan_num != s1g_chan_num)
+            {
+                break;
+            }
+            if (umac_regdb_op_class_match(umacd, op_class, chan))
+            {
+                return chan;
+            }
+        }
+        return NULL;
+    }
+
+    for (ii = 0; ii < channel_list->num_channels; ii++)
+    {
+        const struct mmwlan_s1g_channel *chan = &(channel_list->channels[ii]);
+        if (chan->s1g_chan_num == s1g_chan_num && umac_regdb_op_class_match(umacd, op_class, chan))
+        {
+            return chan;
+        }
+    }
+
+    return NULL;
+}
+
 const struct mmwlan_s1g_channel *umac_regdb_get_channel_from_freq_and_bw(struct umac_data *umacd,
                                                                          uint32_t centre_freq_hz,
                                                                          uint8_t bw_mask)
@@ -74,9 +226,24 @@ const struct mmwlan_s1g_channel *umac_regdb_get_channel_from_freq_and_bw(struct
         return NULL;
     }
 
-    for (uint32_t ii = 0; ii < channel_list->num_channels; ii++)
+    const struct umac_regdb_data *index = umac_regdb_get_index(umacd, channel_list);
+    uint32_t first = 0;
+    if (index != NULL)
     {
-        const struct mmwlan_s1g_channel *chan = &channel_list->channels[ii];
+        first = umac_regdb_lower_bound(channel_list,
+                                       index->by_freq,
+                                       umac_regdb_freq_key,
+                                       centre_freq_hz);
+    }
+
+    for (uint32_t ii = first; ii < channel_list->num_channels; ii++)
+    {
+        const struct mmwlan_s1g_channel *chan =
+            &channel_list->channels[(index != NULL) ? index->by_freq[ii] : ii];
+        if (index != NULL && chan->centre_freq_hz != centre_freq_hz)
+        {
+            break;
+        }
         MMOSAL_DEV_ASSERT(chan->bw_mhz != 0 && (chan->bw_mhz & (chan->bw_mhz - 1)) == 0);
 
         if (chan->centre_freq_hz != centre_freq_hz || (bw_mask & chan->bw_mhz) == 0)
@@ -21,10 +21,18 @@ bool umac_regdb_op_class_match(struct umac_data *umacd,
                                const struct mmwlan_s1g_channel *chan);
 
 
+void umac_regdb_build_index(struct umac_data *umacd);
+
+
 const struct mmwlan_s1g_channel *umac_regdb_get_channel(struct umac_data *umacd,
                                                         uint8_t s1g_chan_num);
 
 
+const struct mmwlan_s1g_channel *umac_regdb_get_channel_for_op_class(struct umac_data *umacd,
+                                                                     uint8_t s1g_chan_num,
+                                                                     uint8_t op_class);
+
+
 const struct mmwlan_s1g_channel *umac_regdb_get_channel_from_freq_and_bw(struct umac_data *umacd,
                                                                          uint32_t centre_freq_hz,
                                                                          uint8_t bw_mask);
@@ -52,3 +60,11 @@ static inline const struct mmwlan_s1g_channel *umac_regdb_get_channel_at_index(
 }
 
 
+static inline bool umac_regdb_channels_overlap(const struct mmwlan_s1g_channel *a,
+                                               const struct mmwlan_s1g_channel *b)
+{
+    uint32_t sep_hz = (a->centre_freq_hz > b->centre_freq_hz) ?
+                          (a->centre_freq_hz - b->centre_freq_hz) :
+                          (b->centre_freq_hz - a->centre_freq_hz);
+    return (2 * sep_hz) < ((uint32_t)a->bw_mhz + b->bw_mhz) * 1000000;
+}
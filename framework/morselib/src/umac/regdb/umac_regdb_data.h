@@ -0,0 +1,22 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ */
+
+#pragma once
+
+#include "mmwlan.h"
+
+
+#define UMAC_REGDB_INDEX_MAX_CHANNELS (64)
+
+
+struct umac_regdb_data
+{
+
+    const struct mmwlan_s1g_channel_list *indexed_list;
+
+    uint8_t by_chan_num[UMAC_REGDB_INDEX_MAX_CHANNELS];
+
+    uint8_t by_freq[UMAC_REGDB_INDEX_MAX_CHANNELS];
+};
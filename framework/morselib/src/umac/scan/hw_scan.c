@@ -132,75 +132,125 @@ static uint32_t hw_scan_pack_channel(const struct mmwlan_s1g_channel *channel, u
     return packed_channel;
 }
 
-static void hw_scan_construct_channel_list_tlv(struct umac_data *umacd, struct consbuf *cbuf)
+static uint32_t hw_scan_power_list_index(struct umac_data *umacd,
+                                         uint32_t current_channel_index,
+                                         const struct mmwlan_s1g_channel *s1g_channel)
 {
-    MM_UNUSED(umacd);
-
-    uint32_t offset_at_start = cbuf->offset;
-    struct hw_scan_tlv_channel_list *channel_list_tlv =
-        (struct hw_scan_tlv_channel_list *)consbuf_reserve(cbuf, sizeof(*channel_list_tlv));
+    uint32_t index;
+    uint32_t sub_index;
+    uint32_t unique_index = 0;
 
-    uint32_t current_channel_index = 0;
-    const struct mmwlan_s1g_channel *s1g_channel;
-    for (current_channel_index = 0;
-         (s1g_channel = umac_regdb_get_channel_at_index(umacd, current_channel_index));
-         current_channel_index++)
+    for (index = 0; index < current_channel_index; index++)
     {
+        const struct mmwlan_s1g_channel *channel_at_index =
+            umac_regdb_get_channel_at_index(umacd, index);
 
-        if (s1g_channel->bw_mhz <= 2)
+
+        if (channel_at_index->bw_mhz > 2)
         {
-            uint32_t index;
-            uint32_t sub_index;
-            uint32_t unique_index = 0;
+            continue;
+        }
 
-            for (index = 0; index < current_channel_index; index++)
+        if (channel_at_index->max_tx_eirp_dbm == s1g_channel->max_tx_eirp_dbm)
+        {
+
+            break;
+        }
+
+
+        for (sub_index = 0; sub_index < index; sub_index++)
+        {
+            const struct mmwlan_s1g_channel *channel_at_sub_index =
+                umac_regdb_get_channel_at_index(umacd, sub_index);
+
+
+            if (channel_at_sub_index->bw_mhz > 2)
             {
-                const struct mmwlan_s1g_channel *channel_at_index =
-                    umac_regdb_get_channel_at_index(umacd, index);
+                continue;
+            }
 
+            if (channel_at_index->max_tx_eirp_dbm == channel_at_sub_index->max_tx_eirp_dbm)
+            {
 
-                if (channel_at_index->bw_mhz > 2)
-                {
-                    continue;
-                }
+                break;
+            }
+        }
 
-                if (channel_at_index->max_tx_eirp_dbm == s1g_channel->max_tx_eirp_dbm)
-                {
+        if (sub_index == index)
+        {
 
-                    break;
-                }
+            unique_index++;
+        }
+    }
 
+    return unique_index;
+}
 
-                for (sub_index = 0; sub_index < index; sub_index++)
-                {
-                    const struct mmwlan_s1g_channel *channel_at_sub_index =
-                        umac_regdb_get_channel_at_index(umacd, sub_index);
+static bool hw_scan_channel_is_requested(struct umac_data *umacd,
+                                         const struct mmwlan_scan_args *scan_args,
+                                         const struct mmwlan_s1g_channel *s1g_channel)
+{
+    unsigned ii;
 
+    if (scan_args->num_channels == 0)
+    {
+        return true;
+    }
 
-                    if (channel_at_sub_index->bw_mhz > 2)
-                    {
-                        continue;
-                    }
+    for (ii = 0; ii < scan_args->num_channels; ii++)
+    {
+        const struct mmwlan_s1g_channel *requested =
+            umac_regdb_get_channel(umacd, scan_args->channels[ii]);
+        if (requested != NULL && umac_regdb_channels_overlap(requested, s1g_channel))
+        {
+            return true;
+        }
+    }
 
-                    if (channel_at_index->max_tx_eirp_dbm == channel_at_sub_index->max_tx_eirp_dbm)
-                    {
+    return false;
+}
 
-                        break;
-                    }
-                }
+static void hw_scan_construct_channel_list_tlv(struct umac_data *umacd,
+                                               struct consbuf *cbuf,
+                                               const struct mmwlan_scan_args *scan_args)
+{
+    uint32_t offset_at_start = cbuf->offset;
+    struct hw_scan_tlv_channel_list *channel_list_tlv =
+        (struct hw_scan_tlv_channel_list *)consbuf_reserve(cbuf, sizeof(*channel_list_tlv));
 
-                if (sub_index == index)
-                {
 
-                    unique_index++;
-                }
+    unsigned pass;
+    for (pass = 0; pass < 2; pass++)
+    {
+        bool want_preferred = (pass == 0);
+        uint32_t current_channel_index = 0;
+        const struct mmwlan_s1g_channel *s1g_channel;
+        for (current_channel_index = 0;
+             (s1g_channel = umac_regdb_get_channel_at_index(umacd, current_channel_index));
+             current_channel_index++)
+        {
+
+            if (s1g_channel->bw_mhz > 2 ||
+                !hw_scan_channel_is_requested(umacd, scan_args, s1g_channel))
+            {
+                continue;
             }
 
+            bool preferred = umac_scan_bss_cache_contains(umacd,
+                                                          scan_args->ssid,
+                                                          scan_args->ssid_len,
+                                                          s1g_channel);
+            if (preferred != want_preferred)
+            {
+                continue;
+            }
 
+            uint32_t pwr_index =
+                hw_scan_power_list_index(umacd, current_channel_index, s1g_channel);
             uint32_t *channel_slot = (uint32_t *)consbuf_reserve(cbuf, sizeof(uint32_t));
             if (channel_slot)
             {
-                *channel_slot = htole32(hw_scan_pack_channel(s1g_channel, unique_index));
+                *channel_slot = htole32(hw_scan_pack_channel(s1g_channel, pwr_index));
             }
         }
     }
@@ -324,7 +374,7 @@ static void hw_scan_add_request_tlvs_to_cbuf(struct umac_data *umacd,
                                              struct consbuf *cbuf,
                                              const struct mmwlan_scan_args *scan_args)
 {
-    hw_scan_construct_channel_list_tlv(umacd, cbuf);
+    hw_scan_construct_channel_list_tlv(umacd, cbuf, scan_args);
     hw_scan_construct_power_list_tlv(umacd, cbuf);
 
     if (scan_args->dwell_on_home_ms != 0)
@@ -516,7 +566,12 @@ static void hw_scan_fsm_scan_aborted(struct hw_scan_fsm_instance *inst,
     const struct umac_scan_req *active_req = data->active_scan_req;
     const struct umac_scan_req *pending_req = NULL;
 
-    MM_UNUSED(event);
+    if (data->hw_scan_data.stop_early && !data->hw_scan_data.abort_all)
+    {
+        hw_scan_fsm_scan_done(inst, event);
+        return;
+    }
+    data->hw_scan_data.stop_early = false;
 
     data->active_scan_req = NULL;
     if (data->hw_scan_data.abort_all)
@@ -547,6 +602,7 @@ static void hw_scan_fsm_scan_done(struct hw_scan_fsm_instance *inst, enum hw_sca
     MM_UNUSED(event);
 
     data->prev_scan_completion_time = mmosal_get_time_ms();
+    data->hw_scan_data.stop_early = false;
 
 
     if (data->hw_scan_data.abort_all)
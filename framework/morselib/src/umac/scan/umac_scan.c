@@ -194,6 +194,87 @@ void umac_scan_fill_result(struct mmwlan_scan_result *res, const struct umac_sca
     PACK_LE64(res->tsf, rsp->frame.timestamp);
 }
 
+static uint32_t umac_scan_bss_cache_entry_age(const struct umac_scan_bss_cache_entry *entry,
+                                              uint32_t now_ms)
+{
+    if (mm_mac_addr_is_zero(entry->bssid))
+    {
+        return UINT32_MAX;
+    }
+    return now_ms - entry->last_seen_ms;
+}
+
+static void umac_scan_bss_cache_update(struct umac_scan_data *data,
+                                       const struct frame_data_probe_response *frame,
+                                       const struct mmwlan_s1g_channel *channel)
+{
+    uint32_t now_ms = mmosal_get_time_ms();
+    struct umac_scan_bss_cache_entry *slot = NULL;
+    unsigned ii;
+
+    for (ii = 0; ii < UMAC_SCAN_BSS_CACHE_SIZE; ii++)
+    {
+        struct umac_scan_bss_cache_entry *entry = &data->bss_cache[ii];
+        if (mm_mac_addr_is_equal(entry->bssid, frame->bssid))
+        {
+            slot = entry;
+            break;
+        }
+
+        if (slot == NULL ||
+            umac_scan_bss_cache_entry_age(entry, now_ms) >
+                umac_scan_bss_cache_entry_age(slot, now_ms))
+        {
+            slot = entry;
+        }
+    }
+
+    mac_addr_copy(slot->bssid, frame->bssid);
+    slot->ssid_len = MM_MIN(frame->ssid_len, sizeof(slot->ssid));
+    memcpy(slot->ssid, frame->ssid, slot->ssid_len);
+    slot->s1g_chan_num = channel->s1g_chan_num;
+    slot->last_seen_ms = now_ms;
+}
+
+bool umac_scan_bss_cache_contains(struct umac_data *umacd,
+                                  const uint8_t *ssid,
+                                  uint16_t ssid_len,
+                                  const struct mmwlan_s1g_channel *channel)
+{
+    struct umac_scan_data *data = umac_data_get_scan(umacd);
+    uint32_t now_ms = mmosal_get_time_ms();
+    unsigned ii;
+
+    if (ssid_len == 0)
+    {
+        return false;
+    }
+
+    for (ii = 0; ii < UMAC_SCAN_BSS_CACHE_SIZE; ii++)
+    {
+        struct umac_scan_bss_cache_entry *entry = &data->bss_cache[ii];
+        if (umac_scan_bss_cache_entry_age(entry, now_ms) >= UMAC_SCAN_BSS_CACHE_MAX_AGE_MS)
+        {
+            memset(entry, 0, sizeof(*entry));
+            continue;
+        }
+
+        if (entry->ssid_len != ssid_len || memcmp(entry->ssid, ssid, ssid_len) != 0)
+        {
+            continue;
+        }
+
+        const struct mmwlan_s1g_channel *cached_channel =
+            umac_regdb_get_channel(umacd, entry->s1g_chan_num);
+        if (cached_channel != NULL && umac_regdb_channels_overlap(cached_channel, channel))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void umac_scan_process_probe_resp(struct umac_data *umacd, struct mmpktview *rxbufview)
 {
     struct umac_scan_data *data = umac_data_get_scan(umacd);
@@ -215,14 +296,15 @@ void umac_scan_process_probe_resp(struct umac_data *umacd, struct mmpktview *rxb
     const struct dot11_ie_s1g_operation *s1g_op =
         ie_s1g_operation_find(rsp.frame.ies, rsp.frame.ies_len);
     const struct mmwlan_s1g_channel *matched_channel =
-        umac_regdb_get_channel(umacd, s1g_op->channel_center_freq);
+        umac_regdb_get_channel_for_op_class(umacd,
+                                            s1g_op->channel_center_freq,
+                                            s1g_op->operating_class);
 
     MMLOG_VRB("Probe response recieved (op_class: %d, centre_freq: %d, prim_chan_num: %d)\n",
               s1g_op->operating_class,
               s1g_op->channel_center_freq,
               s1g_op->primary_channel_number);
-    if (matched_channel == NULL ||
-        !umac_regdb_op_class_match(umacd, s1g_op->operating_class, matched_channel))
+    if (matched_channel == NULL)
     {
         MMLOG_WRN("Ignoring probe response: channel not in reg db "
                   "(op_class: %d, centre_freq: %d, prim_chan_num: %d)\n",
@@ -240,5 +322,19 @@ void umac_scan_process_probe_resp(struct umac_data *umacd, struct mmpktview *rxb
     rsp.channel_freq_hz = rx_metadata->freq_100khz * 100 * 1000;
     rsp.noise_dbm = rx_metadata->noise_dbm;
 
-    data->active_scan_req->rx_cb(umacd, &rsp);
+    umac_scan_bss_cache_update(data, &rsp.frame, matched_channel);
+
+    const struct umac_scan_req *scan_req = data->active_scan_req;
+    scan_req->rx_cb(umacd, &rsp);
+
+    if (scan_req->args.stop_on_ssid_match && scan_req->args.ssid_len != 0 &&
+        scan_req->args.ssid_len == rsp.frame.ssid_len &&
+        memcmp(scan_req->args.ssid, rsp.frame.ssid, rsp.frame.ssid_len) == 0 &&
+        data->active_scan_req == scan_req && !data->hw_scan_data.stop_early &&
+        data->hw_scan_data.fsm_inst.current_state == HW_SCAN_FSM_STATE_IN_PROGRESS)
+    {
+        MMLOG_INF("Target SSID found, stopping scan\n");
+        data->hw_scan_data.stop_early = true;
+        umac_scan_handle_event(data, UMAC_SCAN_EVENT_ABORT_ACTIVE);
+    }
 }
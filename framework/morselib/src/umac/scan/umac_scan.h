@@ -80,6 +80,12 @@ void umac_scan_process_probe_resp(struct umac_data *umacd, struct mmpktview *rxb
 void umac_scan_fill_result(struct mmwlan_scan_result *res, const struct umac_scan_response *rsp);
 
 
+bool umac_scan_bss_cache_contains(struct umac_data *umacd,
+                                  const uint8_t *ssid,
+                                  uint16_t ssid_len,
+                                  const struct mmwlan_s1g_channel *channel);
+
+
 enum mmwlan_status umac_scan_queue_request(struct umac_data *umacd, struct umac_scan_req *scan_req);
 
 
@@ -14,6 +14,29 @@ struct hw_scan_data
     struct hw_scan_fsm_instance fsm_inst;
 
     bool abort_all;
+
+    bool stop_early;
+};
+
+
+#define UMAC_SCAN_BSS_CACHE_SIZE (8)
+
+
+#define UMAC_SCAN_BSS_CACHE_MAX_AGE_MS (10 * 60 * 1000)
+
+
+struct umac_scan_bss_cache_entry
+{
+
+    uint32_t last_seen_ms;
+
+    uint8_t bssid[MMWLAN_MAC_ADDR_LEN];
+
+    uint8_t ssid[MMWLAN_SSID_MAXLEN];
+
+    uint8_t ssid_len;
+
+    uint8_t s1g_chan_num;
 };
 
 struct umac_scan_data
@@ -26,4 +49,6 @@ struct umac_scan_data
     uint32_t prev_scan_completion_time;
 
     struct hw_scan_data hw_scan_data;
+
+    struct umac_scan_bss_cache_entry bss_cache[UMAC_SCAN_BSS_CACHE_SIZE];
 };
@@ -23,7 +23,10 @@ void umac_stats_dump(struct umac_data *umacd)
 #else
     struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
     MMLOG_APP("Stats: %lu %lu %lu [ %lu %lu %lu %lu %lu %lu %lu %lu %lu %lu ] %d %u %u %u %u %u "
-              "%lu %lu %lu %u %lu %lu %lu %lu %lu %lu %lu %lu\n",
+              "%lu %lu %lu %u %lu %lu %lu %lu %lu %lu %lu %lu %lu %lu "
+              "[ %lu %lu %lu %lu %lu ] [ %lu %lu %lu %lu %lu ] "
+              "[ %lu %lu %lu %lu %lu ] [ %lu %lu %lu %lu %lu ] %lu %lu "
+              "[ %lu %lu %lu %lu ] [ %lu %lu %lu %lu ] %lu %lu %lu %lu %lu %lu %lu\n",
               data->last_tx_time,
               data->datapath_rxq_frames_dropped,
               data->datapath_txq_frames_dropped,
@@ -54,7 +57,46 @@ void umac_stats_dump(struct umac_data *umacd)
               data->datapath_rx_reorder_total,
               data->timeouts_fired,
               data->datapath_driver_tx_skbq_timeout,
-              data->datapath_driver_tx_pending_status_timeout);
+              data->datapath_driver_tx_pending_status_timeout,
+              data->datapath_driver_rx_packets,
+              data->datapath_driver_rx_read_transactions,
+              data->ps_awake_ms_by_reason[0],
+              data->ps_awake_ms_by_reason[1],
+              data->ps_awake_ms_by_reason[2],
+              data->ps_awake_ms_by_reason[3],
+              data->ps_awake_ms_by_reason[4],
+              data->ps_wake_count_by_reason[0],
+              data->ps_wake_count_by_reason[1],
+              data->ps_wake_count_by_reason[2],
+              data->ps_wake_count_by_reason[3],
+              data->ps_wake_count_by_reason[4],
+              data->ps_awake_ms_by_waker[0],
+              data->ps_awake_ms_by_waker[1],
+              data->ps_awake_ms_by_waker[2],
+              data->ps_awake_ms_by_waker[3],
+              data->ps_awake_ms_by_waker[4],
+              data->ps_wake_count_by_waker[0],
+              data->ps_wake_count_by_waker[1],
+              data->ps_wake_count_by_waker[2],
+              data->ps_wake_count_by_waker[3],
+              data->ps_wake_count_by_waker[4],
+              data->driver_task_busy_ms,
+              data->datapath_rx_defrag_bytes_high_water_mark,
+              data->datapath_txq_frames_queued_by_ac[0],
+              data->datapath_txq_frames_queued_by_ac[1],
+              data->datapath_txq_frames_queued_by_ac[2],
+              data->datapath_txq_frames_queued_by_ac[3],
+              data->datapath_txq_frames_dropped_by_ac[0],
+              data->datapath_txq_frames_dropped_by_ac[1],
+              data->datapath_txq_frames_dropped_by_ac[2],
+              data->datapath_txq_frames_dropped_by_ac[3],
+              data->datapath_txq_ps_frames_dropped,
+              data->datapath_txq_ps_frames_expired,
+              data->datapath_tx_airtime_deferrals,
+              data->datapath_txq_airtime_frames_dropped,
+              data->datapath_rx_intra_bss_forwarded,
+              data->datapath_rx_intra_bss_isolated,
+              data->datapath_rx_intra_bss_dropped);
 #endif
 }
 
@@ -230,6 +272,108 @@ int umac_stats_serialise(struct umac_data *umacd, uint8_t *buf, size_t buf_size)
                           22,
                           (const uint8_t *)&data->datapath_driver_tx_pending_status_timeout,
                           sizeof(data->datapath_driver_tx_pending_status_timeout));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          23,
+                          (const uint8_t *)&data->datapath_driver_rx_packets,
+                          sizeof(data->datapath_driver_rx_packets));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          24,
+                          (const uint8_t *)&data->datapath_driver_rx_read_transactions,
+                          sizeof(data->datapath_driver_rx_read_transactions));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          25,
+                          (const uint8_t *)data->ps_awake_ms_by_reason,
+                          sizeof(data->ps_awake_ms_by_reason));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          26,
+                          (const uint8_t *)data->ps_wake_count_by_reason,
+                          sizeof(data->ps_wake_count_by_reason));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          27,
+                          (const uint8_t *)data->ps_awake_ms_by_waker,
+                          sizeof(data->ps_awake_ms_by_waker));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          28,
+                          (const uint8_t *)data->ps_wake_count_by_waker,
+                          sizeof(data->ps_wake_count_by_waker));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          29,
+                          (const uint8_t *)&data->driver_task_busy_ms,
+                          sizeof(data->driver_task_busy_ms));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          30,
+                          (const uint8_t *)&data->datapath_rx_defrag_bytes_high_water_mark,
+                          sizeof(data->datapath_rx_defrag_bytes_high_water_mark));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          31,
+                          (const uint8_t *)data->datapath_txq_frames_queued_by_ac,
+                          sizeof(data->datapath_txq_frames_queued_by_ac));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          32,
+                          (const uint8_t *)data->datapath_txq_frames_dropped_by_ac,
+                          sizeof(data->datapath_txq_frames_dropped_by_ac));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          33,
+                          (const uint8_t *)&data->datapath_txq_ps_frames_dropped,
+                          sizeof(data->datapath_txq_ps_frames_dropped));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          34,
+                          (const uint8_t *)&data->datapath_txq_ps_frames_expired,
+                          sizeof(data->datapath_txq_ps_frames_expired));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          35,
+                          (const uint8_t *)&data->datapath_tx_airtime_deferrals,
+                          sizeof(data->datapath_tx_airtime_deferrals));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          36,
+                          (const uint8_t *)&data->datapath_txq_airtime_frames_dropped,
+                          sizeof(data->datapath_txq_airtime_frames_dropped));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          37,
+                          (const uint8_t *)&data->datapath_rx_intra_bss_forwarded,
+                          sizeof(data->datapath_rx_intra_bss_forwarded));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          38,
+                          (const uint8_t *)&data->datapath_rx_intra_bss_isolated,
+                          sizeof(data->datapath_rx_intra_bss_isolated));
+    ok = ok && append_tlv(buf,
+                          buf_size,
+                          &offset,
+                          39,
+                          (const uint8_t *)&data->datapath_rx_intra_bss_dropped,
+                          sizeof(data->datapath_rx_intra_bss_dropped));
     if (ok)
     {
         return offset;
@@ -706,3 +850,292 @@ void umac_stats_clear_datapath_driver_tx_pending_status_timeout(struct umac_data
 
     data->datapath_driver_tx_pending_status_timeout = 0;
 }
+
+void umac_stats_increment_datapath_driver_rx_packets(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_driver_rx_packets++;
+}
+
+uint32_t umac_stats_get_datapath_driver_rx_packets(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    return data->datapath_driver_rx_packets;
+}
+
+void umac_stats_clear_datapath_driver_rx_packets(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_driver_rx_packets = 0;
+}
+
+void umac_stats_increment_datapath_driver_rx_read_transactions(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_driver_rx_read_transactions++;
+}
+
+uint32_t umac_stats_get_datapath_driver_rx_read_transactions(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    return data->datapath_driver_rx_read_transactions;
+}
+
+void umac_stats_clear_datapath_driver_rx_read_transactions(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_driver_rx_read_transactions = 0;
+}
+
+void umac_stats_increment_ps_awake_ms_by_reason(struct umac_data *umacd,
+                                                uint32_t idx,
+                                                uint32_t step)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    MMOSAL_ASSERT(idx < MMWLAN_PS_WAKE_REASON_COUNT);
+
+    data->ps_awake_ms_by_reason[idx] += step;
+}
+
+void umac_stats_clear_ps_awake_ms_by_reason(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    memset(data->ps_awake_ms_by_reason, 0, sizeof(data->ps_awake_ms_by_reason));
+}
+
+void umac_stats_increment_ps_wake_count_by_reason(struct umac_data *umacd, uint32_t idx)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    MMOSAL_ASSERT(idx < MMWLAN_PS_WAKE_REASON_COUNT);
+
+    data->ps_wake_count_by_reason[idx]++;
+}
+
+void umac_stats_clear_ps_wake_count_by_reason(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    memset(data->ps_wake_count_by_reason, 0, sizeof(data->ps_wake_count_by_reason));
+}
+
+void umac_stats_increment_ps_awake_ms_by_waker(struct umac_data *umacd,
+                                               uint32_t idx,
+                                               uint32_t step)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    MMOSAL_ASSERT(idx < MMWLAN_STATS_PS_WAKER_N_ENTRIES);
+
+    data->ps_awake_ms_by_waker[idx] += step;
+}
+
+void umac_stats_clear_ps_awake_ms_by_waker(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    memset(data->ps_awake_ms_by_waker, 0, sizeof(data->ps_awake_ms_by_waker));
+}
+
+void umac_stats_increment_ps_wake_count_by_waker(struct umac_data *umacd, uint32_t idx)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    MMOSAL_ASSERT(idx < MMWLAN_STATS_PS_WAKER_N_ENTRIES);
+
+    data->ps_wake_count_by_waker[idx]++;
+}
+
+void umac_stats_clear_ps_wake_count_by_waker(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    memset(data->ps_wake_count_by_waker, 0, sizeof(data->ps_wake_count_by_waker));
+}
+
+void umac_stats_increment_driver_task_busy_ms(struct umac_data *umacd, uint32_t step)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->driver_task_busy_ms += step;
+}
+
+uint32_t umac_stats_get_driver_task_busy_ms(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    return data->driver_task_busy_ms;
+}
+
+void umac_stats_clear_driver_task_busy_ms(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->driver_task_busy_ms = 0;
+}
+
+void umac_stats_update_datapath_rx_defrag_bytes_high_water_mark(struct umac_data *umacd,
+                                                                uint32_t datapath_rx_defrag_bytes)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+    if (datapath_rx_defrag_bytes > data->datapath_rx_defrag_bytes_high_water_mark)
+    {
+        data->datapath_rx_defrag_bytes_high_water_mark = datapath_rx_defrag_bytes;
+    }
+}
+
+uint32_t umac_stats_get_datapath_rx_defrag_bytes_high_water_mark(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    return data->datapath_rx_defrag_bytes_high_water_mark;
+}
+
+void umac_stats_clear_datapath_rx_defrag_bytes_high_water_mark(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_rx_defrag_bytes_high_water_mark = 0;
+}
+
+void umac_stats_increment_datapath_txq_frames_queued_by_ac(struct umac_data *umacd, uint32_t idx)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    MMOSAL_ASSERT(idx < MMWLAN_STATS_AC_N_ENTRIES);
+
+    data->datapath_txq_frames_queued_by_ac[idx]++;
+}
+
+void umac_stats_clear_datapath_txq_frames_queued_by_ac(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    memset(data->datapath_txq_frames_queued_by_ac,
+           0,
+           sizeof(data->datapath_txq_frames_queued_by_ac));
+}
+
+void umac_stats_increment_datapath_txq_frames_dropped_by_ac(struct umac_data *umacd, uint32_t idx)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    MMOSAL_ASSERT(idx < MMWLAN_STATS_AC_N_ENTRIES);
+
+    data->datapath_txq_frames_dropped_by_ac[idx]++;
+}
+
+void umac_stats_clear_datapath_txq_frames_dropped_by_ac(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    memset(data->datapath_txq_frames_dropped_by_ac,
+           0,
+           sizeof(data->datapath_txq_frames_dropped_by_ac));
+}
+
+void umac_stats_increment_datapath_txq_ps_frames_dropped(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_txq_ps_frames_dropped++;
+}
+
+void umac_stats_clear_datapath_txq_ps_frames_dropped(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_txq_ps_frames_dropped = 0;
+}
+
+void umac_stats_increment_datapath_txq_ps_frames_expired(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_txq_ps_frames_expired++;
+}
+
+void umac_stats_clear_datapath_txq_ps_frames_expired(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_txq_ps_frames_expired = 0;
+}
+
+void umac_stats_increment_datapath_tx_airtime_deferrals(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_tx_airtime_deferrals++;
+}
+
+void umac_stats_clear_datapath_tx_airtime_deferrals(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_tx_airtime_deferrals = 0;
+}
+
+void umac_stats_increment_datapath_txq_airtime_frames_dropped(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_txq_airtime_frames_dropped++;
+}
+
+void umac_stats_clear_datapath_txq_airtime_frames_dropped(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_txq_airtime_frames_dropped = 0;
+}
+
+void umac_stats_increment_datapath_rx_intra_bss_forwarded(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_rx_intra_bss_forwarded++;
+}
+
+void umac_stats_clear_datapath_rx_intra_bss_forwarded(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_rx_intra_bss_forwarded = 0;
+}
+
+void umac_stats_increment_datapath_rx_intra_bss_isolated(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_rx_intra_bss_isolated++;
+}
+
+void umac_stats_clear_datapath_rx_intra_bss_isolated(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_rx_intra_bss_isolated = 0;
+}
+
+void umac_stats_increment_datapath_rx_intra_bss_dropped(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_rx_intra_bss_dropped++;
+}
+
+void umac_stats_clear_datapath_rx_intra_bss_dropped(struct umac_data *umacd)
+{
+    struct mmwlan_stats_umac_data *data = umac_data_get_stats(umacd);
+
+    data->datapath_rx_intra_bss_dropped = 0;
+}
@@ -225,3 +225,121 @@ uint32_t umac_stats_get_datapath_driver_tx_pending_status_timeout(struct umac_da
 
 void umac_stats_clear_datapath_driver_tx_pending_status_timeout(struct umac_data *umacd);
 
+
+void umac_stats_increment_datapath_driver_rx_packets(struct umac_data *umacd);
+
+
+uint32_t umac_stats_get_datapath_driver_rx_packets(struct umac_data *umacd);
+
+
+void umac_stats_clear_datapath_driver_rx_packets(struct umac_data *umacd);
+
+
+void umac_stats_increment_datapath_driver_rx_read_transactions(struct umac_data *umacd);
+
+
+uint32_t umac_stats_get_datapath_driver_rx_read_transactions(struct umac_data *umacd);
+
+
+void umac_stats_clear_datapath_driver_rx_read_transactions(struct umac_data *umacd);
+
+
+void umac_stats_increment_ps_awake_ms_by_reason(struct umac_data *umacd,
+                                                uint32_t idx,
+                                                uint32_t step);
+
+
+void umac_stats_clear_ps_awake_ms_by_reason(struct umac_data *umacd);
+
+
+void umac_stats_increment_ps_wake_count_by_reason(struct umac_data *umacd, uint32_t idx);
+
+
+void umac_stats_clear_ps_wake_count_by_reason(struct umac_data *umacd);
+
+
+void umac_stats_increment_ps_awake_ms_by_waker(struct umac_data *umacd,
+                                               uint32_t idx,
+                                               uint32_t step);
+
+
+void umac_stats_clear_ps_awake_ms_by_waker(struct umac_data *umacd);
+
+
+void umac_stats_increment_ps_wake_count_by_waker(struct umac_data *umacd, uint32_t idx);
+
+
+void umac_stats_clear_ps_wake_count_by_waker(struct umac_data *umacd);
+
+
+void umac_stats_increment_driver_task_busy_ms(struct umac_data *umacd, uint32_t step);
+
+
+uint32_t umac_stats_get_driver_task_busy_ms(struct umac_data *umacd);
+
+
+void umac_stats_clear_driver_task_busy_ms(struct umac_data *umacd);
+
+
+void umac_stats_update_datapath_rx_defrag_bytes_high_water_mark(struct umac_data *umacd,
+                                                                uint32_t datapath_rx_defrag_bytes);
+
+
+uint32_t umac_stats_get_datapath_rx_defrag_bytes_high_water_mark(struct umac_data *umacd);
+
+
+void umac_stats_clear_datapath_rx_defrag_bytes_high_water_mark(struct umac_data *umacd);
+
+
+void umac_stats_increment_datapath_txq_frames_queued_by_ac(struct umac_data *umacd, uint32_t idx);
+
+
+void umac_stats_clear_datapath_txq_frames_queued_by_ac(struct umac_data *umacd);
+
+
+void umac_stats_increment_datapath_txq_frames_dropped_by_ac(struct umac_data *umacd, uint32_t idx);
+
+
+void umac_stats_clear_datapath_txq_frames_dropped_by_ac(struct umac_data *umacd);
+
+
+void umac_stats_increment_datapath_txq_ps_frames_dropped(struct umac_data *umacd);
+
+
+void umac_stats_clear_datapath_txq_ps_frames_dropped(struct umac_data *umacd);
+
+
+void umac_stats_increment_datapath_txq_ps_frames_expired(struct umac_data *umacd);
+
+
+void umac_stats_clear_datapath_txq_ps_frames_expired(struct umac_data *umacd);
+
+
+void umac_stats_increment_datapath_tx_airtime_deferrals(struct umac_data *umacd);
+
+
+void umac_stats_clear_datapath_tx_airtime_deferrals(struct umac_data *umacd);
+
+
+void umac_stats_increment_datapath_txq_airtime_frames_dropped(struct umac_data *umacd);
+
+
+void umac_stats_clear_datapath_txq_airtime_frames_dropped(struct umac_data *umacd);
+
+
+void umac_stats_increment_datapath_rx_intra_bss_forwarded(struct umac_data *umacd);
+
+
+void umac_stats_clear_datapath_rx_intra_bss_forwarded(struct umac_data *umacd);
+
+
+void umac_stats_increment_datapath_rx_intra_bss_isolated(struct umac_data *umacd);
+
+
+void umac_stats_clear_datapath_rx_intra_bss_isolated(struct umac_data *umacd);
+
+
+void umac_stats_increment_datapath_rx_intra_bss_dropped(struct umac_data *umacd);
+
+
+void umac_stats_clear_datapath_rx_intra_bss_dropped(struct umac_data *umacd);
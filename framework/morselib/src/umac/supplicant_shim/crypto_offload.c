@@ -0,0 +1,202 @@
+/*
+ * Copyright 2026 Morse Micro
+ * SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-MorseMicroCommercial
+ *
+ * Worker task used to run long-running supplicant crypto operations (SAE, PMK and PT
+ * derivation) off the UMAC event loop so that it can keep servicing the datapath.
+ */
+
+#include "umac_supp_shim_private.h"
+
+#include "umac/core/umac_core.h"
+#include "umac/data/umac_data.h"
+
+#define CRYPTO_WORKER_PRIORITY (MMOSAL_TASK_PRI_NORM)
+#define CRYPTO_WORKER_STACK    (2152)
+
+#if !(defined(ENABLE_EXTERNAL_EVENT_LOOP) && ENABLE_EXTERNAL_EVENT_LOOP)
+static void crypto_worker_main(void *arg)
+{
+    struct umac_data *umacd = (struct umac_data *)arg;
+    struct umac_supp_crypto_worker *worker = &umac_data_get_supp_shim(umacd)->crypto;
+
+    while (mmosal_semb_wait(worker->job_semb, UINT32_MAX))
+    {
+        if (worker->shutting_down)
+        {
+            break;
+        }
+
+        worker->result = worker->fn(worker->arg);
+        worker->done = true;
+        umac_core_evt_wake(umacd);
+    }
+
+    worker->running = false;
+}
+
+#endif
+
+void umac_supp_crypto_worker_start(struct umac_data *umacd)
+{
+#if !(defined(ENABLE_EXTERNAL_EVENT_LOOP) && ENABLE_EXTERNAL_EVENT_LOOP)
+    struct umac_supp_crypto_worker *worker = &umac_data_get_supp_shim(umacd)->crypto;
+
+    if (worker->task != NULL)
+    {
+        return;
+    }
+
+    worker->job_semb = mmosal_semb_create("crypto");
+    if (worker->job_semb == NULL)
+    {
+        goto failure;
+    }
+
+    worker->shutting_down = false;
+    worker->running = true;
+    worker->task = mmosal_task_create(crypto_worker_main,
+                                      umacd,
+                                      CRYPTO_WORKER_PRIORITY,
+                                      CRYPTO_WORKER_STACK,
+                                      "crypto");
+    if (worker->task != NULL)
+    {
+        return;
+    }
+
+    worker->running = false;
+    mmosal_semb_delete(worker->job_semb);
+    worker->job_semb = NULL;
+
+failure:
+    MMLOG_INF("Crypto worker unavailable, running crypto on event loop\n");
+#else
+    MM_UNUSED(umacd);
+#endif
+}
+
+static void crypto_offload_flush_deferred(struct umac_supp_crypto_worker *worker, bool deliver)
+{
+    struct umac_supp_deferred_l2 *entry;
+
+    while ((entry = worker->deferred_head) != NULL)
+    {
+        worker->deferred_head = entry->next;
+        if (worker->deferred_head == NULL)
+        {
+            worker->deferred_tail = NULL;
+        }
+
+        if (deliver && entry->l2->rx_callback != NULL)
+        {
+            entry->l2->rx_callback(entry->l2->rx_callback_ctx,
+                                   entry->src_addr,
+                                   entry->payload,
+                                   entry->len);
+        }
+        mmosal_free(entry);
+    }
+}
+
+static void crypto_offload_deliver_deferred(void *arg1, void *arg2)
+{
+    struct umac_data *umacd = (struct umac_data *)arg1;
+    MM_UNUSED(arg2);
+
+    crypto_offload_flush_deferred(&umac_data_get_supp_shim(umacd)->crypto, true);
+}
+
+void umac_supp_crypto_worker_stop(struct umac_data *umacd)
+{
+    struct umac_supp_crypto_worker *worker = &umac_data_get_supp_shim(umacd)->crypto;
+
+    MMOSAL_ASSERT(!worker->busy);
+
+    if (worker->task != NULL)
+    {
+        worker->shutting_down = true;
+        mmosal_semb_give(worker->job_semb);
+        while (worker->running)
+        {
+            mmosal_task_sleep(1);
+        }
+        mmosal_semb_delete(worker->job_semb);
+        worker->job_semb = NULL;
+        worker->task = NULL;
+    }
+
+    umac_core_cancel_timeout(umacd, crypto_offload_deliver_deferred, umacd, NULL);
+    crypto_offload_flush_deferred(worker, false);
+}
+
+bool umac_supp_crypto_defer_l2(struct umac_data *umacd,
+                               struct l2_packet_data *l2,
+                               const uint8_t *payload,
+                               size_t payload_len,
+                               const uint8_t *src_addr)
+{
+    struct umac_supp_crypto_worker *worker = &umac_data_get_supp_shim(umacd)->crypto;
+    struct umac_supp_deferred_l2 *entry;
+
+    if (!worker->busy)
+    {
+        return false;
+    }
+
+    entry = (struct umac_supp_deferred_l2 *)mmosal_malloc(sizeof(*entry) + payload_len);
+    if (entry == NULL)
+    {
+        MMLOG_WRN("Dropping EAPOL frame received during crypto operation\n");
+        return true;
+    }
+
+    entry->next = NULL;
+    entry->l2 = l2;
+    mac_addr_copy(entry->src_addr, src_addr);
+    entry->len = payload_len;
+    memcpy(entry->payload, payload, payload_len);
+
+    if (worker->deferred_tail == NULL)
+    {
+        worker->deferred_head = entry;
+    }
+    else
+    {
+        worker->deferred_tail->next = entry;
+    }
+    worker->deferred_tail = entry;
+
+    return true;
+}
+
+int crypto_offload_run(int (*fn)(void *arg), void *arg)
+{
+    struct umac_data *umacd = umac_data_get_umacd();
+    struct umac_supp_crypto_worker *worker = &umac_data_get_supp_shim(umacd)->crypto;
+
+    if (worker->task == NULL || worker->busy || !umac_core_evtloop_is_active(umacd))
+    {
+        return fn(arg);
+    }
+
+    worker->fn = fn;
+    worker->arg = arg;
+    worker->done = false;
+    worker->busy = true;
+    mmosal_semb_give(worker->job_semb);
+
+    umac_core_service_datapath_until(umacd, &worker->done);
+
+    worker->busy = false;
+
+    if (worker->deferred_head != NULL &&
+        !umac_core_is_timeout_registered(umacd, crypto_offload_deliver_deferred, umacd, NULL) &&
+        !umac_core_register_timeout(umacd, 0, crypto_offload_deliver_deferred, umacd, NULL))
+    {
+        MMLOG_WRN("Failed to schedule delivery of deferred EAPOL frames\n");
+        crypto_offload_flush_deferred(worker, false);
+    }
+
+    return worker->result;
+}
@@ -511,6 +511,7 @@ static int mmwpas_sta_add(void *priv, struct hostapd_sta_add_params *params)
 
     struct umac_ap_sta_info sta_info = {
         .sta_state = wpa_sta_flags_to_sta_state(params->flags),
+        .listen_interval = params->listen_interval,
     };
     memcpy(sta_info.mac_addr, params->addr, MMWLAN_MAC_ADDR_LEN);
     enum mmwlan_status status = umac_ap_add_sta(umacd, params->aid, &sta_info);
@@ -60,6 +60,8 @@ enum mmwlan_status umac_supp_start_supp(struct umac_data *umacd)
     wpa_supplicant_run(data->global);
     data->is_started = true;
 
+    umac_supp_crypto_worker_start(umacd);
+
     return MMWLAN_SUCCESS;
 
 out:
@@ -225,6 +227,7 @@ void umac_supp_deinit(struct umac_data *umacd)
     {
         wpa_supplicant_deinit(data->global);
     }
+    umac_supp_crypto_worker_stop(umacd);
     data->sta_wpa_s = NULL;
     data->ap_wpa_s = NULL;
     data->global = NULL;
@@ -258,6 +261,11 @@ void umac_supp_l2_sock_receive(struct umac_data *umacd,
         return;
     }
 
+    if (umac_supp_crypto_defer_l2(umacd, &data->l2, payload, payload_len, src_addr))
+    {
+        return;
+    }
+
     data->l2.rx_callback(data->l2.rx_callback_ctx, src_addr, payload, payload_len);
 }
 
@@ -274,6 +282,11 @@ void umac_supp_l2_sock_receive_ap(struct umac_data *umacd,
         return;
     }
 
+    if (umac_supp_crypto_defer_l2(umacd, &data->l2_ap, payload, payload_len, src_addr))
+    {
+        return;
+    }
+
     data->l2_ap.rx_callback(data->l2_ap.rx_callback_ctx, src_addr, payload, payload_len);
 }
 
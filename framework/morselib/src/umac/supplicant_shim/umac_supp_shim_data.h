@@ -60,6 +60,35 @@ struct bss_cache
     (sizeof(struct bss_cache) + sizeof(struct bss_cache_entry) * (_num_entries))
 
 
+struct umac_supp_deferred_l2
+{
+    struct umac_supp_deferred_l2 *next;
+    struct l2_packet_data *l2;
+    uint8_t src_addr[ETH_ALEN];
+    size_t len;
+    uint8_t payload[];
+};
+
+
+struct umac_supp_crypto_worker
+{
+    struct mmosal_task *task;
+    struct mmosal_semb *job_semb;
+
+    int (*fn)(void *arg);
+    void *arg;
+    int result;
+
+    bool busy;
+    volatile bool done;
+    volatile bool running;
+    volatile bool shutting_down;
+
+    struct umac_supp_deferred_l2 *deferred_head;
+    struct umac_supp_deferred_l2 *deferred_tail;
+};
+
+
 struct umac_supp_config_entry
 {
 
@@ -104,4 +133,6 @@ struct umac_supp_shim_data
 #pragma GCC diagnostic pop
 
     uint8_t num_filter_ssids;
+
+    struct umac_supp_crypto_worker crypto;
 };
@@ -72,3 +72,16 @@ enum mmwlan_status umac_supp_start_supp(struct umac_data *umacd);
 
 
 void umac_supp_event(void *ctx, enum wpa_event_type event, union wpa_event_data *data);
+
+
+void umac_supp_crypto_worker_start(struct umac_data *umacd);
+
+
+void umac_supp_crypto_worker_stop(struct umac_data *umacd);
+
+
+bool umac_supp_crypto_defer_l2(struct umac_data *umacd,
+                               struct l2_packet_data *l2,
+                               const uint8_t *payload,
+                               size_t payload_len,
+                               const uint8_t *src_addr);
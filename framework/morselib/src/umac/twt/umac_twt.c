@@ -318,6 +318,7 @@ enum mmwlan_status umac_twt_install_pending_agreements(struct umac_data *umacd,
                 return status;
             }
             agreement->state = UMAC_TWT_AGREEMENT_STATE_INSTALLED;
+            data->sp_anchor_ms = mmosal_get_time_ms();
         }
     }
 
@@ -347,3 +348,70 @@ const struct mmwlan_twt_config_args *umac_twt_get_config(struct umac_data *umacd
 
     return &data->twt_config;
 }
+
+
+static const struct umac_twt_agreement_data *umac_twt_get_installed_agreement(
+    struct umac_twt_data *data)
+{
+    int i;
+    for (i = 0; i < UMAC_TWT_NUM_AGREEMENTS; i++)
+    {
+        if (data->agreements[i].state == UMAC_TWT_AGREEMENT_STATE_INSTALLED)
+        {
+            return &data->agreements[i];
+        }
+    }
+
+    return NULL;
+}
+
+bool umac_twt_get_next_service_period(struct umac_data *umacd,
+                                      uint32_t now_ms,
+                                      uint32_t *sp_start_ms)
+{
+    struct umac_twt_data *data = umac_data_get_twt(umacd);
+    const struct umac_twt_agreement_data *agreement = umac_twt_get_installed_agreement(data);
+    if (agreement == NULL)
+    {
+        return false;
+    }
+
+    uint32_t interval_ms = MORSE_INT_CEIL(agreement->wake_interval_us, 1000);
+    uint32_t duration_ms =
+        MORSE_INT_CEIL(agreement->params.min_twt_dur * TWT_WAKE_DURATION_UNIT, 1000);
+    if (interval_ms == 0)
+    {
+        interval_ms = 1;
+    }
+
+    uint32_t offset_ms = (now_ms - data->sp_anchor_ms) % interval_ms;
+    if (offset_ms < duration_ms)
+    {
+
+        *sp_start_ms = now_ms;
+    }
+    else
+    {
+        *sp_start_ms = now_ms + interval_ms - offset_ms;
+    }
+    return true;
+}
+
+void umac_twt_align_service_period(struct umac_data *umacd)
+{
+    struct umac_twt_data *data = umac_data_get_twt(umacd);
+    const struct umac_twt_agreement_data *agreement = umac_twt_get_installed_agreement(data);
+    if (agreement == NULL)
+    {
+        return;
+    }
+
+    uint32_t now_ms = mmosal_get_time_ms();
+    uint32_t sp_start_ms;
+    bool ok = umac_twt_get_next_service_period(umacd, now_ms, &sp_start_ms);
+    if (ok && sp_start_ms != now_ms)
+    {
+
+        data->sp_anchor_ms = now_ms;
+    }
+}
@@ -145,3 +145,11 @@ enum mmwlan_status umac_twt_add_configuration(struct umac_data *umacd,
 const struct mmwlan_twt_config_args *umac_twt_get_config(struct umac_data *umacd);
 
 
+bool umac_twt_get_next_service_period(struct umac_data *umacd,
+                                      uint32_t now_ms,
+                                      uint32_t *sp_start_ms);
+
+
+void umac_twt_align_service_period(struct umac_data *umacd);
+
+
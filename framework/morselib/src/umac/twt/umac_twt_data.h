@@ -19,4 +19,6 @@ struct umac_twt_data
     struct umac_twt_agreement_data agreements[UMAC_TWT_NUM_AGREEMENTS];
 
     struct mmwlan_twt_config_args twt_config;
+
+    uint32_t sp_anchor_ms;
 };
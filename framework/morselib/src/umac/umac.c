@@ -23,6 +23,8 @@
 #include "umac/config/umac_config.h"
 #include "umac/connection/umac_connection.h"
 #include "umac/datapath/umac_datapath.h"
+#include "umac/datapath/datapath_airtime.h"
+#include "umac/datapath/datapath_twt_hold.h"
 #include "umac/health_check/umac_health_check.h"
 #include "umac/stats/umac_stats.h"
 #include "umac/rc/umac_rc.h"
@@ -98,6 +100,7 @@ enum mmwlan_status mmwlan_set_channel_list(const struct mmwlan_s1g_channel_list
     }
 
     umac_config_set_channel_list(umacd, channel_list);
+    umac_regdb_build_index(umacd);
 
     return MMWLAN_SUCCESS;
 }
@@ -157,6 +160,34 @@ enum mmwlan_status mmwlan_get_bcf_metadata(struct mmwlan_bcf_metadata *metadata)
     return mmdrv_get_bcf_metadata(metadata);
 }
 
+enum mmwlan_status mmwlan_set_fw_load_mode(enum mmwlan_fw_load_mode mode)
+{
+    switch (mode)
+    {
+        case MMWLAN_FW_LOAD_FULL:
+        case MMWLAN_FW_LOAD_SKIP_UNCHANGED:
+        case MMWLAN_FW_LOAD_VERIFY_ONLY:
+            break;
+
+        default:
+            return MMWLAN_INVALID_ARGUMENT;
+    }
+
+    mmdrv_set_fw_load_mode(mode);
+    return MMWLAN_SUCCESS;
+}
+
+enum mmwlan_status mmwlan_get_fw_load_stats(struct mmwlan_fw_load_stats *stats)
+{
+    if (stats == NULL)
+    {
+        return MMWLAN_INVALID_ARGUMENT;
+    }
+
+    mmdrv_get_fw_load_stats(stats);
+    return MMWLAN_SUCCESS;
+}
+
 enum mmwlan_status mmwlan_override_max_tx_power(uint16_t tx_power_dbm)
 {
     struct umac_data *umacd = umac_data_get_umacd();
@@ -292,6 +323,59 @@ enum mmwlan_status mmwlan_set_dynamic_ps_timeout(uint32_t timeout_ms)
     return status;
 }
 
+static void umac_set_adaptive_ps_evt_handler(struct umac_data *umacd, const struct umac_evt *evt)
+{
+    enum mmwlan_status status = mmdrv_set_adaptive_ps(evt->args.set_adaptive_ps.args);
+
+
+    if (status == MMWLAN_SUCCESS || status == MMWLAN_NOT_RUNNING)
+    {
+        umac_config_set_adaptive_ps(umacd, evt->args.set_adaptive_ps.args);
+        status = MMWLAN_SUCCESS;
+    }
+
+    *evt->args.set_adaptive_ps.status = status;
+    mmosal_semb_give(evt->args.set_adaptive_ps.semb);
+}
+
+enum mmwlan_status mmwlan_set_adaptive_ps(const struct mmwlan_adaptive_ps_args *args)
+{
+    struct umac_data *umacd = umac_data_get_umacd();
+
+    if (args == NULL || args->min_timeout_ms > args->max_timeout_ms)
+    {
+        return MMWLAN_INVALID_ARGUMENT;
+    }
+
+    if (!umac_data_is_initialised(umacd))
+    {
+        return MMWLAN_NOT_INITIALIZED;
+    }
+
+    if (!umac_core_is_running(umacd))
+    {
+        return MMWLAN_UNAVAILABLE;
+    }
+
+    enum mmwlan_status status = MMWLAN_ERROR;
+    UMAC_QUEUE_EVT_AND_WAIT(umac_set_adaptive_ps_evt_handler,
+                            set_adaptive_ps,
+                            &status,
+                            .args = args);
+
+    return status;
+}
+
+enum mmwlan_status mmwlan_get_adaptive_ps_stats(struct mmwlan_adaptive_ps_stats *stats)
+{
+    if (stats == NULL)
+    {
+        return MMWLAN_INVALID_ARGUMENT;
+    }
+
+    return mmdrv_get_adaptive_ps_stats(stats);
+}
+
 enum mmwlan_status mmwlan_set_ampdu_enabled(bool ampdu_enabled)
 {
     struct umac_data *umacd = umac_data_get_umacd();
@@ -866,6 +950,21 @@ enum mmwlan_status mmwlan_scan_request(const struct mmwlan_scan_req *scan_req)
         return MMWLAN_CHANNEL_LIST_NOT_SET;
     }
 
+    if (scan_req->args.num_channels > MMWLAN_SCAN_MAX_CHANNELS)
+    {
+        return MMWLAN_INVALID_ARGUMENT;
+    }
+
+    unsigned ii;
+    for (ii = 0; ii < scan_req->args.num_channels; ii++)
+    {
+        if (umac_regdb_get_channel(umacd, scan_req->args.channels[ii]) == NULL)
+        {
+            MMLOG_ERR("Scan channel %u not in channel list\n", scan_req->args.channels[ii]);
+            return MMWLAN_INVALID_ARGUMENT;
+        }
+    }
+
     enum mmwlan_status status = umac_core_start(umacd);
     if (status != MMWLAN_SUCCESS)
     {
@@ -894,6 +993,11 @@ enum mmwlan_status mmwlan_scan_request(const struct mmwlan_scan_req *scan_req)
     data->scan_request.args.dwell_on_home_ms =
         umac_connection_get_state(umacd) == MMWLAN_STA_CONNECTED ? scan_req->args.dwell_on_home_ms :
                                                                    0;
+    memcpy(data->scan_request.args.channels,
+           scan_req->args.channels,
+           sizeof(data->scan_request.args.channels));
+    data->scan_request.args.num_channels = scan_req->args.num_channels;
+    data->scan_request.args.stop_on_ssid_match = scan_req->args.stop_on_ssid_match;
     data->scan_request.args.extra_ies = NULL;
     data->scan_request.args.extra_ies_len = 0;
     if (scan_req->args.extra_ies_len)
@@ -1545,6 +1649,41 @@ enum mmwlan_status mmwlan_twt_add_configuration(
     return umac_twt_add_configuration(umacd, twt_config_args);
 }
 
+enum mmwlan_status mmwlan_twt_set_tx_hold(const struct mmwlan_twt_tx_hold_args *args)
+{
+    struct umac_data *umacd = umac_data_get_umacd();
+
+    if (!umac_data_is_initialised(umacd))
+    {
+        return MMWLAN_NOT_INITIALIZED;
+    }
+
+    if (args == NULL || (args->enabled && args->max_held_frames == 0))
+    {
+        return MMWLAN_INVALID_ARGUMENT;
+    }
+
+    umac_config_set_twt_tx_hold(umacd, args);
+    return MMWLAN_SUCCESS;
+}
+
+enum mmwlan_status mmwlan_twt_get_tx_hold_stats(struct mmwlan_twt_tx_hold_stats *stats)
+{
+    struct umac_data *umacd = umac_data_get_umacd();
+
+    if (!umac_data_is_initialised(umacd))
+    {
+        return MMWLAN_NOT_INITIALIZED;
+    }
+
+    if (stats == NULL)
+    {
+        return MMWLAN_INVALID_ARGUMENT;
+    }
+
+    return datapath_twt_hold_get_stats(umacd, stats);
+}
+
 static void umac_morse_stats_evt_handler(struct umac_data *umacd, const struct umac_evt *evt)
 {
     MM_UNUSED(umacd);
@@ -1699,7 +1838,13 @@ enum mmwlan_status mmwlan_get_duty_cycle_stats(struct mmwlan_duty_cycle_stats *s
         MMLOG_ERR("stats pointer is NULL\n");
         return MMWLAN_INVALID_ARGUMENT;
     }
-    return mmdrv_get_duty_cycle(stats);
+
+    enum mmwlan_status status = mmdrv_get_duty_cycle(stats);
+    if (status == MMWLAN_SUCCESS)
+    {
+        stats->airtime_budget_remaining_us = datapath_airtime_get_budget_us(umac_data_get_umacd());
+    }
+    return status;
 }
 
 
@@ -1757,6 +1902,26 @@ enum mmwlan_status mmwlan_ate_execute_command(uint8_t *command,
     return status;
 }
 
+enum mmwlan_status mmwlan_bus_benchmark(const struct mmwlan_bus_benchmark_args *args,
+                                        struct mmwlan_bus_benchmark_result *result)
+{
+    if (args == NULL || result == NULL)
+    {
+        return MMWLAN_INVALID_ARGUMENT;
+    }
+
+    if (args->pkt_len < MMWLAN_BUS_BENCHMARK_MIN_PKT_LEN ||
+        args->pkt_len > MMWLAN_BUS_BENCHMARK_MAX_PKT_LEN ||
+        args->batch_depth == 0 ||
+        args->batch_depth > MMWLAN_BUS_BENCHMARK_MAX_BATCH_DEPTH)
+    {
+        MMLOG_WRN("Invalid bus benchmark arguments\n");
+        return MMWLAN_INVALID_ARGUMENT;
+    }
+
+    return mmdrv_bus_benchmark(args, result);
+}
+
 enum mmwlan_status mmwlan_set_listen_interval(uint16_t interval)
 {
     struct umac_data *umacd = umac_data_get_umacd();
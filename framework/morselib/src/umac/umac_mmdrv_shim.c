@@ -225,6 +225,71 @@ void mmdrv_host_stats_increment_datapath_driver_rx_read_failures(void)
     umac_stats_increment_datapath_driver_rx_read_failures(umacd);
 }
 
+void mmdrv_host_stats_increment_datapath_driver_rx_packets(void)
+{
+    struct umac_data *umacd = umac_data_get_umacd();
+    umac_stats_increment_datapath_driver_rx_packets(umacd);
+}
+
+void mmdrv_host_stats_increment_datapath_driver_rx_read_transactions(void)
+{
+    struct umac_data *umacd = umac_data_get_umacd();
+    umac_stats_increment_datapath_driver_rx_read_transactions(umacd);
+}
+
+void mmdrv_host_stats_add_ps_awake_time(uint32_t reasons, uint32_t wakers, uint32_t awake_ms)
+{
+    struct umac_data *umacd = umac_data_get_umacd();
+    uint32_t ii;
+
+    if (awake_ms == 0)
+    {
+        return;
+    }
+
+    for (ii = 0; ii < MMWLAN_PS_WAKE_REASON_COUNT; ii++)
+    {
+        if (reasons & (1ul << ii))
+        {
+            umac_stats_increment_ps_awake_ms_by_reason(umacd, ii, awake_ms);
+        }
+    }
+    for (ii = 0; ii < MMWLAN_STATS_PS_WAKER_N_ENTRIES; ii++)
+    {
+        if (wakers & (1ul << ii))
+        {
+            umac_stats_increment_ps_awake_ms_by_waker(umacd, ii, awake_ms);
+        }
+    }
+}
+
+void mmdrv_host_stats_increment_ps_wake_count(uint32_t reasons, uint32_t wakers)
+{
+    struct umac_data *umacd = umac_data_get_umacd();
+    uint32_t ii;
+
+    for (ii = 0; ii < MMWLAN_PS_WAKE_REASON_COUNT; ii++)
+    {
+        if (reasons & (1ul << ii))
+        {
+            umac_stats_increment_ps_wake_count_by_reason(umacd, ii);
+        }
+    }
+    for (ii = 0; ii < MMWLAN_STATS_PS_WAKER_N_ENTRIES; ii++)
+    {
+        if (wakers & (1ul << ii))
+        {
+            umac_stats_increment_ps_wake_count_by_waker(umacd, ii);
+        }
+    }
+}
+
+void mmdrv_host_stats_add_driver_task_busy_time(uint32_t busy_ms)
+{
+    struct umac_data *umacd = umac_data_get_umacd();
+    umac_stats_increment_driver_task_busy_ms(umacd, busy_ms);
+}
+
 void mmdrv_host_stats_increment_datapath_driver_tx_skbq_timeout(void)
 {
     struct umac_data *umacd = umac_data_get_umacd();
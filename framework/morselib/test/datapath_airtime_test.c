@@ -0,0 +1,297 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host test for the host-side airtime budget in datapath_airtime.c.
+ */
+
+#include <string.h>
+
+#include "mmwlan.h"
+#include "mmdrv.h"
+#include "umac/data/umac_data_private.h"
+#include "umac/core/umac_core.h"
+#include "umac/datapath/datapath_airtime.h"
+#include "umac/datapath/umac_datapath_private.h"
+#include "test_support.h"
+
+/** Duty cycle of 10 %, in hundredths of a percent, giving a 100 ms budget. */
+#define TEST_DUTY_CYCLE_10_PCT (1000)
+
+/** Duty cycle of 1 %, in hundredths of a percent, giving a 10 ms budget. */
+#define TEST_DUTY_CYCLE_1_PCT (100)
+
+/** Centre frequencies of two channels. */
+#define TEST_FREQ_A_HZ (902500000)
+#define TEST_FREQ_B_HZ (903500000)
+
+/** Voice frames are admitted without a reserve, which keeps the arithmetic simple. */
+#define TEST_TID_VO (6)
+
+/** Length of the test frames, which at the default rate cost 3266 us each. */
+#define TEST_FRAME_LEN (100)
+#define TEST_FRAME_COST_US (3266)
+
+/** Number of STAs that hold frames. */
+#define TEST_NUM_STAS (2)
+
+static struct umac_datapath_data test_datapath;
+static struct umac_sta_data test_stas[TEST_NUM_STAS];
+static struct mmwlan_duty_cycle_stats test_duty_cycle_stats;
+static unsigned test_frames_dropped;
+static unsigned test_deferrals;
+static bool test_paused;
+
+struct umac_datapath_data *umac_data_get_datapath(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    return &test_datapath;
+}
+
+enum mmwlan_status mmdrv_get_duty_cycle(struct mmwlan_duty_cycle_stats *stats)
+{
+    *stats = test_duty_cycle_stats;
+    return MMWLAN_SUCCESS;
+}
+
+void umac_core_evt_wake(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+}
+
+bool umac_core_register_timeout(struct umac_data *umacd,
+                                uint32_t delta_ms,
+                                umac_core_timeout_handler_t handler,
+                                void *arg1,
+                                void *arg2)
+{
+    MM_UNUSED(umacd);
+    MM_UNUSED(delta_ms);
+    MM_UNUSED(handler);
+    MM_UNUSED(arg1);
+    MM_UNUSED(arg2);
+    return true;
+}
+
+int umac_core_cancel_timeout(struct umac_data *umacd,
+                             umac_core_timeout_handler_t handler,
+                             void *arg1,
+                             void *arg2)
+{
+    MM_UNUSED(umacd);
+    MM_UNUSED(handler);
+    MM_UNUSED(arg1);
+    MM_UNUSED(arg2);
+    return 0;
+}
+
+void umac_datapath_pause(struct umac_data *umacd, uint16_t source_mask)
+{
+    MM_UNUSED(umacd);
+    MM_UNUSED(source_mask);
+    test_paused = true;
+}
+
+void umac_datapath_unpause(struct umac_data *umacd, uint16_t source_mask)
+{
+    MM_UNUSED(umacd);
+    MM_UNUSED(source_mask);
+    test_paused = false;
+}
+
+static struct umac_sta_data *test_lookup_stad_by_aid(struct umac_data *umacd, uint16_t aid)
+{
+    MM_UNUSED(umacd);
+    for (unsigned ii = 0; ii < TEST_NUM_STAS; ii++)
+    {
+        if (test_stas[ii].aid == aid)
+        {
+            return &test_stas[ii];
+        }
+    }
+    return NULL;
+}
+
+static const struct umac_datapath_ops test_datapath_ops = {
+    .lookup_stad_by_aid = test_lookup_stad_by_aid,
+};
+
+const struct umac_datapath_ops *umac_interface_get_datapath_ops_by_vif_id(struct umac_data *umacd,
+                                                                          uint16_t vif_id)
+{
+    MM_UNUSED(umacd);
+    MM_UNUSED(vif_id);
+    return &test_datapath_ops;
+}
+
+u32 mmrc_calculate_theoretical_throughput(struct mmrc_rate rate)
+{
+    MM_UNUSED(rate);
+    return 0;
+}
+
+void umac_stats_increment_datapath_tx_airtime_deferrals(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    test_deferrals++;
+}
+
+void umac_stats_increment_datapath_txq_airtime_frames_dropped(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+}
+
+void umac_stats_increment_datapath_txq_frames_dropped(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    test_frames_dropped++;
+}
+
+void umac_stats_increment_datapath_txq_frames_queued_by_ac(struct umac_data *umacd,
+                                                           enum dot11_aci aci)
+{
+    MM_UNUSED(umacd);
+    MM_UNUSED(aci);
+}
+
+static struct mmpkt *test_alloc_frame(struct umac_sta_data *stad)
+{
+    struct mmpkt *mmpkt =
+        mmpkt_alloc_on_heap(0, TEST_FRAME_LEN, sizeof(struct mmdrv_tx_metadata));
+    struct mmpktview *view = mmpkt_open(mmpkt);
+    memset(mmpkt_append(view, TEST_FRAME_LEN), 0, TEST_FRAME_LEN);
+    mmpkt_close(&view);
+
+    struct mmdrv_tx_metadata *tx_metadata = mmdrv_get_tx_metadata(mmpkt);
+    tx_metadata->tid = TEST_TID_VO;
+    tx_metadata->vif_id = stad->vif_id;
+    tx_metadata->aid = stad->aid;
+    return mmpkt;
+}
+
+static void test_reset(void)
+{
+    datapath_airtime_flush(NULL);
+    memset(&test_datapath, 0, sizeof(test_datapath));
+    memset(test_stas, 0, sizeof(test_stas));
+    memset(&test_duty_cycle_stats, 0, sizeof(test_duty_cycle_stats));
+    for (unsigned ii = 0; ii < TEST_NUM_STAS; ii++)
+    {
+        test_stas[ii].aid = ii + 1;
+    }
+    test_frames_dropped = 0;
+    test_deferrals = 0;
+    test_paused = false;
+    test_time_ms = 1000;
+}
+
+/** Admit a frame that is expected to go straight through, and release it. */
+static void test_admit_and_send(struct umac_sta_data *stad)
+{
+    struct mmpkt *mmpkt = test_alloc_frame(stad);
+    CHECK(datapath_airtime_admit(NULL, mmpkt));
+    mmpkt_release(mmpkt);
+}
+
+/* Setting the same channel again, as happens when the channel is reconfigured, keeps the budget
+ * that has been spent. Changing the channel or the duty cycle starts a new budget. */
+static void test_reseed(void)
+{
+    test_reset();
+
+    datapath_airtime_configure(NULL, TEST_DUTY_CYCLE_10_PCT, TEST_FREQ_A_HZ);
+    CHECK(datapath_airtime_get_budget_us(NULL) == 100000);
+    test_admit_and_send(&test_stas[0]);
+    test_admit_and_send(&test_stas[0]);
+    CHECK(datapath_airtime_get_budget_us(NULL) == 100000 - 2 * TEST_FRAME_COST_US);
+
+    datapath_airtime_configure(NULL, TEST_DUTY_CYCLE_10_PCT, TEST_FREQ_A_HZ);
+    CHECK(datapath_airtime_get_budget_us(NULL) == 100000 - 2 * TEST_FRAME_COST_US);
+
+    /* Credit earned before the reconfiguration is not lost. */
+    test_time_ms += 10;
+    datapath_airtime_configure(NULL, TEST_DUTY_CYCLE_10_PCT, TEST_FREQ_A_HZ);
+    CHECK(datapath_airtime_get_budget_us(NULL) == 100000 - 2 * TEST_FRAME_COST_US + 1000);
+
+    datapath_airtime_configure(NULL, TEST_DUTY_CYCLE_10_PCT, TEST_FREQ_B_HZ);
+    CHECK(datapath_airtime_get_budget_us(NULL) == 100000);
+
+    test_admit_and_send(&test_stas[0]);
+    datapath_airtime_configure(NULL, TEST_DUTY_CYCLE_1_PCT, TEST_FREQ_B_HZ);
+    CHECK(datapath_airtime_get_budget_us(NULL) == 10000);
+}
+
+/* If the capacity shrinks without a new budget, the budget is clamped to it. */
+static void test_clamp(void)
+{
+    test_reset();
+
+    test_duty_cycle_stats.mode = MMWLAN_DUTY_CYCLE_MODE_BURST;
+    test_duty_cycle_stats.burst_window_duration_us = 1000000;
+    test_duty_cycle_stats.burst_airtime_remaining_us = 100000;
+    datapath_airtime_configure(NULL, TEST_DUTY_CYCLE_10_PCT, TEST_FREQ_A_HZ);
+    CHECK(datapath_airtime_get_budget_us(NULL) == 100000);
+    test_admit_and_send(&test_stas[0]);
+
+    /* The budget reported by the chip is only used for a new budget. */
+    test_duty_cycle_stats.burst_airtime_remaining_us = 0;
+    datapath_airtime_configure(NULL, TEST_DUTY_CYCLE_10_PCT, TEST_FREQ_A_HZ);
+    CHECK(datapath_airtime_get_budget_us(NULL) == 100000 - TEST_FRAME_COST_US);
+
+    test_duty_cycle_stats.burst_window_duration_us = 500000;
+    datapath_airtime_configure(NULL, TEST_DUTY_CYCLE_10_PCT, TEST_FREQ_A_HZ);
+    CHECK(datapath_airtime_get_budget_us(NULL) == 50000);
+}
+
+/* Frames held for a STA are dropped when the STA is removed, so they do not go to a later STA
+ * that is given the same AID. */
+static void test_flush_stad(void)
+{
+    struct umac_sta_data *stad;
+    struct mmpkt *mmpkt;
+
+    test_reset();
+    datapath_airtime_configure(NULL, TEST_DUTY_CYCLE_1_PCT, TEST_FREQ_A_HZ);
+    for (unsigned ii = 0; ii < 10000 / TEST_FRAME_COST_US; ii++)
+    {
+        test_admit_and_send(&test_stas[0]);
+    }
+
+    CHECK(!datapath_airtime_admit(NULL, test_alloc_frame(&test_stas[0])));
+    CHECK(!datapath_airtime_admit(NULL, test_alloc_frame(&test_stas[1])));
+    CHECK(!datapath_airtime_admit(NULL, test_alloc_frame(&test_stas[0])));
+    CHECK(!datapath_airtime_admit(NULL, test_alloc_frame(&test_stas[0])));
+    CHECK(test_deferrals == 4);
+    CHECK(test_paused);
+
+    datapath_airtime_flush_stad(NULL, &test_stas[0]);
+    CHECK(test_frames_dropped == 3);
+    CHECK(!test_paused);
+
+    /* A new STA takes the AID of the one that was removed. */
+    test_stas[0].aid = 0;
+    test_time_ms += 1000;
+    mmpkt = datapath_airtime_dequeue_held(NULL, &stad);
+    CHECK(mmpkt != NULL && stad == &test_stas[1]);
+    mmpkt_release(mmpkt);
+    test_stas[0].aid = 1;
+    CHECK(datapath_airtime_dequeue_held(NULL, &stad) == NULL);
+    CHECK(test_frames_dropped == 3);
+
+    /* Removing a STA with nothing held drops nothing. */
+    datapath_airtime_flush_stad(NULL, &test_stas[1]);
+    CHECK(test_frames_dropped == 3);
+}
+
+int main(void)
+{
+    test_reseed();
+    test_clamp();
+    test_flush_stad();
+    test_reset();
+
+    return test_summary();
+}
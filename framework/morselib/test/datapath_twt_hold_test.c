@@ -0,0 +1,279 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host test for the TWT transmit hold in datapath_twt_hold.c.
+ */
+
+#include <string.h>
+
+#include "mmwlan.h"
+#include "mmdrv.h"
+#include "umac/core/umac_core.h"
+#include "umac/datapath/datapath_twt_hold.h"
+#include "umac/datapath/umac_datapath_data.h"
+#include "test_support.h"
+
+/** Interval between service periods, and the offset of the first one from time 0. */
+#define TEST_SP_INTERVAL_MS (100)
+#define TEST_SP_OFFSET_MS   (50)
+
+/** TIDs of a frame that may be held and of an urgent frame. */
+#define TEST_TID_BE (0)
+#define TEST_TID_VO (6)
+
+static struct umac_datapath_data test_datapath;
+static struct datapath_twt_hold_data test_hold;
+static struct mmwlan_twt_tx_hold_args test_args = MMWLAN_TWT_TX_HOLD_ARGS_INIT;
+static umac_core_timeout_handler_t test_timeout_handler;
+static void *test_timeout_arg1;
+static void *test_timeout_arg2;
+static uint32_t test_timeout_ms;
+static uint32_t test_next_seq;
+
+const struct mmwlan_twt_tx_hold_args *umac_config_get_twt_tx_hold(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    return &test_args;
+}
+
+struct umac_datapath_data *umac_data_get_datapath(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    return &test_datapath;
+}
+
+bool umac_twt_get_next_service_period(struct umac_data *umacd,
+                                      uint32_t now_ms,
+                                      uint32_t *sp_start_ms)
+{
+    MM_UNUSED(umacd);
+    uint32_t since_offset_ms = now_ms - TEST_SP_OFFSET_MS;
+    *sp_start_ms = now_ms + (TEST_SP_INTERVAL_MS - since_offset_ms % TEST_SP_INTERVAL_MS) %
+                                TEST_SP_INTERVAL_MS;
+    return true;
+}
+
+void umac_core_evt_wake(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+}
+
+bool umac_core_register_timeout(struct umac_data *umacd,
+                                uint32_t delta_ms,
+                                umac_core_timeout_handler_t handler,
+                                void *arg1,
+                                void *arg2)
+{
+    MM_UNUSED(umacd);
+    CHECK(test_timeout_handler == NULL);
+    test_timeout_handler = handler;
+    test_timeout_arg1 = arg1;
+    test_timeout_arg2 = arg2;
+    test_timeout_ms = test_time_ms + delta_ms;
+    return true;
+}
+
+int umac_core_cancel_timeout(struct umac_data *umacd,
+                             umac_core_timeout_handler_t handler,
+                             void *arg1,
+                             void *arg2)
+{
+    MM_UNUSED(umacd);
+    MM_UNUSED(arg1);
+    MM_UNUSED(arg2);
+    if (test_timeout_handler == NULL || test_timeout_handler != handler)
+    {
+        return 0;
+    }
+    test_timeout_handler = NULL;
+    return 1;
+}
+
+void umac_stats_increment_datapath_txq_frames_dropped(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+}
+
+static void test_reset(void)
+{
+    datapath_twt_hold_flush(NULL, &test_hold);
+    memset(&test_datapath, 0, sizeof(test_datapath));
+    memset(&test_hold, 0, sizeof(test_hold));
+    test_args = (struct mmwlan_twt_tx_hold_args)MMWLAN_TWT_TX_HOLD_ARGS_INIT;
+    test_args.enabled = true;
+    test_timeout_handler = NULL;
+    test_next_seq = 0;
+    test_time_ms = 1000;
+}
+
+/** Advance the time to the registered timeout and run it. */
+static void test_fire_timeout(void)
+{
+    umac_core_timeout_handler_t handler = test_timeout_handler;
+
+    CHECK(handler != NULL);
+    if (handler == NULL)
+    {
+        return;
+    }
+    test_timeout_handler = NULL;
+    test_time_ms = test_timeout_ms;
+    handler(test_timeout_arg1, test_timeout_arg2);
+}
+
+/** Pass a frame tagged with the next sequence number to the hold, which must keep it. */
+static void test_hold_frame(uint8_t tid)
+{
+    struct mmpkt *mmpkt = mmpkt_alloc_on_heap(0, sizeof(test_next_seq),
+                                              sizeof(struct mmdrv_tx_metadata));
+    struct mmpktview *view = mmpkt_open(mmpkt);
+    mmpkt_append_data(view, (const uint8_t *)&test_next_seq, sizeof(test_next_seq));
+    mmpkt_close(&view);
+    mmdrv_get_tx_metadata(mmpkt)->tid = tid;
+    test_next_seq++;
+
+    CHECK(datapath_twt_hold_frame(NULL, &test_hold, mmpkt));
+}
+
+/**
+ * Dequeue the released frames.
+ *
+ * @returns the number of frames dequeued, which must carry consecutive sequence numbers starting
+ *          from @p first_seq.
+ */
+static unsigned test_dequeue(uint32_t first_seq, unsigned max_frames)
+{
+    unsigned count = 0;
+    struct mmpkt *mmpkt;
+
+    while (count < max_frames && (mmpkt = datapath_twt_hold_dequeue(NULL, &test_hold)) != NULL)
+    {
+        uint32_t seq;
+        struct mmpktview *view = mmpkt_open(mmpkt);
+        memcpy(&seq, mmpkt_get_data_start(view), sizeof(seq));
+        mmpkt_close(&view);
+        mmpkt_release(mmpkt);
+
+        CHECK(seq == first_seq + count);
+        count++;
+    }
+    return count;
+}
+
+/* Frames are held until the next service period and then released in order. */
+static void test_hold_until_sp(void)
+{
+    test_reset();
+
+    test_hold_frame(TEST_TID_BE);
+    test_hold_frame(TEST_TID_BE);
+    test_hold_frame(TEST_TID_BE);
+    CHECK(!datapath_twt_hold_is_releasing(&test_hold));
+    CHECK(test_dequeue(0, UINT32_MAX) == 0);
+    CHECK(test_timeout_ms == 1050);
+
+    test_fire_timeout();
+    CHECK(datapath_twt_hold_is_releasing(&test_hold));
+    CHECK(test_dequeue(0, UINT32_MAX) == 3);
+    CHECK(!datapath_twt_hold_is_releasing(&test_hold));
+    CHECK(test_timeout_handler == NULL);
+    CHECK(test_datapath.twt_hold_stats.released_at_sp == 1);
+    CHECK(test_datapath.twt_hold_stats.frames_released == 3);
+}
+
+/* Frames held while a release is in progress wait for the next service period instead of
+ * extending the release. */
+static void test_rearm_after_release(void)
+{
+    test_reset();
+
+    test_hold_frame(TEST_TID_BE);
+    test_hold_frame(TEST_TID_BE);
+    test_hold_frame(TEST_TID_BE);
+    test_fire_timeout();
+    CHECK(test_dequeue(0, 1) == 1);
+
+    test_time_ms += 10;
+    test_hold_frame(TEST_TID_BE);
+    test_hold_frame(TEST_TID_BE);
+    CHECK(test_dequeue(1, UINT32_MAX) == 2);
+    CHECK(!datapath_twt_hold_is_releasing(&test_hold));
+    CHECK(test_timeout_handler != NULL && test_timeout_ms == 1150);
+
+    test_fire_timeout();
+    CHECK(test_dequeue(3, UINT32_MAX) == 2);
+    CHECK(test_datapath.twt_hold_stats.released_at_sp == 2);
+    CHECK(test_datapath.twt_hold_stats.frames_held == 5);
+    CHECK(test_datapath.twt_hold_stats.frames_released == 5);
+}
+
+/* An urgent frame that arrives during a release goes out with it, after the frames held before
+ * it. */
+static void test_urgent_during_release(void)
+{
+    test_reset();
+
+    test_hold_frame(TEST_TID_BE);
+    test_hold_frame(TEST_TID_BE);
+    test_fire_timeout();
+    CHECK(test_dequeue(0, 1) == 1);
+
+    test_hold_frame(TEST_TID_BE);
+    test_hold_frame(TEST_TID_VO);
+    CHECK(test_dequeue(1, UINT32_MAX) == 3);
+    CHECK(!datapath_twt_hold_is_releasing(&test_hold));
+    CHECK(test_timeout_handler == NULL);
+}
+
+/* Frames held during a release that fill the hold are released as soon as the release ends. */
+static void test_overflow_during_release(void)
+{
+    test_reset();
+    test_args.max_held_frames = 4;
+
+    test_hold_frame(TEST_TID_BE);
+    test_hold_frame(TEST_TID_BE);
+    test_fire_timeout();
+    for (unsigned ii = 0; ii < 4; ii++)
+    {
+        test_hold_frame(TEST_TID_BE);
+    }
+    CHECK(test_dequeue(0, UINT32_MAX) == 6);
+    CHECK(test_datapath.twt_hold_stats.released_on_overflow == 1);
+    CHECK(test_timeout_handler == NULL);
+}
+
+/* Frames held during a release keep their own deadline. */
+static void test_deadline_after_release(void)
+{
+    test_reset();
+    test_args.max_hold_ms[TEST_TID_BE] = 20;
+
+    test_hold_frame(TEST_TID_BE);
+    CHECK(test_timeout_ms == 1020);
+    test_fire_timeout();
+    test_time_ms += 5;
+    test_hold_frame(TEST_TID_BE);
+    CHECK(test_dequeue(0, UINT32_MAX) == 1);
+    CHECK(test_timeout_handler != NULL && test_timeout_ms == 1045);
+
+    test_fire_timeout();
+    CHECK(test_dequeue(1, UINT32_MAX) == 1);
+    CHECK(test_datapath.twt_hold_stats.released_on_deadline == 2);
+}
+
+int main(void)
+{
+    test_hold_until_sp();
+    test_rearm_after_release();
+    test_urgent_during_release();
+    test_overflow_during_release();
+    test_deadline_after_release();
+    test_reset();
+
+    return test_summary();
+}
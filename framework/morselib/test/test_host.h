@@ -0,0 +1,15 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Included ahead of every source file in the morselib host tests.
+ */
+
+#pragma once
+
+/* Some structures are checked against their size on the 32-bit target, which does not hold on a
+ * 64-bit host, so static assertions are compiled out. */
+#define _Static_assert(_expression, _message)
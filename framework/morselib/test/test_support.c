@@ -0,0 +1,78 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host versions of the mmosal functions that the morselib host tests need. The tests are single
+ * threaded, so critical sections do nothing and time only moves when a test advances it.
+ */
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "mmosal.h"
+#include "test_support.h"
+
+int test_failures;
+uint32_t test_time_ms;
+
+int test_summary(void)
+{
+    if (test_failures)
+    {
+        printf("%d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+    printf("All checks passed\n");
+    return EXIT_SUCCESS;
+}
+
+void mmosal_impl_assert(void)
+{
+    abort();
+}
+
+void *mmosal_malloc_(size_t size)
+{
+    return malloc(size);
+}
+
+void *mmosal_calloc_(size_t nitems, size_t size)
+{
+    return calloc(nitems, size);
+}
+
+void mmosal_free(void *p)
+{
+    free(p);
+}
+
+int mmosal_printf(const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int ret = vprintf(format, args);
+    va_end(args);
+    return ret;
+}
+
+const char *mmosal_task_name(void)
+{
+    return "test";
+}
+
+uint32_t mmosal_get_time_ms(void)
+{
+    return test_time_ms;
+}
+
+void mmosal_task_enter_critical(void)
+{
+}
+
+void mmosal_task_exit_critical(void)
+{
+}
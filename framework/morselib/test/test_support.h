@@ -0,0 +1,37 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Shared helpers for the morselib host tests.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+/** Number of checks that have failed so far. */
+extern int test_failures;
+
+/** Current value returned by @c mmosal_get_time_ms(). */
+extern uint32_t test_time_ms;
+
+/** Record a failure if @p _cond does not hold, and carry on. */
+#define CHECK(_cond)                                                          \
+    do {                                                                      \
+        if (!(_cond))                                                         \
+        {                                                                     \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #_cond); \
+            test_failures++;                                                  \
+        }                                                                     \
+    } while (0)
+
+/**
+ * Print a summary of the checks.
+ *
+ * @returns the exit code for the test.
+ */
+int test_summary(void);
@@ -0,0 +1,391 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host test for the AP TX scheduling and power save buffering in umac_ap.c, run against the real
+ * per-STA queues in umac_sta_data.c.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mmwlan.h"
+#include "mmdrv.h"
+#include "umac/data/umac_data_private.h"
+#include "umac/ap/umac_ap.h"
+#include "umac/ap/umac_ap_data.h"
+#include "test_support.h"
+
+/** Number of STAs that take part in the scheduling test. */
+#define TEST_NUM_STAS (6)
+
+/** DRR quantum in octets, which must match umac_ap.c. */
+#define TEST_DRR_QUANTUM (1600)
+
+/** Largest frame queued by the scheduling test. */
+#define TEST_MAX_FRAME_LEN (1500)
+
+static struct umac_ap_data test_ap;
+static struct umac_data *test_umacd = (struct umac_data *)&test_ap;
+
+/* The last entry is the STA record for group-addressed traffic. */
+static struct umac_sta_data test_stas[TEST_NUM_STAS + 1];
+
+static unsigned test_ps_frames_dropped;
+static unsigned test_ps_frames_expired;
+
+struct umac_ap_data *umac_data_get_ap(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    return &test_ap;
+}
+
+struct umac_ap_sta_data *umac_sta_data_get_ap(struct umac_sta_data *stad)
+{
+    return &stad->ap;
+}
+
+void umac_stats_update_datapath_txq_high_water_mark(struct umac_data *umacd, uint32_t value)
+{
+    MM_UNUSED(umacd);
+    MM_UNUSED(value);
+}
+
+void umac_stats_increment_datapath_txq_frames_queued_by_ac(struct umac_data *umacd,
+                                                           enum dot11_aci aci)
+{
+    MM_UNUSED(umacd);
+    MM_UNUSED(aci);
+}
+
+void umac_stats_increment_datapath_txq_ps_frames_dropped(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    test_ps_frames_dropped++;
+}
+
+void umac_stats_increment_datapath_txq_ps_frames_expired(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    test_ps_frames_expired++;
+}
+
+static struct mmpkt *test_alloc_frame(uint8_t tid, uint32_t len)
+{
+    struct mmpkt *mmpkt = mmpkt_alloc_on_heap(0, len, sizeof(struct mmdrv_tx_metadata));
+    struct mmpktview *view = mmpkt_open(mmpkt);
+    memset(mmpkt_append(view, len), 0, len);
+    mmpkt_close(&view);
+    mmdrv_get_tx_metadata(mmpkt)->tid = tid;
+    return mmpkt;
+}
+
+static void test_reset(void)
+{
+    memset(&test_ap, 0, sizeof(test_ap));
+    memset(test_stas, 0, sizeof(test_stas));
+    test_ps_frames_dropped = 0;
+    test_ps_frames_expired = 0;
+    test_time_ms = 0;
+    test_ap.args.ps_max_buffered_frames = 100;
+    test_ap.args.ps_max_buffered_bytes = 1000000;
+    test_ap.sta_common = &test_stas[TEST_NUM_STAS];
+    test_stas[TEST_NUM_STAS].ap.asleep = true;
+    for (unsigned ii = 0; ii < TEST_NUM_STAS; ii++)
+    {
+        test_stas[ii].aid = ii + 1;
+        test_stas[ii].umacd = test_umacd;
+        test_stas[ii].ap.ps_lifetime_ms = UINT32_MAX / 2;
+    }
+}
+
+static void test_drain(void)
+{
+    struct umac_sta_data *stad;
+    struct mmpkt *txbuf;
+
+    do {
+        umac_ap_tx_dequeue_frame(test_umacd, &stad, &txbuf);
+        mmpkt_release(txbuf);
+    } while (txbuf != NULL);
+}
+
+/* Backlogged STAs get the same number of octets to within one quantum plus one frame, whatever
+ * their frame size, and a STA that is asleep earns no credit. */
+static void test_drr_fairness(void)
+{
+    static const uint32_t frame_len[TEST_NUM_STAS] = { 1500, 100, 600, 1500, 40, 1100 };
+    const unsigned rounds = 200000;
+    uint64_t served[TEST_NUM_STAS] = { 0 };
+    unsigned queued[TEST_NUM_STAS] = { 0 };
+
+    test_reset();
+
+    /* STA 3 sleeps for the first half of the run. */
+    test_stas[3].ap.asleep = true;
+
+    for (unsigned round = 0; round < rounds; round++)
+    {
+        struct umac_sta_data *stad;
+        struct mmpkt *txbuf;
+
+        for (unsigned ii = 0; ii < TEST_NUM_STAS; ii++)
+        {
+            for (; queued[ii] < 3; queued[ii]++)
+            {
+                umac_ap_queue_pkt(test_umacd, &test_stas[ii], test_alloc_frame(0, frame_len[ii]));
+            }
+        }
+
+        if (round == rounds / 2)
+        {
+            CHECK(served[3] == 0);
+            CHECK(test_stas[3].ap.tx_deficit == 0);
+            test_stas[3].ap.asleep = false;
+            memset(served, 0, sizeof(served));
+        }
+
+        umac_ap_tx_dequeue_frame(test_umacd, &stad, &txbuf);
+        CHECK(txbuf != NULL);
+        if (txbuf == NULL)
+        {
+            break;
+        }
+
+        unsigned idx = stad - test_stas;
+        CHECK(idx < TEST_NUM_STAS);
+        served[idx] += mmpkt_peek_total_length(txbuf);
+        queued[idx]--;
+        mmpkt_release(txbuf);
+    }
+
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+    for (unsigned ii = 0; ii < TEST_NUM_STAS; ii++)
+    {
+        min = MM_MIN(min, served[ii]);
+        max = MM_MAX(max, served[ii]);
+    }
+    CHECK(min > 0);
+    CHECK(max - min <= TEST_DRR_QUANTUM + TEST_MAX_FRAME_LEN);
+
+    /* Once every queue is empty the ring is empty and no STA keeps any credit. */
+    test_drain();
+    CHECK(test_ap.tx_ring == NULL);
+    CHECK(test_ap.tx_ring_len == 0);
+    CHECK(test_ap.num_pkts_queued == 0);
+    for (unsigned ii = 0; ii < TEST_NUM_STAS; ii++)
+    {
+        CHECK(test_stas[ii].ap.tx_next == NULL);
+        CHECK(test_stas[ii].ap.tx_deficit == 0);
+    }
+}
+
+/* When every STA with queued frames is asleep nothing is dequeued and no credit is granted. */
+static void test_drr_all_paused(void)
+{
+    struct umac_sta_data *stad;
+    struct mmpkt *txbuf;
+
+    test_reset();
+    for (unsigned ii = 0; ii < TEST_NUM_STAS; ii++)
+    {
+        test_stas[ii].ap.asleep = true;
+        umac_ap_queue_pkt(test_umacd, &test_stas[ii], test_alloc_frame(0, 100));
+    }
+
+    umac_ap_tx_dequeue_frame(test_umacd, &stad, &txbuf);
+    CHECK(txbuf == NULL);
+    CHECK(test_ap.tx_ring_len == TEST_NUM_STAS);
+    for (unsigned ii = 0; ii < TEST_NUM_STAS; ii++)
+    {
+        CHECK(test_stas[ii].ap.tx_deficit == 0);
+        test_stas[ii].ap.asleep = false;
+    }
+    test_drain();
+}
+
+/* Group-addressed traffic is sent before traffic for individual STAs. */
+static void test_drr_group_first(void)
+{
+    struct umac_sta_data *stad;
+    struct mmpkt *txbuf;
+
+    test_reset();
+    test_stas[TEST_NUM_STAS].ap.asleep = false;
+    umac_ap_queue_pkt(test_umacd, &test_stas[0], test_alloc_frame(0, 100));
+    umac_ap_queue_pkt(test_umacd, &test_stas[TEST_NUM_STAS], test_alloc_frame(0, 60));
+
+    umac_ap_tx_dequeue_frame(test_umacd, &stad, &txbuf);
+    CHECK(stad == &test_stas[TEST_NUM_STAS]);
+    mmpkt_release(txbuf);
+    umac_ap_tx_dequeue_frame(test_umacd, &stad, &txbuf);
+    CHECK(stad == &test_stas[0]);
+    mmpkt_release(txbuf);
+}
+
+/** TIDs that map to each access category. */
+#define TEST_TID_BK (1)
+#define TEST_TID_BE (0)
+#define TEST_TID_VI (5)
+#define TEST_TID_VO (6)
+
+/** Frames queued by the power save tests are told apart by their length, which is this base plus
+ *  a small index. */
+#define TEST_PS_LEN_BASE (100)
+
+/** Queue a power save test frame with the given index at the given time. */
+static void test_ps_queue(struct umac_sta_data *stad, uint32_t time_ms, uint8_t tid, unsigned idx)
+{
+    test_time_ms = time_ms;
+    umac_ap_queue_pkt(test_umacd, stad, test_alloc_frame(tid, TEST_PS_LEN_BASE + idx));
+}
+
+/** Wake the given STA and dequeue everything, returning a bitmap of the indices of its frames. */
+static uint32_t test_ps_collect(struct umac_sta_data *stad)
+{
+    struct umac_sta_data *dequeued_stad;
+    struct mmpkt *txbuf;
+    uint32_t indices = 0;
+
+    CHECK(umac_ap_set_stad_sleep_state(stad, false));
+    for (;;)
+    {
+        umac_ap_tx_dequeue_frame(test_umacd, &dequeued_stad, &txbuf);
+        if (txbuf == NULL)
+        {
+            break;
+        }
+        if (dequeued_stad == stad)
+        {
+            indices |= 1ul << (mmpkt_peek_total_length(txbuf) - TEST_PS_LEN_BASE);
+        }
+        mmpkt_release(txbuf);
+    }
+    return indices;
+}
+
+/* With the drop oldest policy a full buffer drops the frame that has waited longest, even if a
+ * lower priority access category has a newer frame buffered. */
+static void test_ps_drop_oldest(void)
+{
+    struct umac_sta_data *stad = &test_stas[0];
+
+    test_reset();
+    test_ap.args.ps_max_buffered_frames = 3;
+    CHECK(umac_ap_set_stad_sleep_state(stad, true));
+
+    test_ps_queue(stad, 10, TEST_TID_BE, 1);
+    test_ps_queue(stad, 20, TEST_TID_VO, 2);
+    test_ps_queue(stad, 30, TEST_TID_BK, 3);
+    CHECK(test_ps_frames_dropped == 0);
+
+    test_ps_queue(stad, 40, TEST_TID_VO, 4);
+    CHECK(test_ps_frames_dropped == 1);
+    CHECK(umac_sta_data_get_queued_len(stad) == 3);
+
+    test_ps_queue(stad, 50, TEST_TID_BK, 5);
+    CHECK(test_ps_frames_dropped == 2);
+
+    CHECK(test_ps_collect(stad) == ((1ul << 3) | (1ul << 4) | (1ul << 5)));
+    CHECK(test_ap.num_pkts_queued == 0);
+}
+
+/* Frames queued while the STA was awake all start ageing when it goes to sleep, so the lowest
+ * priority of them is dropped first. */
+static void test_ps_drop_oldest_tie(void)
+{
+    struct umac_sta_data *stad = &test_stas[0];
+
+    test_reset();
+    test_ap.args.ps_max_buffered_frames = 3;
+
+    test_ps_queue(stad, 10, TEST_TID_VO, 1);
+    test_ps_queue(stad, 20, TEST_TID_BK, 2);
+    test_ps_queue(stad, 30, TEST_TID_BE, 3);
+    test_time_ms = 40;
+    CHECK(umac_ap_set_stad_sleep_state(stad, true));
+
+    test_ps_queue(stad, 50, TEST_TID_VI, 4);
+    CHECK(test_ps_frames_dropped == 1);
+    test_ps_queue(stad, 60, TEST_TID_VI, 5);
+    CHECK(test_ps_frames_dropped == 2);
+
+    CHECK(test_ps_collect(stad) == ((1ul << 1) | (1ul << 4) | (1ul << 5)));
+}
+
+/* With the drop newest policy the frame being queued is dropped once the byte limit is reached. */
+static void test_ps_drop_newest(void)
+{
+    struct umac_sta_data *stad = &test_stas[0];
+
+    test_reset();
+    test_ap.args.ps_drop_policy = MMWLAN_AP_PS_DROP_NEWEST;
+    test_ap.args.ps_max_buffered_bytes = 3 * TEST_PS_LEN_BASE;
+    CHECK(umac_ap_set_stad_sleep_state(stad, true));
+
+    test_ps_queue(stad, 10, TEST_TID_BK, 1);
+    test_ps_queue(stad, 20, TEST_TID_BE, 2);
+    test_ps_queue(stad, 30, TEST_TID_VO, 3);
+    CHECK(test_ps_frames_dropped == 1);
+    CHECK(umac_sta_data_get_queued_bytes(stad) == 2 * TEST_PS_LEN_BASE + 3);
+
+    CHECK(test_ps_collect(stad) == ((1ul << 1) | (1ul << 2)));
+}
+
+/* Frames age only while the STA sleeps, counting from when it went to sleep or, if later, from
+ * when the frame was queued. */
+static void test_ps_ageing(void)
+{
+    struct umac_sta_data *stad = &test_stas[0];
+    struct umac_sta_data *dequeued_stad;
+    struct mmpkt *txbuf;
+
+    test_reset();
+    stad->ap.ps_lifetime_ms = 1000;
+
+    /* A backlogged STA that is awake keeps its frames however long they wait. */
+    test_ps_queue(stad, 0, TEST_TID_BE, 1);
+    test_ps_queue(stad, 0, TEST_TID_BE, 2);
+    test_time_ms = 5000;
+    umac_ap_tx_dequeue_frame(test_umacd, &dequeued_stad, &txbuf);
+    CHECK(txbuf != NULL && dequeued_stad == stad);
+    mmpkt_release(txbuf);
+    CHECK(test_ps_frames_expired == 0);
+
+    /* The frame still queued starts ageing when the STA goes to sleep. */
+    CHECK(umac_ap_set_stad_sleep_state(stad, true));
+    test_ps_queue(stad, 5999, TEST_TID_BE, 3);
+    CHECK(test_ps_frames_expired == 0);
+    CHECK(umac_sta_data_get_queued_len(stad) == 2);
+
+    test_ps_queue(stad, 6000, TEST_TID_BE, 4);
+    CHECK(test_ps_frames_expired == 1);
+    CHECK(umac_sta_data_get_queued_len(stad) == 2);
+
+    /* Sleeping STAs are aged by the TX ring too. */
+    test_time_ms = 6999;
+    umac_ap_tx_dequeue_frame(test_umacd, &dequeued_stad, &txbuf);
+    CHECK(txbuf == NULL);
+    CHECK(test_ps_frames_expired == 2);
+    CHECK(test_ap.num_pkts_queued == 1);
+
+    CHECK(test_ps_collect(stad) == (1ul << 4));
+    CHECK(test_ps_frames_expired == 2);
+}
+
+int main(void)
+{
+    test_drr_fairness();
+    test_drr_all_paused();
+    test_drr_group_first();
+    test_ps_drop_oldest();
+    test_ps_drop_oldest_tie();
+    test_ps_drop_newest();
+    test_ps_ageing();
+
+    return test_summary();
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Functions that umac_ap.c links against but that the paths exercised by umac_ap_test.c never
+ * call. Reaching any of them fails the test.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+
+/** Define a function that must not be called by the test. */
+#define TEST_NOT_CALLED(_name) \
+    void _name(void);          \
+    void _name(void)           \
+    {                          \
+        abort();               \
+    }
+
+TEST_NOT_CALLED(build_mgmt_frame)
+TEST_NOT_CALLED(consbuf_append)
+TEST_NOT_CALLED(frame_probe_response_build)
+TEST_NOT_CALLED(ie_find_and_validate_length)
+TEST_NOT_CALLED(ie_s1g_operation_parse)
+TEST_NOT_CALLED(ie_s1g_tim_build)
+TEST_NOT_CALLED(ieee80211_crc32)
+TEST_NOT_CALLED(mmdrv_cfg_bss)
+TEST_NOT_CALLED(mmdrv_start_beaconing)
+TEST_NOT_CALLED(mmdrv_stop_beaconing)
+TEST_NOT_CALLED(mmdrv_update_sta_state)
+TEST_NOT_CALLED(mmosal_task_sleep)
+TEST_NOT_CALLED(umac_core_alloc_extra_timeouts)
+TEST_NOT_CALLED(umac_core_evt_wake)
+TEST_NOT_CALLED(umac_data_alloc_ap)
+TEST_NOT_CALLED(umac_data_dealloc_ap)
+TEST_NOT_CALLED(umac_datapath_stad_flush_txq)
+TEST_NOT_CALLED(umac_datapath_tx_mgmt_frame_ap)
+TEST_NOT_CALLED(umac_interface_add)
+TEST_NOT_CALLED(umac_interface_get_device_mac_addr)
+TEST_NOT_CALLED(umac_interface_get_vif_id)
+TEST_NOT_CALLED(umac_interface_invoke_vif_state_cb)
+TEST_NOT_CALLED(umac_interface_remove)
+TEST_NOT_CALLED(umac_interface_set_channel)
+TEST_NOT_CALLED(umac_keys_init)
+TEST_NOT_CALLED(umac_rc_deinit)
+TEST_NOT_CALLED(umac_rc_init_rate_table_mgmt)
+TEST_NOT_CALLED(umac_rc_start)
+TEST_NOT_CALLED(umac_rc_stop)
+TEST_NOT_CALLED(umac_regdb_get_channel_for_op_class)
+TEST_NOT_CALLED(umac_regdb_get_country_code)
+TEST_NOT_CALLED(umac_sta_data_alloc)
+TEST_NOT_CALLED(umac_supp_add_ap_interface)
+TEST_NOT_CALLED(umac_supp_remove_ap_interface)
+
+const void *const umac_datapath_ops_ap = NULL;
@@ -0,0 +1,320 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host test for the intra-BSS forwarding in umac_datapath_ap.c.
+ */
+
+#include <string.h>
+
+#include "mmwlan.h"
+#include "mmdrv.h"
+#include "common/mac_address.h"
+#include "dot11/dot11.h"
+#include "dot11/dot11_utils.h"
+#include "umac/data/umac_data_private.h"
+#include "umac/datapath/umac_datapath_private.h"
+#include "test_support.h"
+
+/** Number of associated STAs. */
+#define TEST_NUM_STAS (2)
+
+/** VIF ID of the first STA, each following STA has the next one. */
+#define TEST_VIF_ID_BASE (10)
+
+/** Ethertype given for the forwarded frames. */
+#define TEST_ETHERTYPE (0x0800)
+
+static const uint8_t test_own_addr[MMWLAN_MAC_ADDR_LEN] = { 0x02, 0, 0, 0, 0, 0xaa };
+static const uint8_t test_sta_addr[TEST_NUM_STAS + 1][MMWLAN_MAC_ADDR_LEN] = {
+    { 0x02, 0, 0, 0, 0, 0x01 },
+    { 0x02, 0, 0, 0, 0, 0x02 },
+    /* Not associated. */
+    { 0x02, 0, 0, 0, 0, 0x03 },
+};
+static const uint8_t test_bcast_addr[MMWLAN_MAC_ADDR_LEN] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+static struct umac_sta_data test_stas[TEST_NUM_STAS];
+static struct mmwlan_ap_args test_ap_args;
+static bool test_is_ap;
+static bool test_paused;
+static bool test_alloc_fails;
+static enum mmwlan_status test_tx_status;
+static struct mmpkt *test_sent;
+static unsigned test_forwarded;
+static unsigned test_isolated;
+static unsigned test_dropped;
+
+struct umac_data *umac_sta_data_get_umacd(struct umac_sta_data *stad)
+{
+    MM_UNUSED(stad);
+    return NULL;
+}
+
+uint16_t umac_sta_data_get_vif_id(struct umac_sta_data *stad)
+{
+    return TEST_VIF_ID_BASE + (stad - test_stas);
+}
+
+const struct mmwlan_ap_args *umac_ap_get_args(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    return test_is_ap ? &test_ap_args : NULL;
+}
+
+bool umac_interface_addr_matches_mac_addr(struct umac_sta_data *stad, const uint8_t *addr)
+{
+    MM_UNUSED(stad);
+    return mm_mac_addr_is_equal(addr, test_own_addr);
+}
+
+struct umac_sta_data *umac_ap_lookup_sta_by_addr(struct umac_data *umacd, const uint8_t *addr)
+{
+    MM_UNUSED(umacd);
+    for (unsigned ii = 0; ii < TEST_NUM_STAS; ii++)
+    {
+        if (mm_mac_addr_is_equal(addr, test_sta_addr[ii]))
+        {
+            return &test_stas[ii];
+        }
+    }
+    return NULL;
+}
+
+bool umac_datapath_is_tx_paused(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    return test_paused;
+}
+
+struct mmpkt *umac_datapath_alloc_mmpkt_for_qos_data_tx(uint32_t payload_len, uint8_t pkt_class)
+{
+    MM_UNUSED(pkt_class);
+    if (test_alloc_fails)
+    {
+        return NULL;
+    }
+    return mmpkt_alloc_on_heap(0, payload_len, sizeof(struct mmdrv_tx_metadata));
+}
+
+void umac_datapath_generate_8023_header(const uint8_t *dest_addr,
+                                        const uint8_t *src_addr,
+                                        uint16_t ethertype,
+                                        struct umac_8023_hdr *header)
+{
+    memcpy(header->dest_addr, dest_addr, sizeof(header->dest_addr));
+    memcpy(header->src_addr, src_addr, sizeof(header->src_addr));
+    header->ethertype_be = htobe16(ethertype);
+}
+
+enum mmwlan_status umac_datapath_tx_frame(struct umac_data *umacd,
+                                          struct mmpkt *txbuf,
+                                          enum umac_datapath_frame_encryption encryption,
+                                          const uint8_t *ra)
+{
+    MM_UNUSED(umacd);
+    MM_UNUSED(encryption);
+    MM_UNUSED(ra);
+    if (test_tx_status != MMWLAN_SUCCESS)
+    {
+        mmpkt_release(txbuf);
+        return test_tx_status;
+    }
+    CHECK(test_sent == NULL);
+    test_sent = txbuf;
+    return MMWLAN_SUCCESS;
+}
+
+void umac_stats_increment_datapath_rx_intra_bss_forwarded(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    test_forwarded++;
+}
+
+void umac_stats_increment_datapath_rx_intra_bss_isolated(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    test_isolated++;
+}
+
+void umac_stats_increment_datapath_rx_intra_bss_dropped(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    test_dropped++;
+}
+
+static void test_reset(enum mmwlan_ap_intra_bss_policy policy)
+{
+    memset(&test_ap_args, 0, sizeof(test_ap_args));
+    test_ap_args.intra_bss_policy = policy;
+    test_is_ap = true;
+    test_paused = false;
+    test_alloc_fails = false;
+    test_tx_status = MMWLAN_SUCCESS;
+    test_sent = NULL;
+    test_forwarded = 0;
+    test_isolated = 0;
+    test_dropped = 0;
+}
+
+/**
+ * Pass a frame received from the first STA to the forwarding hook.
+ *
+ * @returns true if the hook consumed the frame, false if it is left for the host.
+ */
+static bool test_rx(const uint8_t *da, bool four_addr, uint8_t tid, uint32_t len)
+{
+    struct
+    {
+        struct dot11_data_hdr hdr;
+        uint8_t addr4[MMWLAN_MAC_ADDR_LEN];
+    } frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.hdr.base.frame_control = DOT11_VER_TYPE_SUBTYPE(0, DATA, QOS_DATA) |
+                                   htole16(DOT11_MASK_FC_TO_DS);
+    if (four_addr)
+    {
+        frame.hdr.base.frame_control |= htole16(DOT11_MASK_FC_FROM_DS);
+    }
+    memcpy(frame.hdr.base.addr1, test_own_addr, MMWLAN_MAC_ADDR_LEN);
+    memcpy(frame.hdr.base.addr2, test_sta_addr[0], MMWLAN_MAC_ADDR_LEN);
+    memcpy(frame.hdr.base.addr3, da, MMWLAN_MAC_ADDR_LEN);
+
+    struct mmpkt *rxbuf = mmpkt_alloc_on_heap(0, len, 0);
+    struct mmpktview *rxbufview = mmpkt_open(rxbuf);
+    uint8_t *payload = mmpkt_append(rxbufview, len);
+    for (uint32_t ii = 0; ii < len; ii++)
+    {
+        payload[ii] = ii * 3;
+    }
+
+    umac_datapath_ops_ap->forward_rx_data_frame(&test_stas[0],
+                                                tid,
+                                                &frame.hdr,
+                                                TEST_ETHERTYPE,
+                                                &rxbufview);
+    if (rxbufview == NULL)
+    {
+        return true;
+    }
+    mmpkt_close(&rxbufview);
+    mmpkt_release(rxbuf);
+    return false;
+}
+
+/** Check the frame sent to the second STA and release it. */
+static void test_check_sent(uint8_t tid, uint32_t len)
+{
+    CHECK(test_sent != NULL);
+    if (test_sent == NULL)
+    {
+        return;
+    }
+
+    struct mmpktview *view = mmpkt_open(test_sent);
+    const uint8_t *data = mmpkt_get_data_start(view);
+    CHECK(mmpkt_get_data_length(view) == sizeof(struct umac_8023_hdr) + len);
+    CHECK(mm_mac_addr_is_equal(data, test_sta_addr[1]));
+    CHECK(mm_mac_addr_is_equal(data + MMWLAN_MAC_ADDR_LEN, test_sta_addr[0]));
+    CHECK(data[12] == (TEST_ETHERTYPE >> 8) && data[13] == (TEST_ETHERTYPE & 0xff));
+    for (uint32_t ii = 0; ii < len; ii++)
+    {
+        CHECK(data[sizeof(struct umac_8023_hdr) + ii] == (uint8_t)(ii * 3));
+    }
+    mmpkt_close(&view);
+
+    CHECK(mmdrv_get_tx_metadata(test_sent)->tid == tid);
+    CHECK(mmdrv_get_tx_metadata(test_sent)->vif_id == TEST_VIF_ID_BASE + 1);
+    mmpkt_release(test_sent);
+    test_sent = NULL;
+}
+
+/* Frames that are not unicast to another associated STA go to the host under every policy. */
+static void test_not_intra_bss(void)
+{
+    static const enum mmwlan_ap_intra_bss_policy policies[] = {
+        MMWLAN_AP_INTRA_BSS_TO_HOST,
+        MMWLAN_AP_INTRA_BSS_FORWARD,
+        MMWLAN_AP_INTRA_BSS_ISOLATE,
+    };
+
+    for (unsigned ii = 0; ii < MM_ARRAY_COUNT(policies); ii++)
+    {
+        test_reset(policies[ii]);
+        CHECK(!test_rx(test_own_addr, false, 0, 100));
+        CHECK(!test_rx(test_bcast_addr, false, 0, 100));
+        CHECK(!test_rx(test_sta_addr[TEST_NUM_STAS], false, 0, 100));
+        CHECK(!test_rx(test_sta_addr[1], true, 0, 100));
+        CHECK(test_sent == NULL);
+        CHECK(test_forwarded == 0 && test_isolated == 0 && test_dropped == 0);
+    }
+
+    test_reset(MMWLAN_AP_INTRA_BSS_TO_HOST);
+    CHECK(!test_rx(test_sta_addr[1], false, 0, 100));
+    test_reset(MMWLAN_AP_INTRA_BSS_FORWARD);
+    test_is_ap = false;
+    CHECK(!test_rx(test_sta_addr[1], false, 0, 100));
+    CHECK(test_sent == NULL);
+    CHECK(test_forwarded == 0 && test_isolated == 0 && test_dropped == 0);
+}
+
+/* Frames between STAs are sent on as 802.3 frames, with a non-QoS frame sent as TID 0. */
+static void test_forward(void)
+{
+    test_reset(MMWLAN_AP_INTRA_BSS_FORWARD);
+    CHECK(test_rx(test_sta_addr[1], false, 5, 300));
+    test_check_sent(5, 300);
+    CHECK(test_rx(test_sta_addr[1], false, UINT8_MAX, 10));
+    test_check_sent(0, 10);
+    CHECK(test_forwarded == 2 && test_isolated == 0 && test_dropped == 0);
+}
+
+/* Frames between STAs are dropped when the STAs are isolated. */
+static void test_isolate(void)
+{
+    test_reset(MMWLAN_AP_INTRA_BSS_ISOLATE);
+    CHECK(test_rx(test_sta_addr[1], false, 0, 100));
+    CHECK(test_sent == NULL);
+    CHECK(test_forwarded == 0 && test_isolated == 1 && test_dropped == 0);
+}
+
+/* Frames that cannot be sent on are consumed and counted, whether TX is paused, no buffer is
+ * available or the frame is refused. */
+static void test_drop(void)
+{
+    test_reset(MMWLAN_AP_INTRA_BSS_FORWARD);
+    test_paused = true;
+    CHECK(test_rx(test_sta_addr[1], false, 0, 100));
+    CHECK(test_sent == NULL);
+    CHECK(test_forwarded == 0 && test_dropped == 1);
+
+    test_paused = false;
+    CHECK(test_rx(test_sta_addr[1], false, 0, 100));
+    test_check_sent(0, 100);
+    CHECK(test_forwarded == 1 && test_dropped == 1);
+
+    test_alloc_fails = true;
+    CHECK(test_rx(test_sta_addr[1], false, 0, 100));
+    CHECK(test_sent == NULL);
+    CHECK(test_forwarded == 1 && test_dropped == 2);
+
+    test_alloc_fails = false;
+    test_tx_status = MMWLAN_NO_MEM;
+    CHECK(test_rx(test_sta_addr[1], false, 0, 100));
+    CHECK(test_sent == NULL);
+    CHECK(test_forwarded == 1 && test_dropped == 3);
+    CHECK(test_isolated == 0);
+}
+
+int main(void)
+{
+    test_not_intra_bss();
+    test_forward();
+    test_isolate();
+    test_drop();
+
+    return test_summary();
+}
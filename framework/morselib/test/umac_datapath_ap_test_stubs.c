@@ -0,0 +1,49 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Functions that umac_datapath_ap.c links against but that the paths exercised by
+ * umac_datapath_ap_test.c never call. Reaching any of them fails the test.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+
+/** Define a function that must not be called by the test. */
+#define TEST_NOT_CALLED(_name) \
+    void _name(void);          \
+    void _name(void)           \
+    {                          \
+        abort();               \
+    }
+
+TEST_NOT_CALLED(build_mgmt_frame)
+TEST_NOT_CALLED(frame_deauthentication_from_ap_build)
+TEST_NOT_CALLED(mmdrv_tx_frame)
+TEST_NOT_CALLED(umac_ap_get_sta_state)
+TEST_NOT_CALLED(umac_ap_handle_probe_req)
+TEST_NOT_CALLED(umac_ap_is_stad_paused)
+TEST_NOT_CALLED(umac_ap_lookup_sta_by_aid)
+TEST_NOT_CALLED(umac_ap_queue_pkt)
+TEST_NOT_CALLED(umac_ap_set_stad_sleep_state)
+TEST_NOT_CALLED(umac_ap_tx_dequeue_frame)
+TEST_NOT_CALLED(umac_ap_update_stad_last_active)
+TEST_NOT_CALLED(umac_data_get_datapath)
+TEST_NOT_CALLED(umac_datapath_process_rx_action_frame)
+TEST_NOT_CALLED(umac_datapath_tx_mgmt_frame)
+TEST_NOT_CALLED(umac_datapath_wait_for_tx_ready_)
+TEST_NOT_CALLED(umac_interface_get_vif_id)
+TEST_NOT_CALLED(umac_rc_init_rate_table_mgmt)
+TEST_NOT_CALLED(umac_sta_data_get_aid)
+TEST_NOT_CALLED(umac_sta_data_get_bssid)
+TEST_NOT_CALLED(umac_sta_data_get_datapath)
+TEST_NOT_CALLED(umac_sta_data_get_peer_addr)
+TEST_NOT_CALLED(umac_sta_data_peek_bssid)
+TEST_NOT_CALLED(umac_stats_increment_datapath_txq_frames_dropped)
+TEST_NOT_CALLED(umac_stats_update_last_tx_time)
+TEST_NOT_CALLED(umac_supp_l2_sock_receive_ap)
+TEST_NOT_CALLED(umac_supp_process_mgmt_frame)
+TEST_NOT_CALLED(umac_supp_process_probe_req_frame)
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host test for the channel lookups in umac_regdb.c. Every lookup is checked against a linear walk
+ * of the channel list, for each regulatory domain in mmregdb and for lists with duplicate keys.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mmwlan.h"
+#include "mmregdb.h"
+#include "umac/regdb/umac_regdb.h"
+#include "umac/regdb/umac_regdb_data.h"
+#include "test_support.h"
+
+/** Number of random channel lists with duplicate keys that are checked. */
+#define TEST_NUM_RANDOM_LISTS (2000)
+
+/** Largest random channel list. */
+#define TEST_MAX_RANDOM_CHANNELS (40)
+
+static const struct mmwlan_s1g_channel_list *test_channel_list;
+static struct umac_regdb_data test_regdb;
+static bool test_opclass_check;
+
+const struct mmwlan_s1g_channel_list *umac_config_get_channel_list(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    return test_channel_list;
+}
+
+bool umac_config_is_opclass_check_enabled(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    return test_opclass_check;
+}
+
+struct umac_regdb_data *umac_data_get_regdb(struct umac_data *umacd)
+{
+    MM_UNUSED(umacd);
+    return &test_regdb;
+}
+
+static const struct mmwlan_s1g_channel *test_ref_get_channel(uint8_t s1g_chan_num,
+                                                             int op_class)
+{
+    for (unsigned ii = 0; ii < test_channel_list->num_channels; ii++)
+    {
+        const struct mmwlan_s1g_channel *chan = &test_channel_list->channels[ii];
+        if (chan->s1g_chan_num == s1g_chan_num &&
+            (op_class < 0 || umac_regdb_op_class_match(NULL, op_class, chan)))
+        {
+            return chan;
+        }
+    }
+    return NULL;
+}
+
+static const struct mmwlan_s1g_channel *test_ref_get_channel_from_freq_and_bw(uint32_t freq_hz,
+                                                                              uint8_t bw_mask)
+{
+    const struct mmwlan_s1g_channel *match = NULL;
+
+    for (unsigned ii = 0; ii < test_channel_list->num_channels; ii++)
+    {
+        const struct mmwlan_s1g_channel *chan = &test_channel_list->channels[ii];
+        if (chan->centre_freq_hz == freq_hz && (bw_mask & chan->bw_mhz) != 0)
+        {
+            if (match != NULL)
+            {
+                return NULL;
+            }
+            match = chan;
+        }
+    }
+    return match;
+}
+
+/** Check every lookup on the current channel list against the linear walk. */
+static void test_check_lookups(void)
+{
+    for (unsigned chan_num = 0; chan_num <= UINT8_MAX; chan_num++)
+    {
+        const struct mmwlan_s1g_channel *chan = test_ref_get_channel(chan_num, -1);
+        CHECK(umac_regdb_get_channel(NULL, chan_num) == chan);
+        if (chan == NULL)
+        {
+            CHECK(umac_regdb_get_channel_for_op_class(NULL, chan_num, 0) == NULL);
+            continue;
+        }
+
+        for (unsigned op_class = 0; op_class <= UINT8_MAX; op_class++)
+        {
+            CHECK(umac_regdb_get_channel_for_op_class(NULL, chan_num, op_class) ==
+                  test_ref_get_channel(chan_num, op_class));
+        }
+    }
+
+    for (unsigned ii = 0; ii < test_channel_list->num_channels; ii++)
+    {
+        for (int offset_hz = -500000; offset_hz <= 500000; offset_hz += 500000)
+        {
+            uint32_t freq_hz = test_channel_list->channels[ii].centre_freq_hz + offset_hz;
+            for (unsigned bw_mask = 0; bw_mask < 32; bw_mask++)
+            {
+                CHECK(umac_regdb_get_channel_from_freq_and_bw(NULL, freq_hz, bw_mask) ==
+                      test_ref_get_channel_from_freq_and_bw(freq_hz, bw_mask));
+            }
+        }
+    }
+}
+
+/* Lookups on every regulatory domain match the linear walk, with the operating class check on
+ * and off, and an index built for another list is ignored. */
+static void test_regulatory_db(void)
+{
+    const struct mmwlan_regulatory_db *db = get_regulatory_db();
+
+    for (unsigned ii = 0; ii < db->num_domains; ii++)
+    {
+        for (int opclass_check = 0; opclass_check < 2; opclass_check++)
+        {
+            test_channel_list = db->domains[ii];
+            test_opclass_check = opclass_check;
+            umac_regdb_build_index(NULL);
+            CHECK(test_regdb.indexed_list == test_channel_list);
+            test_check_lookups();
+
+            test_channel_list = db->domains[(ii + 1) % db->num_domains];
+            test_check_lookups();
+        }
+    }
+}
+
+/* Where several channels share a key the index returns the same one as the linear walk. */
+static void test_duplicate_keys(void)
+{
+    static struct mmwlan_s1g_channel channels[TEST_MAX_RANDOM_CHANNELS];
+    static struct mmwlan_s1g_channel_list list = { .country_code = "ZZ", .channels = channels };
+
+    srand(1);
+    test_opclass_check = true;
+    test_channel_list = &list;
+    for (unsigned ii = 0; ii < TEST_NUM_RANDOM_LISTS && !test_failures; ii++)
+    {
+        list.num_channels = 1 + rand() % TEST_MAX_RANDOM_CHANNELS;
+        for (unsigned jj = 0; jj < list.num_channels; jj++)
+        {
+            channels[jj].s1g_chan_num = rand() % 8;
+            channels[jj].centre_freq_hz = 902000000 + (rand() % 6) * 500000;
+            channels[jj].bw_mhz = 1 << (rand() % 4);
+            channels[jj].global_operating_class = 60 + rand() % 4;
+            channels[jj].s1g_operating_class = rand() % 4;
+        }
+        umac_regdb_build_index(NULL);
+        CHECK(test_regdb.indexed_list == &list);
+        test_check_lookups();
+    }
+}
+
+/* A list too large to index is still searched. */
+static void test_too_large(void)
+{
+    static struct mmwlan_s1g_channel channels[UMAC_REGDB_INDEX_MAX_CHANNELS + 1];
+    static struct mmwlan_s1g_channel_list list = {
+        .country_code = "ZZ",
+        .num_channels = MM_ARRAY_COUNT(channels),
+        .channels = channels,
+    };
+
+    for (unsigned ii = 0; ii < list.num_channels; ii++)
+    {
+        channels[ii].s1g_chan_num = list.num_channels - ii;
+        channels[ii].centre_freq_hz = 902000000 + (list.num_channels - ii) * 500000;
+        channels[ii].bw_mhz = 1;
+        channels[ii].global_operating_class = MMWLAN_SKIP_OP_CLASS_CHECK;
+        channels[ii].s1g_operating_class = MMWLAN_SKIP_OP_CLASS_CHECK;
+    }
+    test_channel_list = &list;
+    umac_regdb_build_index(NULL);
+    CHECK(test_regdb.indexed_list == NULL);
+    test_check_lookups();
+}
+
+/* With no channel list there is nothing to find. */
+static void test_no_list(void)
+{
+    test_channel_list = NULL;
+    umac_regdb_build_index(NULL);
+    CHECK(test_regdb.indexed_list == NULL);
+    CHECK(umac_regdb_get_channel(NULL, 1) == NULL);
+    CHECK(umac_regdb_get_channel_for_op_class(NULL, 1, 68) == NULL);
+    CHECK(umac_regdb_get_channel_from_freq_and_bw(NULL, 902500000, 1) == NULL);
+    CHECK(strcmp(umac_regdb_get_country_code(NULL), "??") == 0);
+}
+
+int main(void)
+{
+    test_regulatory_db();
+    test_duplicate_keys();
+    test_too_large();
+    test_no_list();
+
+    return test_summary();
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host test for the per-STA access category TX queues in umac_sta_data.c.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mmwlan.h"
+#include "mmdrv.h"
+#include "umac/data/umac_data_private.h"
+#include "test_support.h"
+
+/** Frames a higher access category may send while a lower one waits, which must match
+ *  umac_sta_data.c. */
+#define TEST_TXQ_MAX_BURST (16)
+
+/** TID used for frames of each access category, indexed by ACI. */
+static const uint8_t test_tid_for_aci[DOT11_ACI_NUM_ACS] = { 0, 1, 5, 6 };
+
+/** Priority rank of each access category, indexed by ACI, where 0 is the highest. */
+static const int test_aci_rank[DOT11_ACI_NUM_ACS] = { 2, 3, 1, 0 };
+
+static uint32_t test_queued_by_ac[DOT11_ACI_NUM_ACS];
+
+void umac_stats_increment_datapath_txq_frames_queued_by_ac(struct umac_data *umacd,
+                                                           enum dot11_aci aci)
+{
+    MM_UNUSED(umacd);
+    test_queued_by_ac[aci]++;
+}
+
+/** Allocate a frame for the given access category, tagged with a sequence number. */
+static struct mmpkt *test_alloc_frame(enum dot11_aci aci, uint32_t len, uint32_t seq)
+{
+    struct mmpkt *mmpkt = mmpkt_alloc_on_heap(0, len, sizeof(struct mmdrv_tx_metadata));
+    struct mmpktview *view = mmpkt_open(mmpkt);
+    uint8_t *data = mmpkt_append(view, len);
+    memset(data, 0, len);
+    memcpy(data, &seq, MM_MIN(len, sizeof(seq)));
+    mmpkt_close(&view);
+    mmdrv_get_tx_metadata(mmpkt)->tid = test_tid_for_aci[aci];
+    return mmpkt;
+}
+
+static enum dot11_aci test_frame_aci(struct mmpkt *mmpkt)
+{
+    return dot11_tid_to_aci(mmdrv_get_tx_metadata(mmpkt)->tid);
+}
+
+static uint32_t test_frame_seq(struct mmpkt *mmpkt)
+{
+    uint32_t seq;
+    struct mmpktview *view = mmpkt_open(mmpkt);
+    memcpy(&seq, mmpkt_get_data_start(view), sizeof(seq));
+    mmpkt_close(&view);
+    return seq;
+}
+
+/* A higher access category goes first, but lets one frame of the next waiting category out after
+ * every TEST_TXQ_MAX_BURST frames. */
+static void test_burst_limit(void)
+{
+    static struct umac_sta_data stad;
+    char order[32] = { 0 };
+
+    for (uint32_t ii = 0; ii < 20; ii++)
+    {
+        umac_sta_data_queue_pkt(&stad, test_alloc_frame(DOT11_ACI_AC_VO, 100, ii));
+    }
+    for (uint32_t ii = 0; ii < 5; ii++)
+    {
+        umac_sta_data_queue_pkt(&stad, test_alloc_frame(DOT11_ACI_AC_BK, 50, ii));
+    }
+    CHECK(umac_sta_data_get_queued_len(&stad) == 25);
+    CHECK(umac_sta_data_get_queued_bytes(&stad) == 20 * 100 + 5 * 50);
+    CHECK(test_queued_by_ac[DOT11_ACI_AC_VO] == 20);
+    CHECK(test_queued_by_ac[DOT11_ACI_AC_BK] == 5);
+
+    for (unsigned ii = 0; ii < 25; ii++)
+    {
+        struct mmpkt *peeked = umac_sta_data_peek_pkt(&stad);
+        struct mmpkt *mmpkt = umac_sta_data_pop_pkt(&stad);
+        CHECK(mmpkt != NULL && mmpkt == peeked);
+        if (mmpkt == NULL)
+        {
+            break;
+        }
+        order[ii] = (test_frame_aci(mmpkt) == DOT11_ACI_AC_VO) ? 'O' : 'K';
+        mmpkt_release(mmpkt);
+    }
+    CHECK(strcmp(order, "OOOOOOOOOOOOOOOOKOOOOKKKK") == 0);
+    CHECK(umac_sta_data_pop_pkt(&stad) == NULL);
+    CHECK(umac_sta_data_get_queued_len(&stad) == 0);
+    CHECK(umac_sta_data_get_queued_bytes(&stad) == 0);
+}
+
+/* A random mix of queue and dequeue operations is checked against a model of the queues: frames
+ * of an access category leave in order, a lower category waits at most TEST_TXQ_MAX_BURST frames
+ * and the length and byte counts stay exact. */
+static void test_random(void)
+{
+    static struct umac_sta_data stad;
+    uint32_t model_len[DOT11_ACI_NUM_ACS] = { 0 };
+    uint32_t next_seq[DOT11_ACI_NUM_ACS] = { 0 };
+    uint32_t expected_seq[DOT11_ACI_NUM_ACS] = { 0 };
+    uint32_t model_bytes = 0;
+    unsigned burst = 0;
+
+    srand(1);
+    for (unsigned step = 0; step < 200000 && !test_failures; step++)
+    {
+        if (rand() % 2)
+        {
+            enum dot11_aci aci = (enum dot11_aci)(rand() % DOT11_ACI_NUM_ACS);
+            uint32_t len = 4 + rand() % 200;
+            umac_sta_data_queue_pkt(&stad, test_alloc_frame(aci, len, next_seq[aci]++));
+            model_len[aci]++;
+            model_bytes += len;
+        }
+        else
+        {
+            int top = -1;
+            int next = -1;
+            for (int aci = 0; aci < DOT11_ACI_NUM_ACS; aci++)
+            {
+                if (model_len[aci] == 0)
+                {
+                    continue;
+                }
+                if (top < 0 || test_aci_rank[aci] < test_aci_rank[top])
+                {
+                    next = top;
+                    top = aci;
+                }
+                else if (next < 0 || test_aci_rank[aci] < test_aci_rank[next])
+                {
+                    next = aci;
+                }
+            }
+
+            struct mmpkt *peeked = umac_sta_data_peek_pkt(&stad);
+            struct mmpkt *mmpkt = umac_sta_data_pop_pkt(&stad);
+            CHECK(mmpkt == peeked);
+            if (top < 0)
+            {
+                CHECK(mmpkt == NULL);
+                burst = 0;
+                continue;
+            }
+            if (mmpkt == NULL)
+            {
+                CHECK(mmpkt != NULL);
+                break;
+            }
+
+            int aci = test_frame_aci(mmpkt);
+            CHECK(test_frame_seq(mmpkt) == expected_seq[aci]);
+            expected_seq[aci]++;
+
+            if (aci == top)
+            {
+                burst = (next >= 0) ? burst + 1 : 0;
+                CHECK(burst <= TEST_TXQ_MAX_BURST);
+            }
+            else
+            {
+                CHECK(aci == next);
+                CHECK(burst == TEST_TXQ_MAX_BURST);
+                burst = 0;
+            }
+
+            model_len[aci]--;
+            model_bytes -= mmpkt_peek_total_length(mmpkt);
+            mmpkt_release(mmpkt);
+        }
+
+        uint32_t total = 0;
+        for (int aci = 0; aci < DOT11_ACI_NUM_ACS; aci++)
+        {
+            total += model_len[aci];
+        }
+        CHECK(umac_sta_data_get_queued_len(&stad) == total);
+        CHECK(umac_sta_data_get_queued_bytes(&stad) == model_bytes);
+    }
+
+    struct mmpkt *mmpkt;
+    while ((mmpkt = umac_sta_data_pop_pkt(&stad)) != NULL)
+    {
+        mmpkt_release(mmpkt);
+    }
+}
+
+int main(void)
+{
+    test_burst_limit();
+    test_random();
+
+    return test_summary();
+}
@@ -591,13 +591,25 @@ int sha1_prf(const uint8_t *key,
     return 0;
 }
 
-int pbkdf2_sha1(const char *passphrase,
-                const uint8_t *ssid,
-                size_t ssid_len,
-                int iterations,
-                uint8_t *buf,
-                size_t buflen)
+/** Arguments for a PBKDF2-SHA1 derivation run through @ref crypto_offload_run(). */
+struct pbkdf2_sha1_job
+{
+    const char *passphrase;
+    const uint8_t *ssid;
+    size_t ssid_len;
+    int iterations;
+    uint8_t *buf;
+};
+
+static int pbkdf2_sha1_run(void *arg)
 {
+    const struct pbkdf2_sha1_job *job = (const struct pbkdf2_sha1_job *)arg;
+    const char *passphrase = job->passphrase;
+    const uint8_t *ssid = job->ssid;
+    size_t ssid_len = job->ssid_len;
+    int iterations = job->iterations;
+    uint8_t *buf = job->buf;
+
 #if MBEDTLS_VERSION_NUMBER >= 0x03030000 /* mbedtls 3.3.0 */
     return mbedtls_pkcs5_pbkdf2_hmac_ext(MBEDTLS_MD_SHA1,
                                          (const uint8_t *)passphrase,
@@ -633,6 +645,24 @@ int pbkdf2_sha1(const char *passphrase,
 #endif
 }
 
+int pbkdf2_sha1(const char *passphrase,
+                const uint8_t *ssid,
+                size_t ssid_len,
+                int iterations,
+                uint8_t *buf,
+                size_t buflen)
+{
+    struct pbkdf2_sha1_job job = {
+        .passphrase = passphrase,
+        .ssid = ssid,
+        .ssid_len = ssid_len,
+        .iterations = iterations,
+        .buf = buf,
+    };
+
+    return crypto_offload_run(pbkdf2_sha1_run, &job);
+}
+
 void *aes_decrypt_init(const uint8_t *key, size_t len)
 {
     mbedtls_aes_context *aes = mmosal_malloc(sizeof(*aes));
@@ -752,6 +782,31 @@ int omac1_aes_128(const uint8_t *key, const uint8_t *data, size_t data_len, uint
 
 /* crypto.h bignum interfaces */
 
+/** Arguments for a modular exponentiation run through @ref crypto_offload_run(). */
+struct crypto_mbedtls_exp_mod_job
+{
+    mbedtls_mpi *X;
+    const mbedtls_mpi *A;
+    const mbedtls_mpi *E;
+    const mbedtls_mpi *N;
+};
+
+static int crypto_mbedtls_exp_mod_run(void *arg)
+{
+    const struct crypto_mbedtls_exp_mod_job *job = (const struct crypto_mbedtls_exp_mod_job *)arg;
+    return mbedtls_mpi_exp_mod(job->X, job->A, job->E, job->N, NULL);
+}
+
+/* Wrapper around mbedtls_mpi_exp_mod() that runs it through crypto_offload_run(). */
+static int crypto_mbedtls_exp_mod(mbedtls_mpi *X,
+                                  const mbedtls_mpi *A,
+                                  const mbedtls_mpi *E,
+                                  const mbedtls_mpi *N)
+{
+    struct crypto_mbedtls_exp_mod_job job = { .X = X, .A = A, .E = E, .N = N };
+    return crypto_offload_run(crypto_mbedtls_exp_mod_run, &job);
+}
+
 struct crypto_bignum *crypto_bignum_init(void)
 {
     mbedtls_mpi *bn = mmosal_malloc(sizeof(*bn));
@@ -852,11 +907,10 @@ int crypto_bignum_exptmod(const struct crypto_bignum *a,
     {
         mbedtls_mpi R;
         mbedtls_mpi_init(&R);
-        int rc = mbedtls_mpi_exp_mod(&R,
-                                     (const mbedtls_mpi *)a,
-                                     (const mbedtls_mpi *)b,
-                                     (const mbedtls_mpi *)c,
-                                     NULL) ||
+        int rc = crypto_mbedtls_exp_mod(&R,
+                                        (const mbedtls_mpi *)a,
+                                        (const mbedtls_mpi *)b,
+                                        (const mbedtls_mpi *)c) ||
                          mbedtls_mpi_copy((mbedtls_mpi *)d, &R) ?
                      -1 :
                      0;
@@ -865,11 +919,10 @@ int crypto_bignum_exptmod(const struct crypto_bignum *a,
     }
     else
     {
-        return mbedtls_mpi_exp_mod((mbedtls_mpi *)d,
-                                   (const mbedtls_mpi *)a,
-                                   (const mbedtls_mpi *)b,
-                                   (const mbedtls_mpi *)c,
-                                   NULL) ?
+        return crypto_mbedtls_exp_mod((mbedtls_mpi *)d,
+                                      (const mbedtls_mpi *)a,
+                                      (const mbedtls_mpi *)b,
+                                      (const mbedtls_mpi *)c) ?
                    -1 :
                    0;
     }
@@ -1013,7 +1066,7 @@ int crypto_bignum_legendre(const struct crypto_bignum *a, const struct crypto_bi
     int res;
     if (mbedtls_mpi_sub_int(&exp, (const mbedtls_mpi *)p, 1) == 0 &&
         mbedtls_mpi_shift_r(&exp, 1) == 0 &&
-        mbedtls_mpi_exp_mod(&tmp, (const mbedtls_mpi *)a, &exp, (const mbedtls_mpi *)p, NULL) == 0)
+        crypto_mbedtls_exp_mod(&tmp, (const mbedtls_mpi *)a, &exp, (const mbedtls_mpi *)p) == 0)
     {
         /*(modified from crypto_openssl.c:crypto_bignum_legendre())*/
         /* Return 1 if tmp == 1, 0 if tmp == 0, or -1 otherwise. Need
@@ -1660,21 +1713,43 @@ int crypto_ec_point_add(struct crypto_ec *e,
     return ret;
 }
 
-int crypto_ec_point_mul(struct crypto_ec *e,
-                        const struct crypto_ec_point *p,
-                        const struct crypto_bignum *b,
-                        struct crypto_ec_point *res)
+/** Arguments for a scalar multiplication run through @ref crypto_offload_run(). */
+struct crypto_ec_point_mul_job
+{
+    mbedtls_ecp_group *grp;
+    mbedtls_ecp_point *R;
+    const mbedtls_mpi *m;
+    const mbedtls_ecp_point *P;
+};
+
+static int crypto_ec_point_mul_run(void *arg)
 {
-    return mbedtls_ecp_mul((mbedtls_ecp_group *)e,
-                           (mbedtls_ecp_point *)res,
-                           (const mbedtls_mpi *)b,
-                           (const mbedtls_ecp_point *)p,
+    const struct crypto_ec_point_mul_job *job = (const struct crypto_ec_point_mul_job *)arg;
+    return mbedtls_ecp_mul(job->grp,
+                           job->R,
+                           job->m,
+                           job->P,
                            mbedtls_ctr_drbg_random,
                            crypto_mbedtls_ctr_drbg()) ?
                -1 :
                0;
 }
 
+int crypto_ec_point_mul(struct crypto_ec *e,
+                        const struct crypto_ec_point *p,
+                        const struct crypto_bignum *b,
+                        struct crypto_ec_point *res)
+{
+    struct crypto_ec_point_mul_job job = {
+        .grp = (mbedtls_ecp_group *)e,
+        .R = (mbedtls_ecp_point *)res,
+        .m = (const mbedtls_mpi *)b,
+        .P = (const mbedtls_ecp_point *)p,
+    };
+
+    return crypto_offload_run(crypto_ec_point_mul_run, &job);
+}
+
 int crypto_ec_point_invert(struct crypto_ec *e, struct crypto_ec_point *p)
 {
     if (mbedtls_ecp_get_type((mbedtls_ecp_group *)e) == MBEDTLS_ECP_TYPE_MONTGOMERY)
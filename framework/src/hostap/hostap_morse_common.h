@@ -141,6 +141,7 @@ const char *inet_ntop(int __af, const void *__cp, char *__buf, int __len);
 #define crypto_ecdh_set_peerkey        mmint_crypto_ecdh_set_peerkey
 #define crypto_ecdh_prime_len          mmint_crypto_ecdh_prime_len
 #define crypto_get_random              mmint_crypto_get_random
+#define crypto_offload_run             mmint_crypto_offload_run
 #define crypto_unload                  mmint_crypto_unload
 #define hmac_md5                       mmint_hmac_md5
 #define hmac_sha1                      mmint_hmac_sha1
@@ -170,3 +171,26 @@ const char *inet_ntop(int __af, const void *__cp, char *__buf, int __len);
 #define wpabuf_put                     mmint_wpabuf_put
 
 #endif /* ENABLE_HOSTAP_CRYPTO_API_MANGLING */
+
+/**
+ * Run a long-running crypto operation (e.g., an elliptic curve scalar multiplication). This is
+ * implemented by morselib. When called from the UMAC event loop, @p fn is executed on a
+ * lower priority worker task and the event loop continues to service the datapath until it
+ * completes. Otherwise @p fn is executed directly.
+ *
+ * The prebuilt morselib archives do not provide the worker, so when linking against them
+ * @p fn is always executed directly.
+ *
+ * @param fn    Function that performs the operation.
+ * @param arg   Argument to pass to @p fn.
+ *
+ * @returns the value returned by @p fn.
+ */
+#if defined(MORSELIB_FROM_SOURCE) && MORSELIB_FROM_SOURCE
+int crypto_offload_run(int (*fn)(void *arg), void *arg);
+#else
+static inline int crypto_offload_run(int (*fn)(void *arg), void *arg)
+{
+    return fn(arg);
+}
+#endif
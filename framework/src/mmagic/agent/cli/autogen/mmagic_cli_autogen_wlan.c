@@ -1766,6 +1766,7 @@ void mmagic_cli_wlan_beacon_monitor_disable(EmbeddedCli *cli, char *args, void *
 void mmagic_cli_wlan_get_sta_status(EmbeddedCli *cli, char *args, void *context);
 void mmagic_cli_wlan_dpp_push_button_start(EmbeddedCli *cli, char *args, void *context);
 void mmagic_cli_wlan_dpp_stop(EmbeddedCli *cli, char *args, void *context);
+void mmagic_cli_wlan_bus_benchmark(EmbeddedCli *cli, char *args, void *context);
 
 /********* Register bindings function definition **********/
 void mmagic_cli_wlan_register_bindings(EmbeddedCli *cli, struct mmagic_data *core)
@@ -1869,6 +1870,17 @@ void mmagic_cli_wlan_register_bindings(EmbeddedCli *cli, struct mmagic_data *cor
                              true,
                              core,
                              mmagic_cli_wlan_dpp_stop });
+
+    embeddedCliAddBinding(
+        cli,
+        (CliCommandBinding){
+            "wlan-bus_benchmark",
+            "Runs a loopback benchmark of the host interface bus. Packets are streamed through the "
+            "normal driver transmit and receive path to the chip, which returns them unmodified. "
+            "The WLAN interface must be up.",
+            true,
+            core,
+            mmagic_cli_wlan_bus_benchmark });
 }
 
 void mmagic_cli_wlan_init(struct mmagic_cli *ctx)
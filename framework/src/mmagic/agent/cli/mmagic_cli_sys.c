@@ -181,14 +181,17 @@ void mmagic_cli_sys_get_stats(EmbeddedCli *cli, char *args, void *context)
     else if (cmd_args.subsystem == MMAGIC_SUBSYSTEM_ID_UMAC)
     {
         /* Output lightly formatted umac stats */
-        struct mmwlan_stats_umac_data stats_umac;
+        struct mmwlan_stats_umac_data stats_umac = { 0 };
         struct mmwlan_stats_umac_data *data = &stats_umac;
 
-        memcpy(&stats_umac, rsp.buffer.data, sizeof(stats_umac));
+        memcpy(&stats_umac, rsp.buffer.data, MM_MIN(rsp.buffer.len, sizeof(stats_umac)));
         mmagic_cli_printf(
             cli,
             "%lu %lu %lu [ %lu %lu %lu %lu %lu %lu %lu %lu %lu %lu ] %d %u %u %u %u %u "
-            "%lu %lu %lu %u %lu %lu %lu %lu %lu %lu %lu %lu",
+            "%lu %lu %lu %u %lu %lu %lu %lu %lu %lu %lu %lu %lu %lu "
+            "[ %lu %lu %lu %lu %lu ] [ %lu %lu %lu %lu %lu ] "
+            "[ %lu %lu %lu %lu %lu ] [ %lu %lu %lu %lu %lu ] %lu %lu "
+            "[ %lu %lu %lu %lu ] [ %lu %lu %lu %lu ] %lu %lu %lu %lu %lu %lu %lu",
             data->last_tx_time,
             data->datapath_rxq_frames_dropped,
             data->datapath_txq_frames_dropped,
@@ -219,7 +222,46 @@ void mmagic_cli_sys_get_stats(EmbeddedCli *cli, char *args, void *context)
             data->datapath_rx_reorder_total,
             data->timeouts_fired,
             data->datapath_driver_tx_skbq_timeout,
-            data->datapath_driver_tx_pending_status_timeout);
+            data->datapath_driver_tx_pending_status_timeout,
+            data->datapath_driver_rx_packets,
+            data->datapath_driver_rx_read_transactions,
+            data->ps_awake_ms_by_reason[0],
+            data->ps_awake_ms_by_reason[1],
+            data->ps_awake_ms_by_reason[2],
+            data->ps_awake_ms_by_reason[3],
+            data->ps_awake_ms_by_reason[4],
+            data->ps_wake_count_by_reason[0],
+            data->ps_wake_count_by_reason[1],
+            data->ps_wake_count_by_reason[2],
+            data->ps_wake_count_by_reason[3],
+            data->ps_wake_count_by_reason[4],
+            data->ps_awake_ms_by_waker[0],
+            data->ps_awake_ms_by_waker[1],
+            data->ps_awake_ms_by_waker[2],
+            data->ps_awake_ms_by_waker[3],
+            data->ps_awake_ms_by_waker[4],
+            data->ps_wake_count_by_waker[0],
+            data->ps_wake_count_by_waker[1],
+            data->ps_wake_count_by_waker[2],
+            data->ps_wake_count_by_waker[3],
+            data->ps_wake_count_by_waker[4],
+            data->driver_task_busy_ms,
+            data->datapath_rx_defrag_bytes_high_water_mark,
+            data->datapath_txq_frames_queued_by_ac[0],
+            data->datapath_txq_frames_queued_by_ac[1],
+            data->datapath_txq_frames_queued_by_ac[2],
+            data->datapath_txq_frames_queued_by_ac[3],
+            data->datapath_txq_frames_dropped_by_ac[0],
+            data->datapath_txq_frames_dropped_by_ac[1],
+            data->datapath_txq_frames_dropped_by_ac[2],
+            data->datapath_txq_frames_dropped_by_ac[3],
+            data->datapath_txq_ps_frames_dropped,
+            data->datapath_txq_ps_frames_expired,
+            data->datapath_tx_airtime_deferrals,
+            data->datapath_txq_airtime_frames_dropped,
+            data->datapath_rx_intra_bss_forwarded,
+            data->datapath_rx_intra_bss_isolated,
+            data->datapath_rx_intra_bss_dropped);
     }
     else
     {
@@ -517,3 +517,55 @@ void mmagic_cli_wlan_dpp_stop(EmbeddedCli *cli, char *args, void *context)
     embeddedCliPrint(cli, "DPP not supported");
 #endif
 }
+
+void mmagic_cli_wlan_bus_benchmark(EmbeddedCli *cli, char *args, void *context)
+{
+    MM_UNUSED(context);
+
+    struct mmagic_cli *ctx = (struct mmagic_cli *)cli->appContext;
+    struct mmagic_core_wlan_bus_benchmark_cmd_args cmd = {};
+    struct mmagic_core_wlan_bus_benchmark_rsp_args rsp = {};
+
+    const char *pkt_len = embeddedCliGetToken(args, 1);
+    const char *num_pkts = embeddedCliGetToken(args, 2);
+    const char *batch_depth = embeddedCliGetToken(args, 3);
+
+    if (pkt_len != NULL)
+    {
+        cmd.pkt_len = atoi(pkt_len);
+    }
+    if (num_pkts != NULL)
+    {
+        cmd.num_pkts = atoi(num_pkts);
+    }
+    if (batch_depth != NULL)
+    {
+        cmd.batch_depth = atoi(batch_depth);
+    }
+
+    enum mmagic_status status = mmagic_core_wlan_bus_benchmark(&ctx->core, &cmd, &rsp);
+    if (status != MMAGIC_STATUS_OK)
+    {
+        mmagic_cli_print_error(cli, "Bus benchmark", status);
+        return;
+    }
+
+    mmagic_cli_printf(cli,
+                      "Sent %lu, received %lu in %lu ms",
+                      rsp.result.num_sent,
+                      rsp.result.num_received,
+                      rsp.result.duration_ms);
+    mmagic_cli_printf(cli,
+                      "Throughput %lu.%03lu MB/s, %lu pkts/s",
+                      rsp.result.throughput_bytes_per_s / 1000000,
+                      (rsp.result.throughput_bytes_per_s / 1000) % 1000,
+                      rsp.result.pkts_per_s);
+    mmagic_cli_printf(cli,
+                      "Latency (us) min %lu, p50 %lu, p90 %lu, p99 %lu, max %lu",
+                      rsp.result.latency_min_us,
+                      rsp.result.latency_p50_us,
+                      rsp.result.latency_p90_us,
+                      rsp.result.latency_p99_us,
+                      rsp.result.latency_max_us);
+    mmagic_cli_printf(cli, "Driver busy %lu ms", rsp.result.driver_busy_ms);
+}
@@ -48,7 +48,7 @@ enum mmagic_status mmagic_core_event_mqtt_message_received(
     const struct mmagic_core_event_mqtt_message_received_args *args)
 {
     const uint8_t *payload = (const uint8_t *)args;
-    size_t payload_len = sizeof(*args);
+    size_t payload_len = MMAGIC_TAIL_WIRE_LEN(args, payload, 0);
     MMOSAL_ASSERT(core->event_fn != NULL);
     return core->event_fn(core->event_fn_arg,
                           mmagic_mqtt,
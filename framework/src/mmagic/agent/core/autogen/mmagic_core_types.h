@@ -44,6 +44,7 @@ enum MM_PACKED mmagic_wlan_cmds
     mmagic_wlan_cmd_get_sta_status = 21,
     mmagic_wlan_cmd_dpp_push_button_start = 22,
     mmagic_wlan_cmd_dpp_stop = 23,
+    mmagic_wlan_cmd_bus_benchmark = 24,
 };
 
 enum MM_PACKED mmagic_wlan_events
@@ -451,6 +452,22 @@ struct MM_PACKED raw1600
     uint8_t data[1600];
 };
 
+/**
+ * Number of octets of a @c stringN or @c rawN value that are in use: the length field, @c len
+ * octets of @c data and @p _extra trailing octets (i.e., the null terminator for strings). This
+ * is capped at the size of the type.
+ */
+#define MMAGIC_VARLEN_USED_SIZE(_v, _extra) \
+    (sizeof(*(_v)) - sizeof((_v)->data) + \
+     MM_MIN((size_t)(_v)->len + (_extra), sizeof((_v)->data)))
+
+/**
+ * Number of octets of an argument structure that need to be sent when its final member @p _tail
+ * is a @c stringN or @c rawN value. Unused octets at the end of @p _tail are not sent.
+ */
+#define MMAGIC_TAIL_WIRE_LEN(_args, _tail, _extra) \
+    (sizeof(*(_args)) - sizeof((_args)->_tail) + MMAGIC_VARLEN_USED_SIZE(&(_args)->_tail, _extra))
+
 /** Data type to contain mac address byte array. */
 struct MM_PACKED struct_mac_addr
 {
@@ -604,6 +621,33 @@ struct MM_PACKED struct_iperf_status
     uint32_t bandwidth_kbitpsec;
 };
 
+/** Data structure to store host interface bus benchmark results. */
+struct MM_PACKED struct_bus_benchmark_result
+{
+    /** Number of loopback packets sent to the chip. */
+    uint32_t num_sent;
+    /** Number of loopback packets received back from the chip. */
+    uint32_t num_received;
+    /** Duration of the benchmark in milliseconds. */
+    uint32_t duration_ms;
+    /** Loopback payload throughput in bytes per second. */
+    uint32_t throughput_bytes_per_s;
+    /** Loopback packets completed per second. */
+    uint32_t pkts_per_s;
+    /** Minimum round trip latency of a loopback packet in microseconds. */
+    uint32_t latency_min_us;
+    /** Median round trip latency of a loopback packet in microseconds. */
+    uint32_t latency_p50_us;
+    /** 90th percentile round trip latency of a loopback packet in microseconds. */
+    uint32_t latency_p90_us;
+    /** 99th percentile round trip latency of a loopback packet in microseconds. */
+    uint32_t latency_p99_us;
+    /** Maximum round trip latency of a loopback packet in microseconds. */
+    uint32_t latency_max_us;
+    /** Time in milliseconds that the driver task spent processing during the run. */
+    uint32_t driver_busy_ms;
+};
+
 /** Generic 64 byte buffer. */
 struct MM_PACKED struct_buffer64
 {
@@ -243,6 +243,26 @@ enum mmagic_status mmagic_core_wlan_dpp_push_button_start(struct mmagic_data *co
 
 enum mmagic_status mmagic_core_wlan_dpp_stop(struct mmagic_data *core);
 
+/** Command arguments structure for wlan_bus_benchmark */
+struct MM_PACKED mmagic_core_wlan_bus_benchmark_cmd_args
+{
+    uint32_t pkt_len;
+    uint32_t num_pkts;
+    uint32_t batch_depth;
+    uint32_t timeout;
+};
+
+/** Response arguments structure for wlan_bus_benchmark */
+struct MM_PACKED mmagic_core_wlan_bus_benchmark_rsp_args
+{
+    struct struct_bus_benchmark_result result;
+};
+
+enum mmagic_status mmagic_core_wlan_bus_benchmark(
+    struct mmagic_data *core,
+    const struct mmagic_core_wlan_bus_benchmark_cmd_args *cmd_args,
+    struct mmagic_core_wlan_bus_benchmark_rsp_args *rsp_args);
+
 /*
  * ---------------------------------------------------------------------------------------------
  * Internal API: to be used by the implementation C file only.
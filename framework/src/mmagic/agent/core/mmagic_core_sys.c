@@ -167,7 +167,8 @@ enum mmagic_status mmagic_core_sys_get_stats(
 
     if (cmd_args->subsystem == MMAGIC_SUBSYSTEM_ID_UMAC)
     {
-        struct mmwlan_stats_umac_data stats;
+        /* Zeroed so that counters unknown to a prebuilt morselib read as zero. */
+        struct mmwlan_stats_umac_data stats = { 0 };
         enum mmwlan_status status = mmwlan_get_umac_stats(&stats);
         if (status != MMWLAN_SUCCESS)
         {
@@ -965,3 +965,56 @@ enum mmagic_status mmagic_core_wlan_dpp_stop(struct mmagic_data *core)
     return MMAGIC_STATUS_NOT_SUPPORTED;
 #endif
 }
+
+enum mmagic_status mmagic_core_wlan_bus_benchmark(
+    struct mmagic_data *core,
+    const struct mmagic_core_wlan_bus_benchmark_cmd_args *cmd_args,
+    struct mmagic_core_wlan_bus_benchmark_rsp_args *rsp_args)
+{
+    MM_UNUSED(core);
+#if (defined(MORSELIB_FROM_SOURCE) && MORSELIB_FROM_SOURCE)
+    struct mmwlan_bus_benchmark_args args = MMWLAN_BUS_BENCHMARK_ARGS_INIT;
+    struct mmwlan_bus_benchmark_result result = {};
+
+    if (cmd_args->pkt_len != 0)
+    {
+        args.pkt_len = cmd_args->pkt_len;
+    }
+    if (cmd_args->num_pkts != 0)
+    {
+        args.num_pkts = cmd_args->num_pkts;
+    }
+    if (cmd_args->batch_depth != 0)
+    {
+        args.batch_depth = cmd_args->batch_depth;
+    }
+    if (cmd_args->timeout != 0)
+    {
+        args.timeout_ms = cmd_args->timeout;
+    }
+
+    enum mmwlan_status status = mmwlan_bus_benchmark(&args, &result);
+    if (status != MMWLAN_SUCCESS)
+    {
+        return mmagic_mmwlan_status_to_mmagic_status(status);
+    }
+
+    rsp_args->result.num_sent = result.num_sent;
+    rsp_args->result.num_received = result.num_received;
+    rsp_args->result.duration_ms = result.duration_ms;
+    rsp_args->result.throughput_bytes_per_s = result.throughput_bytes_per_s;
+    rsp_args->result.pkts_per_s = result.pkts_per_s;
+    rsp_args->result.latency_min_us = result.latency_min_us;
+    rsp_args->result.latency_p50_us = result.latency_p50_us;
+    rsp_args->result.latency_p90_us = result.latency_p90_us;
+    rsp_args->result.latency_p99_us = result.latency_p99_us;
+    rsp_args->result.latency_max_us = result.latency_max_us;
+    rsp_args->result.driver_busy_ms = result.driver_busy_ms;
+
+    return MMAGIC_STATUS_OK;
+#else
+    MM_UNUSED(cmd_args);
+    MM_UNUSED(rsp_args);
+    return MMAGIC_STATUS_NOT_SUPPORTED;
+#endif
+}
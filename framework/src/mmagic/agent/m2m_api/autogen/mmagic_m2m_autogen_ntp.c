@@ -38,7 +38,7 @@ static struct mmbuf *mmagic_m2m_ntp_get(struct mmagic_m2m_agent *agent,
                                               subcommand,
                                               MMAGIC_STATUS_OK,
                                               &data->config.server,
-                                              sizeof(data->config.server));
+                                              MMAGIC_VARLEN_USED_SIZE(&data->config.server, 1));
 
         default:
             return mmagic_m2m_create_response(mmagic_ntp,
@@ -76,7 +76,7 @@ static struct mmbuf *mmagic_m2m_socket_recv(struct mmagic_m2m_agent *agent,
                                       subcommand,
                                       status,
                                       &rsp_args,
-                                      sizeof(rsp_args));
+                                      MMAGIC_TAIL_WIRE_LEN(&rsp_args, buffer, 0));
 }
 
 static struct mmbuf *mmagic_m2m_socket_send(struct mmagic_m2m_agent *agent,
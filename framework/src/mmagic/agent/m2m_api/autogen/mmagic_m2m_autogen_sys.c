@@ -91,7 +91,7 @@ static struct mmbuf *mmagic_m2m_sys_get_stats(struct mmagic_m2m_agent *agent,
                                       subcommand,
                                       status,
                                       &rsp_args,
-                                      sizeof(rsp_args));
+                                      MMAGIC_TAIL_WIRE_LEN(&rsp_args, buffer, 0));
 }
 
 struct mmbuf *mmagic_m2m_sys_process(struct mmagic_m2m_agent *agent,
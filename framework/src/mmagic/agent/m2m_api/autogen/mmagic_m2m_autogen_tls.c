@@ -38,7 +38,8 @@ static struct mmbuf *mmagic_m2m_tls_get(struct mmagic_m2m_agent *agent,
                                               subcommand,
                                               MMAGIC_STATUS_OK,
                                               &data->config.root_ca_certificate,
-                                              sizeof(data->config.root_ca_certificate));
+                                              MMAGIC_VARLEN_USED_SIZE(
+                                                  &data->config.root_ca_certificate, 0));
 
         case mmagic_tls_var_client_certificate:
             return mmagic_m2m_create_response(mmagic_tls,
@@ -46,7 +47,8 @@ static struct mmbuf *mmagic_m2m_tls_get(struct mmagic_m2m_agent *agent,
                                               subcommand,
                                               MMAGIC_STATUS_OK,
                                               &data->config.client_certificate,
-                                              sizeof(data->config.client_certificate));
+                                              MMAGIC_VARLEN_USED_SIZE(
+                                                  &data->config.client_certificate, 0));
 
         case mmagic_tls_var_client_private_key:
             return mmagic_m2m_create_response(mmagic_tls,
@@ -54,7 +56,8 @@ static struct mmbuf *mmagic_m2m_tls_get(struct mmagic_m2m_agent *agent,
                                               subcommand,
                                               MMAGIC_STATUS_OK,
                                               &data->config.client_private_key,
-                                              sizeof(data->config.client_private_key));
+                                              MMAGIC_VARLEN_USED_SIZE(
+                                                  &data->config.client_private_key, 0));
 
         default:
             return mmagic_m2m_create_response(mmagic_tls,
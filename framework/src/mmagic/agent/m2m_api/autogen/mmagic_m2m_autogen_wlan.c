@@ -46,7 +46,7 @@ static struct mmbuf *mmagic_m2m_wlan_get(struct mmagic_m2m_agent *agent,
                                               subcommand,
                                               MMAGIC_STATUS_OK,
                                               &data->config.ssid,
-                                              sizeof(data->config.ssid));
+                                              MMAGIC_VARLEN_USED_SIZE(&data->config.ssid, 1));
 
         case mmagic_wlan_var_password:
             return mmagic_m2m_create_response(mmagic_wlan,
@@ -54,7 +54,7 @@ static struct mmbuf *mmagic_m2m_wlan_get(struct mmagic_m2m_agent *agent,
                                               subcommand,
                                               MMAGIC_STATUS_OK,
                                               &data->config.password,
-                                              sizeof(data->config.password));
+                                              MMAGIC_VARLEN_USED_SIZE(&data->config.password, 1));
 
         case mmagic_wlan_var_security:
             return mmagic_m2m_create_response(mmagic_wlan,
@@ -198,7 +198,8 @@ static struct mmbuf *mmagic_m2m_wlan_get(struct mmagic_m2m_agent *agent,
                                               subcommand,
                                               MMAGIC_STATUS_OK,
                                               &data->config.qos_0_params,
-                                              sizeof(data->config.qos_0_params));
+                                              MMAGIC_VARLEN_USED_SIZE(
+                                                  &data->config.qos_0_params, 1));
 
         case mmagic_wlan_var_qos_1_params:
             return mmagic_m2m_create_response(mmagic_wlan,
@@ -206,7 +207,8 @@ static struct mmbuf *mmagic_m2m_wlan_get(struct mmagic_m2m_agent *agent,
                                               subcommand,
                                               MMAGIC_STATUS_OK,
                                               &data->config.qos_1_params,
-                                              sizeof(data->config.qos_1_params));
+                                              MMAGIC_VARLEN_USED_SIZE(
+                                                  &data->config.qos_1_params, 1));
 
         case mmagic_wlan_var_qos_2_params:
             return mmagic_m2m_create_response(mmagic_wlan,
@@ -214,7 +216,8 @@ static struct mmbuf *mmagic_m2m_wlan_get(struct mmagic_m2m_agent *agent,
                                               subcommand,
                                               MMAGIC_STATUS_OK,
                                               &data->config.qos_2_params,
-                                              sizeof(data->config.qos_2_params));
+                                              MMAGIC_VARLEN_USED_SIZE(
+                                                  &data->config.qos_2_params, 1));
 
         case mmagic_wlan_var_qos_3_params:
             return mmagic_m2m_create_response(mmagic_wlan,
@@ -222,7 +225,8 @@ static struct mmbuf *mmagic_m2m_wlan_get(struct mmagic_m2m_agent *agent,
                                               subcommand,
                                               MMAGIC_STATUS_OK,
                                               &data->config.qos_3_params,
-                                              sizeof(data->config.qos_3_params));
+                                              MMAGIC_VARLEN_USED_SIZE(
+                                                  &data->config.qos_3_params, 1));
 
         case mmagic_wlan_var_mcs10_mode:
             return mmagic_m2m_create_response(mmagic_wlan,
@@ -806,6 +810,25 @@ static struct mmbuf *mmagic_m2m_wlan_dpp_stop(struct mmagic_m2m_agent *agent,
                                       0);
 }
 
+static struct mmbuf *mmagic_m2m_wlan_bus_benchmark(struct mmagic_m2m_agent *agent,
+                                                   uint8_t sid,
+                                                   uint8_t subcommand,
+                                                   struct mmbuf *commandbuffer)
+{
+    enum mmagic_status status;
+    struct mmagic_core_wlan_bus_benchmark_cmd_args *cmd_args =
+        (struct mmagic_core_wlan_bus_benchmark_cmd_args *)mmbuf_get_data_start(commandbuffer);
+    MM_UNUSED(sid);
+    struct mmagic_core_wlan_bus_benchmark_rsp_args rsp_args = {};
+    status = mmagic_core_wlan_bus_benchmark(&agent->core, cmd_args, &rsp_args);
+    return mmagic_m2m_create_response(mmagic_wlan,
+                                      mmagic_wlan_cmd_bus_benchmark,
+                                      subcommand,
+                                      status,
+                                      &rsp_args,
+                                      sizeof(rsp_args));
+}
+
 struct mmbuf *mmagic_m2m_wlan_process(struct mmagic_m2m_agent *agent,
                                       uint8_t sid,
                                       struct mmagic_m2m_command_header *header,
@@ -881,6 +904,9 @@ struct mmbuf *mmagic_m2m_wlan_process(struct mmagic_m2m_agent *agent,
         case mmagic_wlan_cmd_dpp_stop:
             return mmagic_m2m_wlan_dpp_stop(agent, sid, header->subcommand, cmd_buf);
 
+        case mmagic_wlan_cmd_bus_benchmark:
+            return mmagic_m2m_wlan_bus_benchmark(agent, sid, header->subcommand, cmd_buf);
+
         default:
             break;
     }
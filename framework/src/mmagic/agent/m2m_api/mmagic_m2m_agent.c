@@ -12,6 +12,13 @@
 #include "m2m_api/mmagic_m2m_agent.h"
 #include "m2m_api/autogen/mmagic_m2m_internal.h"
 
+/**
+ * Number of requests that may be queued for each stream. The Controller may have several
+ * commands in flight on a stream, so this allows the LLC to hand them over without blocking
+ * reception for the other streams while the stream task is busy.
+ */
+#define MMAGIC_M2M_STREAM_QUEUE_LENGTH (4)
+
 /** M2M stream data. */
 struct mmagic_m2m_stream
 {
@@ -178,7 +185,9 @@ enum mmagic_status mmagic_m2m_agent_open_stream(struct mmagic_data *core,
 
             core->stream[ii]->stream_context = stream_context;
             core->stream[ii]->stream_queue =
-                mmosal_queue_create(1, sizeof(struct mmagic_m2m_stream_request), NULL);
+                mmosal_queue_create(MMAGIC_M2M_STREAM_QUEUE_LENGTH,
+                                    sizeof(struct mmagic_m2m_stream_request),
+                                    NULL);
             if (core->stream[ii]->stream_queue == NULL)
             {
                 mmosal_free(core->stream[ii]);
@@ -315,7 +315,7 @@ struct mmagic_data;
  * Queue a callback to execute in the CONTROL_STREAM context.
  *
  * This allows safe calling of mmagic_core_* functions outside of the MMAGIC
- * stream. This may block on adding to the (single element) queue, and
+ * stream. This may block on adding to the stream's request queue, and
  * will return an error if the timeout is reached. It must only be called
  * after mmagic_m2m_agent_init is run.
  *
@@ -195,6 +195,78 @@ enum mmagic_m2m_event_id
 /** Maximum number of streams possible. */
 #define MMAGIC_LLC_MAX_STREAMS (8)
 
+/** Tag value that is never assigned to an asynchronous command. */
+#define MMAGIC_CONTROLLER_INVALID_TAG (0)
+
+/** Interval at which asynchronous commands are checked for a response timeout. */
+#define MMAGIC_CONTROLLER_PENDING_POLL_MS (100)
+
+/** Number of commands remembered on each stream for matching responses. Must be a power of 2. */
+#define MMAGIC_CONTROLLER_HISTORY_LEN (16)
+
+/** Value of @c mmagic_controller_sent_cmd.owner for a command whose response is not awaited. */
+#define MMAGIC_CONTROLLER_NO_OWNER (0xff)
+
+/** State of an asynchronous command slot. */
+enum mmagic_controller_pending_state
+{
+    /** Slot is not in use. */
+    MMAGIC_CONTROLLER_PENDING_FREE,
+    /** Slot has been allocated but the command has not yet been sent. */
+    MMAGIC_CONTROLLER_PENDING_RESERVED,
+    /** Command has been sent and is awaiting a response. */
+    MMAGIC_CONTROLLER_PENDING_IN_FLIGHT,
+};
+
+/** Record of a command that was sent on a stream, used to match up its response. */
+struct mmagic_controller_sent_cmd
+{
+    /** The submodule the command was sent to. */
+    uint8_t submodule_id;
+    /** The command ID. */
+    uint8_t command_id;
+    /** The subcommand ID. */
+    uint8_t subcommand_id;
+    /** Index of the slot in @c cmds awaiting the response, @c MMAGIC_CONTROLLER_MAX_IN_FLIGHT
+     *  for the stream's blocking slot, or @c MMAGIC_CONTROLLER_NO_OWNER. The slot may since
+     *  have been released and reused, so its sequence number must be checked. */
+    uint8_t owner;
+};
+
+/** Book-keeping for a command that is awaiting a response. */
+struct mmagic_controller_pending_cmd
+{
+    /** Current state of this slot. */
+    enum mmagic_controller_pending_state state;
+    /** Tag that identifies this command to the application. */
+    uint32_t tag;
+    /** Sequence number of the command on its stream. Commands on a stream are numbered
+     *  consecutively in the order that they go out on the wire. */
+    uint32_t seq;
+    /** Set for a blocking command, whose response is passed on to @c mmagic_controller_rx(). */
+    bool blocking;
+    /** The stream the command was sent on. */
+    uint8_t stream_id;
+    /** The submodule the command was sent to. */
+    uint8_t submodule_id;
+    /** The command ID. */
+    uint8_t command_id;
+    /** The subcommand ID. */
+    uint8_t subcommand_id;
+    /** Time in milliseconds to wait for the response, or @c UINT32_MAX to wait indefinitely. */
+    uint32_t timeout_ms;
+    /** Time at which the command fails with @c MMAGIC_STATUS_TIMEOUT. */
+    uint32_t deadline_ms;
+    /** Buffer to load with the returned data. */
+    uint8_t *rsp_buffer;
+    /** Length of @c rsp_buffer. */
+    size_t rsp_buffer_length;
+    /** Callback to invoke on completion. */
+    mmagic_controller_rsp_cb_t cb;
+    /** Opaque argument for @c cb. */
+    void *cb_arg;
+};
+
 /** Context for the MMAGIC Controller.
  *
  * This maintains the state needed to interact with the agent.
@@ -237,6 +309,32 @@ struct mmagic_controller
     struct mmosal_queue *stream_queue[MMAGIC_LLC_MAX_STREAMS];
     /** The mutex to protect access to the streams @c mmbuf_list and TX path */
     struct mmosal_mutex *tx_mutex;
+    /** Asynchronous commands awaiting a response */
+    struct
+    {
+        /** Command slots. */
+        struct mmagic_controller_pending_cmd cmds[MMAGIC_CONTROLLER_MAX_IN_FLIGHT];
+        /** The blocking command most recently sent on each stream. */
+        struct mmagic_controller_pending_cmd blocking[MMAGIC_LLC_MAX_STREAMS];
+        /** The commands most recently sent on each stream, indexed by sequence number modulo
+         *  @c MMAGIC_CONTROLLER_HISTORY_LEN. */
+        struct mmagic_controller_sent_cmd history[MMAGIC_LLC_MAX_STREAMS]
+                                                 [MMAGIC_CONTROLLER_HISTORY_LEN];
+        /** The tag that was most recently assigned. */
+        uint32_t last_tag;
+        /** The sequence number that was most recently assigned on each stream. */
+        uint32_t last_tx_seq[MMAGIC_LLC_MAX_STREAMS];
+        /** The sequence number of the command that the next response on each stream is
+         *  expected to be for. */
+        uint32_t next_rx_seq[MMAGIC_LLC_MAX_STREAMS];
+        /** Timer used to fail asynchronous commands whose response does not arrive in time. */
+        struct mmosal_timer *timer;
+        /** Set while @c timer is running. */
+        bool timer_running;
+        /** Mutex to protect access to @c cmds. This may be taken while holding @c tx_mutex but
+         *  not the other way around. */
+        struct mmosal_mutex *mutex;
+    } pending;
     /** Callback function to executed any time a event that the agent has started is
      * received. */
     mmagic_controller_agent_start_cb_t agent_start_cb;
@@ -252,6 +350,13 @@ static void mmagic_m2m_controller_event_rx_callback(struct mmagic_controller *co
                                                     uint8_t sid,
                                                     struct mmbuf *rx_buffer);
 
+static void mmagic_controller_pending_record(struct mmagic_controller *controller,
+                                             uint8_t sid,
+                                             const struct mmagic_controller_pending_cmd *pending);
+
+static void mmagic_controller_pending_fail_all(struct mmagic_controller *controller,
+                                               enum mmagic_status status);
+
 /* -------------------------------------------------------------------------------------------- */
 
 void mmagic_controller_register_wlan_beacon_rx_handler(
@@ -473,6 +578,8 @@ static void mmagic_llc_controller_rx_callback(struct mmagic_datalink_controller
 
         case MMAGIC_LLC_PTYPE_AGENT_START_NOTIFICATION:
             mmosal_printf("MMAGIC_LLC: Received agent START event!\n");
+            /* Any commands that were in flight have been lost with the agent reset */
+            mmagic_controller_pending_fail_all(controller, MMAGIC_STATUS_CLOSED);
             if (controller->agent_start_cb)
             {
                 controller->agent_start_cb(controller, controller->agent_start_arg);
@@ -521,7 +628,8 @@ exit:
 static enum mmagic_status mmagic_llc_controller_tx(struct mmagic_controller *controller,
                                                    enum mmagic_llc_packet_type ptype,
                                                    uint8_t sid,
-                                                   struct mmbuf *tx_buffer)
+                                                   struct mmbuf *tx_buffer,
+                                                   struct mmagic_controller_pending_cmd *pending)
 {
     struct mmagic_llc_header *txheader;
     if (tx_buffer == NULL)
@@ -551,6 +659,23 @@ static enum mmagic_status mmagic_llc_controller_tx(struct mmagic_controller *con
     uint8_t sent_seq = MMAGIC_LLC_GET_NEXT_SEQ(controller->controller_llc.last_sent_seq);
     txheader->tseq = MMAGIC_LLC_SET_TSEQ(ptype, sent_seq);
 
+    if (pending != NULL)
+    {
+        /* The sequence number is assigned while holding tx_mutex so that it matches the order in
+         * which commands go out on the wire, and the command must be marked in flight before it
+         * is sent since the response may arrive before the datalink returns. */
+        mmosal_mutex_get(controller->pending.mutex, UINT32_MAX);
+        pending->seq = ++controller->pending.last_tx_seq[sid];
+        pending->deadline_ms = mmosal_get_time_ms() + pending->timeout_ms;
+        mmagic_controller_pending_record(controller, sid, pending);
+        pending->state = MMAGIC_CONTROLLER_PENDING_IN_FLIGHT;
+        if (pending->timeout_ms != UINT32_MAX && !controller->pending.timer_running)
+        {
+            controller->pending.timer_running = mmosal_timer_start(controller->pending.timer);
+        }
+        mmosal_mutex_release(controller->pending.mutex);
+    }
+
     /* Send the buffer - tx_buffer will be freed by mmhal_datalink */
     enum mmagic_status status = MMAGIC_STATUS_TX_ERROR;
     if (mmagic_datalink_controller_tx_buffer(controller->controller_llc.controller_dl, tx_buffer) >
@@ -560,6 +685,17 @@ static enum mmagic_status mmagic_llc_controller_tx(struct mmagic_controller *con
         status = MMAGIC_STATUS_OK;
         controller->controller_llc.last_sent_seq = sent_seq;
     }
+    else if (pending != NULL)
+    {
+        /* The agent will not respond to a command it did not receive, so give the sequence number
+         * back for the next command on this stream. */
+        mmosal_mutex_get(controller->pending.mutex, UINT32_MAX);
+        pending->state = MMAGIC_CONTROLLER_PENDING_FREE;
+        controller->pending.history[sid][pending->seq % MMAGIC_CONTROLLER_HISTORY_LEN].owner =
+            MMAGIC_CONTROLLER_NO_OWNER;
+        controller->pending.last_tx_seq[sid]--;
+        mmosal_mutex_release(controller->pending.mutex);
+    }
     mmosal_mutex_release(controller->tx_mutex);
     return status;
 }
@@ -690,28 +826,29 @@ static enum mmagic_status mmagic_status_from_u8(uint8_t status)
     }
 }
 
-enum mmagic_status mmagic_controller_rx(struct mmagic_controller *controller,
-                                        uint8_t stream_id,
-                                        uint8_t submodule_id,
-                                        uint8_t command_id,
-                                        uint8_t subcommand_id,
-                                        uint8_t *buffer,
-                                        size_t buffer_length,
-                                        uint32_t timeout_ms)
+/**
+ * Parse a response received from the agent and copy out any returned data.
+ *
+ * @param rx_buffer     The received response. This function takes ownership of the buffer.
+ * @param submodule_id  The submodule the response is expected from.
+ * @param command_id    The command the response is expected for.
+ * @param subcommand_id The subcommand the response is expected for.
+ * @param buffer        Buffer to load with any returned data. May be NULL if none. If the
+ *                      agent returns less than @p buffer_length octets (e.g., a response that
+ *                      ends in a string or raw value) then the remainder is zeroed.
+ * @param buffer_length Length of above buffer.
+ *
+ * @returns @c MMAGIC_STATUS_OK on success, else an error code.
+ */
+static enum mmagic_status mmagic_controller_parse_response(struct mmbuf *rx_buffer,
+                                                           uint8_t submodule_id,
+                                                           uint8_t command_id,
+                                                           uint8_t subcommand_id,
+                                                           uint8_t *buffer,
+                                                           size_t buffer_length)
 {
-    struct mmbuf *rx_buffer = NULL;
     struct mmagic_m2m_response_header *rx_header;
 
-    if (stream_id >= MMAGIC_LLC_MAX_STREAMS)
-    {
-        return MMAGIC_STATUS_INVALID_STREAM;
-    }
-
-    if (!mmosal_queue_pop(controller->stream_queue[stream_id], &rx_buffer, timeout_ms))
-    {
-        return MMAGIC_STATUS_ERROR;
-    }
-
     if (rx_buffer == NULL)
     {
         return MMAGIC_STATUS_ERROR;
@@ -757,6 +894,10 @@ enum mmagic_status mmagic_controller_rx(struct mmagic_controller *controller,
             /* buffer may be NULL if payload_len is 0 and calling memcpy would be UB. */
             memcpy(buffer, mmbuf_get_data_start(rx_buffer), payload_len);
         }
+        if (buffer != NULL)
+        {
+            memset(buffer + payload_len, 0, buffer_length - payload_len);
+        }
         mmbuf_release(rx_buffer);
         return MMAGIC_STATUS_OK;
     }
@@ -766,6 +907,223 @@ enum mmagic_status mmagic_controller_rx(struct mmagic_controller *controller,
     return MMAGIC_STATUS_NOT_FOUND;
 }
 
+enum mmagic_status mmagic_controller_rx(struct mmagic_controller *controller,
+                                        uint8_t stream_id,
+                                        uint8_t submodule_id,
+                                        uint8_t command_id,
+                                        uint8_t subcommand_id,
+                                        uint8_t *buffer,
+                                        size_t buffer_length,
+                                        uint32_t timeout_ms)
+{
+    struct mmbuf *rx_buffer = NULL;
+
+    if (stream_id >= MMAGIC_LLC_MAX_STREAMS)
+    {
+        return MMAGIC_STATUS_INVALID_STREAM;
+    }
+
+    if (!mmosal_queue_pop(controller->stream_queue[stream_id], &rx_buffer, timeout_ms))
+    {
+        /* If the response turns up later then it is discarded rather than being returned for the
+         * next command on this stream. */
+        mmosal_mutex_get(controller->pending.mutex, UINT32_MAX);
+        controller->pending.blocking[stream_id].state = MMAGIC_CONTROLLER_PENDING_FREE;
+        mmosal_mutex_release(controller->pending.mutex);
+        return MMAGIC_STATUS_ERROR;
+    }
+
+    return mmagic_controller_parse_response(rx_buffer,
+                                            submodule_id,
+                                            command_id,
+                                            subcommand_id,
+                                            buffer,
+                                            buffer_length);
+}
+
+/**
+ * Record a command that is about to be sent so that its response can be matched up.
+ *
+ * @note The pending mutex must be held when calling this function.
+ *
+ * @param controller Controller context.
+ * @param sid        The stream ID.
+ * @param pending    The command, with its sequence number assigned.
+ */
+static void mmagic_controller_pending_record(struct mmagic_controller *controller,
+                                             uint8_t sid,
+                                             const struct mmagic_controller_pending_cmd *pending)
+{
+    struct mmagic_controller_sent_cmd *sent =
+        &controller->pending.history[sid][pending->seq % MMAGIC_CONTROLLER_HISTORY_LEN];
+
+    sent->submodule_id = pending->submodule_id;
+    sent->command_id = pending->command_id;
+    sent->subcommand_id = pending->subcommand_id;
+    sent->owner = pending->blocking ? MMAGIC_CONTROLLER_MAX_IN_FLIGHT :
+                                      (uint8_t)(pending - controller->pending.cmds);
+
+    /* If the oldest unanswered command is about to be forgotten then give up on it. Its owner,
+     * if any, will time out. */
+    if (pending->seq - controller->pending.next_rx_seq[sid] >= MMAGIC_CONTROLLER_HISTORY_LEN)
+    {
+        controller->pending.next_rx_seq[sid] = pending->seq - MMAGIC_CONTROLLER_HISTORY_LEN + 1;
+    }
+}
+
+/**
+ * Find the command that a response received on the given stream is for.
+ *
+ * The agent responds to the commands on a stream in the order that they were sent, so this is
+ * normally the command numbered @c next_rx_seq. The agent does not send a response if it rejects
+ * a command at the LLC layer, so the response header is also checked and if it does not match
+ * then the oldest later command with the same header is taken instead.
+ *
+ * @note The pending mutex must be held when calling this function.
+ *
+ * @param controller Controller context.
+ * @param sid        The stream ID.
+ * @param rx_header  Header of the received response.
+ * @param found      Set to @c true if the response was for a command that was sent, even if
+ *                   it is no longer awaited.
+ *
+ * @returns the slot awaiting the response, or @c NULL if there is none.
+ */
+static struct mmagic_controller_pending_cmd *mmagic_controller_pending_match(
+    struct mmagic_controller *controller,
+    uint8_t sid,
+    const struct mmagic_m2m_response_header *rx_header,
+    bool *found)
+{
+    uint32_t last_tx_seq = controller->pending.last_tx_seq[sid];
+    uint32_t seq;
+
+    *found = false;
+
+    /* Sequence numbers may wrap, so compare using the signed difference. */
+    for (seq = controller->pending.next_rx_seq[sid]; (int32_t)(last_tx_seq - seq) >= 0; seq++)
+    {
+        const struct mmagic_controller_sent_cmd *sent =
+            &controller->pending.history[sid][seq % MMAGIC_CONTROLLER_HISTORY_LEN];
+        if ((rx_header->subsystem != sent->submodule_id) ||
+            (rx_header->command != sent->command_id) ||
+            (rx_header->subcommand != sent->subcommand_id))
+        {
+            continue;
+        }
+
+        struct mmagic_controller_pending_cmd *cmd = NULL;
+        if (sent->owner == MMAGIC_CONTROLLER_MAX_IN_FLIGHT)
+        {
+            cmd = &controller->pending.blocking[sid];
+        }
+        else if (sent->owner < MMAGIC_CONTROLLER_MAX_IN_FLIGHT)
+        {
+            cmd = &controller->pending.cmds[sent->owner];
+        }
+
+        *found = true;
+        controller->pending.next_rx_seq[sid] = seq + 1;
+        if (cmd != NULL &&
+            cmd->state == MMAGIC_CONTROLLER_PENDING_IN_FLIGHT &&
+            cmd->stream_id == sid &&
+            cmd->seq == seq)
+        {
+            return cmd;
+        }
+        return NULL;
+    }
+
+    return NULL;
+}
+
+static void mmagic_controller_pending_fail_all(struct mmagic_controller *controller,
+                                               enum mmagic_status status)
+{
+    mmosal_mutex_get(controller->pending.mutex, UINT32_MAX);
+    for (int ii = 0; ii < MMAGIC_LLC_MAX_STREAMS; ii++)
+    {
+        controller->pending.blocking[ii].state = MMAGIC_CONTROLLER_PENDING_FREE;
+        controller->pending.next_rx_seq[ii] = controller->pending.last_tx_seq[ii] + 1;
+    }
+    mmosal_mutex_release(controller->pending.mutex);
+
+    for (int ii = 0; ii < MMAGIC_CONTROLLER_MAX_IN_FLIGHT; ii++)
+    {
+        struct mmagic_controller_pending_cmd *cmd = &controller->pending.cmds[ii];
+        struct mmagic_controller_pending_cmd completed;
+
+        mmosal_mutex_get(controller->pending.mutex, UINT32_MAX);
+        completed = *cmd;
+        if (cmd->state == MMAGIC_CONTROLLER_PENDING_IN_FLIGHT)
+        {
+            cmd->state = MMAGIC_CONTROLLER_PENDING_FREE;
+        }
+        mmosal_mutex_release(controller->pending.mutex);
+
+        if (completed.state == MMAGIC_CONTROLLER_PENDING_IN_FLIGHT && completed.cb != NULL)
+        {
+            completed.cb(controller, completed.tag, status, completed.cb_arg);
+        }
+    }
+}
+
+static void mmagic_controller_pending_timer_cb(struct mmosal_timer *timer)
+{
+    struct mmagic_controller *controller = (struct mmagic_controller *)mmosal_timer_get_arg(timer);
+    bool waiting = false;
+
+    for (int ii = 0; ii < MMAGIC_CONTROLLER_MAX_IN_FLIGHT; ii++)
+    {
+        struct mmagic_controller_pending_cmd *cmd = &controller->pending.cmds[ii];
+        struct mmagic_controller_pending_cmd expired = { 0 };
+
+        /* Timer callbacks must not block, so if the mutex is busy try again on the next tick. */
+        if (!mmosal_mutex_get(controller->pending.mutex, 0))
+        {
+            return;
+        }
+        if (cmd->state == MMAGIC_CONTROLLER_PENDING_IN_FLIGHT && cmd->timeout_ms != UINT32_MAX)
+        {
+            /* Times may wrap, so compare using the signed difference. */
+            if ((int32_t)(mmosal_get_time_ms() - cmd->deadline_ms) >= 0)
+            {
+                expired = *cmd;
+                cmd->state = MMAGIC_CONTROLLER_PENDING_FREE;
+            }
+            else
+            {
+                waiting = true;
+            }
+        }
+        mmosal_mutex_release(controller->pending.mutex);
+
+        if (expired.state == MMAGIC_CONTROLLER_PENDING_IN_FLIGHT && expired.cb != NULL)
+        {
+            expired.cb(controller, expired.tag, MMAGIC_STATUS_TIMEOUT, expired.cb_arg);
+        }
+    }
+
+    /* Stop the timer once nothing is waiting. This is checked again while holding the mutex since
+     * a command may have been sent meanwhile without starting the timer, as it was running. */
+    if (!waiting && mmosal_mutex_get(controller->pending.mutex, 0))
+    {
+        for (int ii = 0; ii < MMAGIC_CONTROLLER_MAX_IN_FLIGHT; ii++)
+        {
+            struct mmagic_controller_pending_cmd *cmd = &controller->pending.cmds[ii];
+            if (cmd->state == MMAGIC_CONTROLLER_PENDING_IN_FLIGHT && cmd->timeout_ms != UINT32_MAX)
+            {
+                waiting = true;
+            }
+        }
+        if (!waiting && mmosal_timer_stop(timer))
+        {
+            controller->pending.timer_running = false;
+        }
+        mmosal_mutex_release(controller->pending.mutex);
+    }
+}
+
 static void mmagic_m2m_controller_rx_callback(struct mmagic_controller *controller,
                                               uint8_t sid,
                                               struct mmbuf *rx_buffer)
@@ -782,7 +1140,110 @@ static void mmagic_m2m_controller_rx_callback(struct mmagic_controller *controll
         return;
     }
 
-    mmosal_queue_push(controller->stream_queue[sid], &rx_buffer, UINT32_MAX);
+    struct mmagic_m2m_response_header *rx_header =
+        (struct mmagic_m2m_response_header *)mmbuf_get_data_start(rx_buffer);
+    if (mmbuf_get_data_length(rx_buffer) < sizeof(*rx_header))
+    {
+        /* Packet too small */
+        mmosal_printf("MMAGIC: Dropped truncated response on stream %u\n", sid);
+        mmbuf_release(rx_buffer);
+        return;
+    }
+
+    struct mmagic_controller_pending_cmd completed = { 0 };
+    bool found;
+
+    mmosal_mutex_get(controller->pending.mutex, UINT32_MAX);
+    struct mmagic_controller_pending_cmd *cmd = mmagic_controller_pending_match(controller,
+                                                                                sid,
+                                                                                rx_header,
+                                                                                &found);
+    if (cmd != NULL)
+    {
+        completed = *cmd;
+        cmd->state = MMAGIC_CONTROLLER_PENDING_FREE;
+    }
+    mmosal_mutex_release(controller->pending.mutex);
+
+    if (cmd == NULL)
+    {
+        /* Nobody is waiting for this response any more, e.g. because it was cancelled or timed
+         * out, so it is discarded. */
+        if (!found)
+        {
+            mmosal_printf("MMAGIC: Dropped unexpected response on stream %u\n", sid);
+        }
+        mmbuf_release(rx_buffer);
+        return;
+    }
+
+    if (completed.blocking)
+    {
+        /* This runs in the data link RX thread, which must not block waiting for the stream's
+         * task to take an earlier response, so the response is dropped if the queue is full. */
+        if (!mmosal_queue_push(controller->stream_queue[sid], &rx_buffer, 0))
+        {
+            mmosal_printf("MMAGIC: Dropped response on stream %u, queue full\n", sid);
+            mmbuf_release(rx_buffer);
+        }
+        return;
+    }
+
+    enum mmagic_status status = mmagic_controller_parse_response(rx_buffer,
+                                                                 completed.submodule_id,
+                                                                 completed.command_id,
+                                                                 completed.subcommand_id,
+                                                                 completed.rsp_buffer,
+                                                                 completed.rsp_buffer_length);
+    if (completed.cb != NULL)
+    {
+        completed.cb(controller, completed.tag, status, completed.cb_arg);
+    }
+}
+
+/**
+ * Get the arguments of a received event, zero-padding them out to the full size of the
+ * argument structure. Events whose arguments end in a string or raw value are sent by the agent
+ * at their used length.
+ *
+ * @param rx_buffer Reference to the received event, with the header removed. If there is not
+ *                  enough space to pad the arguments then this is replaced with a larger copy
+ *                  and the original is released.
+ * @param min_len   Minimum length of the arguments that will be accepted.
+ * @param full_len  Size of the argument structure.
+ *
+ * @returns a pointer to the arguments on success, else @c NULL.
+ */
+static void *mmagic_controller_get_event_args(struct mmbuf **rx_buffer,
+                                              size_t min_len,
+                                              size_t full_len)
+{
+    struct mmbuf *buf = *rx_buffer;
+    uint32_t len = mmbuf_get_data_length(buf);
+
+    if (len < min_len)
+    {
+        /* Packet too small */
+        return NULL;
+    }
+
+    if (len < full_len)
+    {
+        if (mmbuf_available_space_at_end(buf) < full_len - len)
+        {
+            struct mmbuf *copy = mmbuf_alloc_on_heap(0, full_len);
+            if (copy == NULL)
+            {
+                return NULL;
+            }
+            mmbuf_append_data(copy, mmbuf_get_data_start(buf), len);
+            mmbuf_release(buf);
+            *rx_buffer = buf = copy;
+        }
+        memset(mmbuf_append(buf, full_len - len), 0, full_len - len);
+    }
+
+    return mmbuf_get_data_start(buf);
 }
 
 static void mmagic_m2m_controller_event_rx_callback(struct mmagic_controller *controller,
@@ -820,9 +1281,12 @@ static void mmagic_m2m_controller_event_rx_callback(struct mmagic_controller *co
                     {
                         /** Event arguments structure for wlan_beacon_rx */
                         struct mmagic_wlan_beacon_rx_event_args *args =
-                            (struct mmagic_wlan_beacon_rx_event_args *)mmbuf_remove_from_start(
-                                rx_buffer,
-                                sizeof(*args));
+                            (struct mmagic_wlan_beacon_rx_event_args *)
+                                mmagic_controller_get_event_args(
+                                    &rx_buffer,
+                                    offsetof(struct mmagic_wlan_beacon_rx_event_args,
+                                             vendor_ies.data),
+                                    sizeof(*args));
                         if (args == NULL)
                         {
                             goto cleanup;
@@ -838,9 +1302,11 @@ static void mmagic_m2m_controller_event_rx_callback(struct mmagic_controller *co
                     {
                         /** Event arguments structure for wlan_sta_event */
                         struct mmagic_wlan_sta_event_event_args *args =
-                            (struct mmagic_wlan_sta_event_event_args *)mmbuf_remove_from_start(
-                                rx_buffer,
-                                sizeof(*args));
+                            (struct mmagic_wlan_sta_event_event_args *)
+                                mmagic_controller_get_event_args(
+                                    &rx_buffer,
+                                    sizeof(*args),
+                                    sizeof(*args));
                         if (args == NULL)
                         {
                             goto cleanup;
@@ -864,9 +1330,11 @@ static void mmagic_m2m_controller_event_rx_callback(struct mmagic_controller *co
                     {
                         /** Event arguments structure for ip_link_status */
                         struct mmagic_ip_link_status_event_args *args =
-                            (struct mmagic_ip_link_status_event_args *)mmbuf_remove_from_start(
-                                rx_buffer,
-                                sizeof(*args));
+                            (struct mmagic_ip_link_status_event_args *)
+                                mmagic_controller_get_event_args(
+                                    &rx_buffer,
+                                    sizeof(*args),
+                                    sizeof(*args));
                         if (args == NULL)
                         {
                             goto cleanup;
@@ -890,9 +1358,11 @@ static void mmagic_m2m_controller_event_rx_callback(struct mmagic_controller *co
                     {
                         /** Event arguments structure for socket_rx_ready */
                         struct mmagic_socket_rx_ready_event_args *args =
-                            (struct mmagic_socket_rx_ready_event_args *)mmbuf_remove_from_start(
-                                rx_buffer,
-                                sizeof(*args));
+                            (struct mmagic_socket_rx_ready_event_args *)
+                                mmagic_controller_get_event_args(
+                                    &rx_buffer,
+                                    sizeof(*args),
+                                    sizeof(*args));
                         if (args == NULL)
                         {
                             goto cleanup;
@@ -917,7 +1387,11 @@ static void mmagic_m2m_controller_event_rx_callback(struct mmagic_controller *co
                         /** Event arguments structure for mqtt_message_received */
                         struct mmagic_mqtt_message_received_event_args *args =
                             (struct mmagic_mqtt_message_received_event_args *)
-                                mmbuf_remove_from_start(rx_buffer, sizeof(*args));
+                                mmagic_controller_get_event_args(
+                                    &rx_buffer,
+                                    offsetof(struct mmagic_mqtt_message_received_event_args,
+                                             payload.data),
+                                    sizeof(*args));
                         if (args == NULL)
                         {
                             goto cleanup;
@@ -934,7 +1408,10 @@ static void mmagic_m2m_controller_event_rx_callback(struct mmagic_controller *co
                         /** Event arguments structure for mqtt_broker_connection */
                         struct mmagic_mqtt_broker_connection_event_args *args =
                             (struct mmagic_mqtt_broker_connection_event_args *)
-                                mmbuf_remove_from_start(rx_buffer, sizeof(*args));
+                                mmagic_controller_get_event_args(
+                                    &rx_buffer,
+                                    sizeof(*args),
+                                    sizeof(*args));
                         if (args == NULL)
                         {
                             goto cleanup;
@@ -959,13 +1436,29 @@ cleanup:
     mmbuf_release(rx_buffer);
 }
 
-enum mmagic_status mmagic_controller_tx(struct mmagic_controller *controller,
-                                        uint8_t stream_id,
-                                        uint8_t submodule_id,
-                                        uint8_t command_id,
-                                        uint8_t subcommand_id,
-                                        const uint8_t *buffer,
-                                        size_t buffer_length)
+/**
+ * Builds and sends a command to the agent.
+ *
+ * @param controller    Controller context.
+ * @param stream_id     The stream id to send this command on.
+ * @param submodule_id  The submodule to target with this command.
+ * @param command_id    The command.
+ * @param subcommand_id A sub command or resource id if applicable.
+ * @param buffer        A pointer to any data associated with this command. May be NULL if none.
+ * @param buffer_length Length of above data.
+ * @param pending       Command slot to mark as in flight.
+ *
+ * @returns @c MMAGIC_STATUS_OK on success, else an error code.
+ */
+static enum mmagic_status mmagic_controller_tx_command(
+    struct mmagic_controller *controller,
+    uint8_t stream_id,
+    uint8_t submodule_id,
+    uint8_t command_id,
+    uint8_t subcommand_id,
+    const uint8_t *buffer,
+    size_t buffer_length,
+    struct mmagic_controller_pending_cmd *pending)
 {
     if (buffer_length && buffer == NULL)
     {
@@ -994,7 +1487,190 @@ enum mmagic_status mmagic_controller_tx(struct mmagic_controller *controller,
         mmbuf_append_data(tx_buffer, buffer, buffer_length);
     }
 
-    return mmagic_llc_controller_tx(controller, MMAGIC_LLC_PTYPE_COMMAND, stream_id, tx_buffer);
+    return mmagic_llc_controller_tx(controller,
+                                    MMAGIC_LLC_PTYPE_COMMAND,
+                                    stream_id,
+                                    tx_buffer,
+                                    pending);
+}
+
+enum mmagic_status mmagic_controller_tx(struct mmagic_controller *controller,
+                                        uint8_t stream_id,
+                                        uint8_t submodule_id,
+                                        uint8_t command_id,
+                                        uint8_t subcommand_id,
+                                        const uint8_t *buffer,
+                                        size_t buffer_length)
+{
+    struct mmagic_controller_pending_cmd *pending;
+    struct mmbuf *stale_buffer = NULL;
+
+    if (stream_id >= MMAGIC_LLC_MAX_STREAMS)
+    {
+        return MMAGIC_STATUS_INVALID_STREAM;
+    }
+
+    /* Discard any response that was queued after an earlier command on this stream timed out. */
+    while (mmosal_queue_pop(controller->stream_queue[stream_id], &stale_buffer, 0))
+    {
+        mmbuf_release(stale_buffer);
+    }
+
+    mmosal_mutex_get(controller->pending.mutex, UINT32_MAX);
+    pending = &controller->pending.blocking[stream_id];
+    memset(pending, 0, sizeof(*pending));
+    pending->state = MMAGIC_CONTROLLER_PENDING_RESERVED;
+    pending->blocking = true;
+    pending->stream_id = stream_id;
+    pending->submodule_id = submodule_id;
+    pending->command_id = command_id;
+    pending->subcommand_id = subcommand_id;
+    /* mmagic_controller_rx() applies the timeout for blocking commands. */
+    pending->timeout_ms = UINT32_MAX;
+    mmosal_mutex_release(controller->pending.mutex);
+
+    return mmagic_controller_tx_command(controller,
+                                        stream_id,
+                                        submodule_id,
+                                        command_id,
+                                        subcommand_id,
+                                        buffer,
+                                        buffer_length,
+                                        pending);
+}
+
+enum mmagic_status mmagic_controller_tx_async(struct mmagic_controller *controller,
+                                              uint8_t stream_id,
+                                              uint8_t submodule_id,
+                                              uint8_t command_id,
+                                              uint8_t subcommand_id,
+                                              const uint8_t *buffer,
+                                              size_t buffer_length,
+                                              uint8_t *rsp_buffer,
+                                              size_t rsp_buffer_length,
+                                              uint32_t timeout_ms,
+                                              mmagic_controller_rsp_cb_t cb,
+                                              void *cb_arg,
+                                              uint32_t *tag)
+{
+    struct mmagic_controller_pending_cmd *pending = NULL;
+
+    if (stream_id >= MMAGIC_LLC_MAX_STREAMS)
+    {
+        return MMAGIC_STATUS_INVALID_STREAM;
+    }
+
+    if (rsp_buffer_length && rsp_buffer == NULL)
+    {
+        return MMAGIC_STATUS_INVALID_ARG;
+    }
+
+    mmosal_mutex_get(controller->pending.mutex, UINT32_MAX);
+    for (int ii = 0; ii < MMAGIC_CONTROLLER_MAX_IN_FLIGHT; ii++)
+    {
+        if (controller->pending.cmds[ii].state == MMAGIC_CONTROLLER_PENDING_FREE)
+        {
+            pending = &controller->pending.cmds[ii];
+            break;
+        }
+    }
+    if (pending != NULL)
+    {
+        memset(pending, 0, sizeof(*pending));
+        pending->state = MMAGIC_CONTROLLER_PENDING_RESERVED;
+        pending->stream_id = stream_id;
+        pending->submodule_id = submodule_id;
+        pending->command_id = command_id;
+        pending->subcommand_id = subcommand_id;
+        pending->rsp_buffer = rsp_buffer;
+        pending->rsp_buffer_length = rsp_buffer_length;
+        pending->timeout_ms = timeout_ms;
+        pending->cb = cb;
+        pending->cb_arg = cb_arg;
+
+        controller->pending.last_tag++;
+        if (controller->pending.last_tag == MMAGIC_CONTROLLER_INVALID_TAG)
+        {
+            controller->pending.last_tag++;
+        }
+        pending->tag = controller->pending.last_tag;
+    }
+    mmosal_mutex_release(controller->pending.mutex);
+
+    if (pending == NULL)
+    {
+        return MMAGIC_STATUS_UNAVAILABLE;
+    }
+
+    /* The tag is read before sending because the slot may be completed and reused as soon as
+     * the command is on the wire. */
+    uint32_t assigned_tag = pending->tag;
+    enum mmagic_status status = mmagic_controller_tx_command(controller,
+                                                             stream_id,
+                                                             submodule_id,
+                                                             command_id,
+                                                             subcommand_id,
+                                                             buffer,
+                                                             buffer_length,
+                                                             pending);
+    if (status != MMAGIC_STATUS_OK)
+    {
+        mmosal_mutex_get(controller->pending.mutex, UINT32_MAX);
+        pending->state = MMAGIC_CONTROLLER_PENDING_FREE;
+        mmosal_mutex_release(controller->pending.mutex);
+        return status;
+    }
+
+    if (tag != NULL)
+    {
+        *tag = assigned_tag;
+    }
+
+    return status;
+}
+
+enum mmagic_status mmagic_controller_cancel_async(struct mmagic_controller *controller,
+                                                  uint32_t tag)
+{
+    enum mmagic_status status = MMAGIC_STATUS_NOT_FOUND;
+
+    if (tag == MMAGIC_CONTROLLER_INVALID_TAG)
+    {
+        return MMAGIC_STATUS_INVALID_ARG;
+    }
+
+    mmosal_mutex_get(controller->pending.mutex, UINT32_MAX);
+    for (int ii = 0; ii < MMAGIC_CONTROLLER_MAX_IN_FLIGHT; ii++)
+    {
+        struct mmagic_controller_pending_cmd *cmd = &controller->pending.cmds[ii];
+        if (cmd->state == MMAGIC_CONTROLLER_PENDING_IN_FLIGHT && cmd->tag == tag)
+        {
+            cmd->state = MMAGIC_CONTROLLER_PENDING_FREE;
+            status = MMAGIC_STATUS_OK;
+            break;
+        }
+    }
+    mmosal_mutex_release(controller->pending.mutex);
+
+    return status;
+}
+
+uint32_t mmagic_controller_get_in_flight_count(struct mmagic_controller *controller)
+{
+    uint32_t count = 0;
+
+    mmosal_mutex_get(controller->pending.mutex, UINT32_MAX);
+    for (int ii = 0; ii < MMAGIC_CONTROLLER_MAX_IN_FLIGHT; ii++)
+    {
+        if (controller->pending.cmds[ii].state == MMAGIC_CONTROLLER_PENDING_RESERVED ||
+            controller->pending.cmds[ii].state == MMAGIC_CONTROLLER_PENDING_IN_FLIGHT)
+        {
+            count++;
+        }
+    }
+    mmosal_mutex_release(controller->pending.mutex);
+
+    return count;
 }
 
 enum mmagic_status mmagic_controller_agent_sync(struct mmagic_controller *controller,
@@ -1015,8 +1691,11 @@ enum mmagic_status mmagic_controller_agent_sync(struct mmagic_controller *contro
         return MMAGIC_STATUS_NO_MEM;
     }
 
-    enum mmagic_status status =
-        mmagic_llc_controller_tx(controller, MMAGIC_LLC_PTYPE_SYNC_REQ, CONTROL_STREAM, tx_buffer);
+    enum mmagic_status status = mmagic_llc_controller_tx(controller,
+                                                         MMAGIC_LLC_PTYPE_SYNC_REQ,
+                                                         CONTROL_STREAM,
+                                                         tx_buffer,
+                                                         NULL);
     if (status != MMAGIC_STATUS_OK)
     {
         return status;
@@ -1055,7 +1734,8 @@ enum mmagic_status mmagic_controller_request_agent_reset(struct mmagic_controlle
     return mmagic_llc_controller_tx(controller,
                                     MMAGIC_LLC_PTYPE_AGENT_RESET,
                                     CONTROL_STREAM,
-                                    tx_buffer);
+                                    tx_buffer,
+                                    NULL);
 }
 
 static struct mmagic_controller m2m_controller;
@@ -1080,6 +1760,30 @@ struct mmagic_controller *mmagic_controller_init(const struct mmagic_controller_
         return NULL;
     }
 
+    controller->pending.mutex = mmosal_mutex_create("mmagic_controller_pending");
+    if (controller->pending.mutex == NULL)
+    {
+        mmosal_mutex_delete(controller->tx_mutex);
+        return NULL;
+    }
+
+    controller->pending.timer = mmosal_timer_create("mmagic_controller_pending",
+                                                    MMAGIC_CONTROLLER_PENDING_POLL_MS,
+                                                    true,
+                                                    controller,
+                                                    mmagic_controller_pending_timer_cb);
+    if (controller->pending.timer == NULL)
+    {
+        mmosal_mutex_delete(controller->pending.mutex);
+        mmosal_mutex_delete(controller->tx_mutex);
+        return NULL;
+    }
+
+    for (int ii = 0; ii < MMAGIC_LLC_MAX_STREAMS; ii++)
+    {
+        controller->pending.next_rx_seq[ii] = 1;
+    }
+
     /* Create queues */
     for (int ii = 0; ii < MMAGIC_LLC_MAX_STREAMS; ii++)
     {
@@ -1110,6 +1814,9 @@ error:
     {
         mmosal_queue_delete(controller->stream_queue[ii]);
     }
+    mmosal_timer_delete(controller->pending.timer);
+    mmosal_mutex_delete(controller->pending.mutex);
+    mmosal_mutex_delete(controller->tx_mutex);
     return NULL;
 }
 
@@ -1122,4 +1829,8 @@ void mmagic_controller_deinit(struct mmagic_controller *controller)
     }
 
     mmagic_datalink_controller_deinit(controller->controller_llc.controller_dl);
+
+    mmosal_timer_delete(controller->pending.timer);
+    mmosal_mutex_delete(controller->pending.mutex);
+    mmosal_mutex_delete(controller->tx_mutex);
 }
@@ -495,6 +495,33 @@ struct MM_PACKED struct_iperf_status
     uint32_t bandwidth_kbitpsec;
 };
 
+/** Data structure to store host interface bus benchmark results. */
+struct MM_PACKED struct_bus_benchmark_result
+{
+    /** Number of loopback packets sent to the chip. */
+    uint32_t num_sent;
+    /** Number of loopback packets received back from the chip. */
+    uint32_t num_received;
+    /** Duration of the benchmark in milliseconds. */
+    uint32_t duration_ms;
+    /** Loopback payload throughput in bytes per second. */
+    uint32_t throughput_bytes_per_s;
+    /** Loopback packets completed per second. */
+    uint32_t pkts_per_s;
+    /** Minimum round trip latency of a loopback packet in microseconds. */
+    uint32_t latency_min_us;
+    /** Median round trip latency of a loopback packet in microseconds. */
+    uint32_t latency_p50_us;
+    /** 90th percentile round trip latency of a loopback packet in microseconds. */
+    uint32_t latency_p90_us;
+    /** 99th percentile round trip latency of a loopback packet in microseconds. */
+    uint32_t latency_p99_us;
+    /** Maximum round trip latency of a loopback packet in microseconds. */
+    uint32_t latency_max_us;
+    /** Time in milliseconds that the driver task spent processing during the run. */
+    uint32_t driver_busy_ms;
+};
+
 /** Generic 64 byte buffer. */
 struct MM_PACKED struct_buffer64
 {
@@ -653,6 +680,98 @@ enum mmagic_status mmagic_controller_rx(struct mmagic_controller *controller,
                                         size_t buffer_length,
                                         uint32_t timeout_ms);
 
+/** The maximum number of asynchronous commands that may be awaiting a response at any time. */
+#define MMAGIC_CONTROLLER_MAX_IN_FLIGHT 8
+
+/**
+ * Prototype for callback function invoked when an asynchronous command completes.
+ *
+ * @note This function will be invoked in the context of the controller data link thread, or of
+ *       the timer task if the command timed out, and should perform minimal processing.
+ *
+ * @warning This function must not invoke any mmagic API functions.
+ *
+ * @param controller    Controller context.
+ * @param tag           The tag that was assigned to the command when it was sent.
+ * @param status        @c MMAGIC_STATUS_OK if the command succeeded and the response buffer has
+ *                      been filled out, else an error code.
+ * @param arg           Opaque argument that was provided when the command was sent.
+ */
+typedef void (*mmagic_controller_rsp_cb_t)(struct mmagic_controller *controller,
+                                           uint32_t tag,
+                                           enum mmagic_status status,
+                                           void *arg);
+
+/**
+ * Sends a command to the agent without waiting for the response.
+ *
+ * Responses on a given stream are returned by the agent in the order the commands were sent.
+ * The controller numbers the commands on each stream, both blocking and asynchronous, and matches
+ * each response to its command by number, so the two may be mixed on a stream. Commands on
+ * different streams are executed concurrently by the agent.
+ *
+ * @param controller        Controller context.
+ * @param stream_id         The stream id to send this command on.
+ * @param submodule_id      The submodule to target with this command.
+ * @param command_id        The command.
+ * @param subcommand_id     A sub command or resource id if applicable.
+ * @param buffer            A pointer to any data associated with this command. This is copied
+ *                          before this function returns. May be NULL if none.
+ * @param buffer_length     Length of above data.
+ * @param rsp_buffer        A pointer to a buffer to load with any returned data. This must
+ *                          remain valid until @p cb has been invoked. May be NULL if none.
+ * @param rsp_buffer_length Length of above buffer.
+ * @param timeout_ms        The time in milliseconds to wait for the response before @p cb is
+ *                          invoked with @c MMAGIC_STATUS_TIMEOUT, set to @c UINT32_MAX for an
+ *                          indefinite wait.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param tag               If not NULL, set to the tag assigned to this command. Note that
+ *                          @p cb may be invoked before this function returns.
+ *
+ * @return @c MMAGIC_STATUS_OK on success, @c MMAGIC_STATUS_UNAVAILABLE if
+ *         @ref MMAGIC_CONTROLLER_MAX_IN_FLIGHT commands are already outstanding,
+ *         else an error code.
+ */
+enum mmagic_status mmagic_controller_tx_async(struct mmagic_controller *controller,
+                                              uint8_t stream_id,
+                                              uint8_t submodule_id,
+                                              uint8_t command_id,
+                                              uint8_t subcommand_id,
+                                              const uint8_t *buffer,
+                                              size_t buffer_length,
+                                              uint8_t *rsp_buffer,
+                                              size_t rsp_buffer_length,
+                                              uint32_t timeout_ms,
+                                              mmagic_controller_rsp_cb_t cb,
+                                              void *cb_arg,
+                                              uint32_t *tag);
+
+/**
+ * Cancels an outstanding asynchronous command.
+ *
+ * The completion callback will not be invoked and the response buffer will not be written
+ * after this function returns. The in-flight slot is released straight away and the response
+ * is discarded if it arrives later.
+ *
+ * @param controller    Controller context.
+ * @param tag           The tag of the command to cancel.
+ *
+ * @return @c MMAGIC_STATUS_OK on success, @c MMAGIC_STATUS_NOT_FOUND if no command with the
+ *         given tag is outstanding.
+ */
+enum mmagic_status mmagic_controller_cancel_async(struct mmagic_controller *controller,
+                                                  uint32_t tag);
+
+/**
+ * Gets the number of asynchronous commands currently awaiting a response.
+ *
+ * @param controller    Controller context.
+ *
+ * @return the number of outstanding commands.
+ */
+uint32_t mmagic_controller_get_in_flight_count(struct mmagic_controller *controller);
+
 /**
  * Sends a sync request to the agent and waits for a sync response.
  *
@@ -821,6 +940,10 @@ enum mmagic_wlan_cmd
     MMAGIC_WLAN_CMD_DPP_PUSH_BUTTON_START = 22,
     /** Instructs the WLAN device to abort the ongoing DPP session. */
     MMAGIC_WLAN_CMD_DPP_STOP = 23,
+    /** Runs a loopback benchmark of the host interface bus. Packets are streamed through the
+     * normal driver transmit and receive path to the chip, which returns them unmodified. The WLAN
+     * interface must be up. */
+    MMAGIC_WLAN_CMD_BUS_BENCHMARK = 24,
 };
 
 /** ip configuration variable IDs */
@@ -3359,6 +3482,57 @@ static inline enum mmagic_status mmagic_controller_wlan_connect(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_wlan_connect.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_wlan_connect_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_wlan_connect_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    /* Account for the timeout argument when waiting for the response and make sure no overflow. */
+    if (UINT32_MAX - response_timeout_ms >= cmd_args->timeout)
+    {
+        response_timeout_ms += cmd_args->timeout;
+    }
+    else
+    {
+        response_timeout_ms = UINT32_MAX;
+    }
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_CONNECT,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /**
  * Disconnects and brings down the WLAN interface.
  *
@@ -3395,6 +3569,45 @@ static inline enum mmagic_status mmagic_controller_wlan_disconnect(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_wlan_disconnect.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_wlan_disconnect_async(
+    struct mmagic_controller *controller,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_DISCONNECT,
+                                      0,
+                                      NULL,
+                                      0,
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for wlan_scan */
 struct MM_PACKED mmagic_core_wlan_scan_cmd_args
 {
@@ -3464,6 +3677,60 @@ static inline enum mmagic_status mmagic_controller_wlan_scan(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_wlan_scan.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_wlan_scan_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_wlan_scan_cmd_args *cmd_args,
+    struct mmagic_core_wlan_scan_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    /* Account for the timeout argument when waiting for the response and make sure no overflow. */
+    if (UINT32_MAX - response_timeout_ms >= cmd_args->timeout)
+    {
+        response_timeout_ms += cmd_args->timeout;
+    }
+    else
+    {
+        response_timeout_ms = UINT32_MAX;
+    }
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_SCAN,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Response arguments structure for wlan_get_rssi */
 struct MM_PACKED mmagic_core_wlan_get_rssi_rsp_args
 {
@@ -3511,6 +3778,48 @@ static inline enum mmagic_status mmagic_controller_wlan_get_rssi(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_wlan_get_rssi.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_wlan_get_rssi_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_wlan_get_rssi_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_GET_RSSI,
+                                      0,
+                                      NULL,
+                                      0,
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Response arguments structure for wlan_get_mac_addr */
 struct MM_PACKED mmagic_core_wlan_get_mac_addr_rsp_args
 {
@@ -3558,6 +3867,48 @@ static inline enum mmagic_status mmagic_controller_wlan_get_mac_addr(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_wlan_get_mac_addr.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_wlan_get_mac_addr_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_wlan_get_mac_addr_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_GET_MAC_ADDR,
+                                      0,
+                                      NULL,
+                                      0,
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for wlan_wnm_sleep */
 struct MM_PACKED mmagic_core_wlan_wnm_sleep_cmd_args
 {
@@ -3603,6 +3954,47 @@ static inline enum mmagic_status mmagic_controller_wlan_wnm_sleep(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_wlan_wnm_sleep.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_wlan_wnm_sleep_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_wlan_wnm_sleep_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_WNM_SLEEP,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for wlan_beacon_monitor_enable */
 struct MM_PACKED mmagic_core_wlan_beacon_monitor_enable_cmd_args
 {
@@ -3649,6 +4041,47 @@ static inline enum mmagic_status mmagic_controller_wlan_beacon_monitor_enable(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_wlan_beacon_monitor_enable.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_wlan_beacon_monitor_enable_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_wlan_beacon_monitor_enable_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_BEACON_MONITOR_ENABLE,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /**
  * Disable beacon monitoring. If beacon monitor is not enabled then this has no effect.
  *
@@ -3685,6 +4118,45 @@ static inline enum mmagic_status mmagic_controller_wlan_beacon_monitor_disable(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_wlan_beacon_monitor_disable.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_wlan_beacon_monitor_disable_async(
+    struct mmagic_controller *controller,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_BEACON_MONITOR_DISABLE,
+                                      0,
+                                      NULL,
+                                      0,
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Response arguments structure for wlan_get_sta_status */
 struct MM_PACKED mmagic_core_wlan_get_sta_status_rsp_args
 {
@@ -3732,6 +4204,48 @@ static inline enum mmagic_status mmagic_controller_wlan_get_sta_status(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_wlan_get_sta_status.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_wlan_get_sta_status_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_wlan_get_sta_status_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = 3000;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_GET_STA_STATUS,
+                                      0,
+                                      NULL,
+                                      0,
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /**
  * Instructs the WLAN device to start the Device Provisioning Protocol (DPP) Push Button (PB)
  * provisioning process. SSID and password will be automatically copied to wlan.ssid and
@@ -3770,6 +4284,45 @@ static inline enum mmagic_status mmagic_controller_wlan_dpp_push_button_start(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_wlan_dpp_push_button_start.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_wlan_dpp_push_button_start_async(
+    struct mmagic_controller *controller,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_DPP_PUSH_BUTTON_START,
+                                      0,
+                                      NULL,
+                                      0,
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /**
  * Instructs the WLAN device to abort the ongoing DPP session.
  *
@@ -3806,84 +4359,252 @@ static inline enum mmagic_status mmagic_controller_wlan_dpp_stop(
     return status;
 }
 
-/** Event arguments structure for wlan_beacon_rx */
-struct MM_PACKED mmagic_wlan_beacon_rx_event_args
-{
-    /** Raw octet string of Vendor Information Elements contained in the beacon. Only the IEs that
-     * match the configured filters are returned. If multiple matching IEs are present then they are
-     * concatenated in the buffer. Each IE is a TLV where the first byte is the Tag (0xDD for Vendor
-     * Specific IE), followed by a byte specifying the length IE contents (i.e., excluding the Tag
-     * and Length). */
-    struct raw1536 vendor_ies;
-};
-
-/**
- * Handler for the wlan-beacon_rx event.
- *
- * Triggered when a beacon matching the configured beacon monitor filter(s) is received.
- *
- * @note This function will be invoked in the context of the controller data link thread
- *       and should perform minimal processing.
- *
- * @warning This function must not invoke any mmagic API functions.
- *
- * @param event_args  Notification arguments received from the agent.
- * @param arg         Opaque argument that was provided when the callback was registered.
- */
-typedef void (*mmagic_wlan_beacon_rx_event_handler_t)(
-    const struct mmagic_wlan_beacon_rx_event_args *event_args,
-    void *arg);
-
 /**
- * Register a handler for the wlan-beacon_rx event.
- *
- * Triggered when a beacon matching the configured beacon monitor filter(s) is received.
+ * Asynchronous variant of @ref mmagic_controller_wlan_dpp_stop.
  *
- * @note The handler callbacks will be invoked in the context of the controller data link
- *       thread. The handler should perform minimal processing.
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
  *
- * @warning The handler callback must not invoke any mmagic API functions.
+ * @param controller        Reference to the controller handle.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
  *
- * @param controller    Reference to the the controller handle.
- * @param handler       The handler function to register.
- * @param arg           Opaque argument to be passed to the handler when it is invoked.
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
  */
-void mmagic_controller_register_wlan_beacon_rx_handler(
+static inline enum mmagic_status mmagic_controller_wlan_dpp_stop_async(
     struct mmagic_controller *controller,
-    mmagic_wlan_beacon_rx_event_handler_t handler,
-    void *arg);
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
 
-/** Event arguments structure for wlan_sta_event */
-struct MM_PACKED mmagic_wlan_sta_event_event_args
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_DPP_STOP,
+                                      0,
+                                      NULL,
+                                      0,
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
+/** Command arguments structure for wlan_bus_benchmark */
+struct MM_PACKED mmagic_core_wlan_bus_benchmark_cmd_args
+{
+    /** Length of each loopback packet in octets. 0 to use the maximum supported length. */
+    uint32_t pkt_len;
+    /** Number of packets to send. 0 to use the default. */
+    uint32_t num_pkts;
+    /** Maximum number of packets that may be in flight at once. 0 to use the default. */
+    uint32_t batch_depth;
+    /** Maximum duration in milliseconds to wait for the benchmark to complete. 0 to use the
+     * default. */
+    uint32_t timeout;
+};
+
+/** Response arguments structure for wlan_bus_benchmark */
+struct MM_PACKED mmagic_core_wlan_bus_benchmark_rsp_args
 {
-    /** The reported WLAN STA evt. */
-    enum mmagic_sta_event event;
+    /** Reference to structure to store the results of the benchmark. */
+    struct struct_bus_benchmark_result result;
 };
 
 /**
- * Handler for the wlan-sta_event event.
- *
- * Triggered when STA event occurs when in STA mode.
- *
- * @note This function will be invoked in the context of the controller data link thread
- *       and should perform minimal processing.
+ * Runs a loopback benchmark of the host interface bus. Packets are streamed through the normal
+ * driver transmit and receive path to the chip, which returns them unmodified. The WLAN interface
+ * must be up.
  *
- * @warning This function must not invoke any mmagic API functions.
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          If the return code is not @c MMAGIC_STATUS_OK then the
+ *                          contents of this structure will be undefined.
  *
- * @param event_args  Notification arguments received from the agent.
- * @param arg         Opaque argument that was provided when the callback was registered.
+ * @return @c MMAGIC_STATUS_OK else an appropriate error code.
  */
-typedef void (*mmagic_wlan_sta_event_event_handler_t)(
-    const struct mmagic_wlan_sta_event_event_args *event_args,
-    void *arg);
+static inline enum mmagic_status mmagic_controller_wlan_bus_benchmark(
+    struct mmagic_controller *controller,
+    struct mmagic_core_wlan_bus_benchmark_cmd_args *cmd_args,
+    struct mmagic_core_wlan_bus_benchmark_rsp_args *rsp_args)
+{
+    enum mmagic_status status;
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = 10000;
 
-/**
- * Register a handler for the wlan-sta_event event.
- *
- * Triggered when STA event occurs when in STA mode.
- *
- * @note The handler callbacks will be invoked in the context of the controller data link
- *       thread. The handler should perform minimal processing.
+    /* Account for the timeout argument when waiting for the response and make sure no overflow. */
+    if (UINT32_MAX - response_timeout_ms >= cmd_args->timeout)
+    {
+        response_timeout_ms += cmd_args->timeout;
+    }
+    else
+    {
+        response_timeout_ms = UINT32_MAX;
+    }
+
+    status = mmagic_controller_tx(controller,
+                                  stream_id,
+                                  MMAGIC_WLAN,
+                                  MMAGIC_WLAN_CMD_BUS_BENCHMARK,
+                                  0,
+                                  (uint8_t *)cmd_args,
+                                  sizeof(*cmd_args));
+    if (status != MMAGIC_STATUS_OK)
+    {
+        return status;
+    }
+    status = mmagic_controller_rx(controller,
+                                  stream_id,
+                                  MMAGIC_WLAN,
+                                  MMAGIC_WLAN_CMD_BUS_BENCHMARK,
+                                  0,
+                                  (uint8_t *)rsp_args,
+                                  sizeof(*rsp_args),
+                                  response_timeout_ms);
+    return status;
+}
+
+/**
+ * Asynchronous variant of @ref mmagic_controller_wlan_bus_benchmark.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_wlan_bus_benchmark_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_wlan_bus_benchmark_cmd_args *cmd_args,
+    struct mmagic_core_wlan_bus_benchmark_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = 10000;
+
+    /* Account for the timeout argument when waiting for the response and make sure no overflow. */
+    if (UINT32_MAX - response_timeout_ms >= cmd_args->timeout)
+    {
+        response_timeout_ms += cmd_args->timeout;
+    }
+    else
+    {
+        response_timeout_ms = UINT32_MAX;
+    }
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_WLAN,
+                                      MMAGIC_WLAN_CMD_BUS_BENCHMARK,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
+/** Event arguments structure for wlan_beacon_rx */
+struct MM_PACKED mmagic_wlan_beacon_rx_event_args
+{
+    /** Raw octet string of Vendor Information Elements contained in the beacon. Only the IEs that
+     * match the configured filters are returned. If multiple matching IEs are present then they are
+     * concatenated in the buffer. Each IE is a TLV where the first byte is the Tag (0xDD for Vendor
+     * Specific IE), followed by a byte specifying the length IE contents (i.e., excluding the Tag
+     * and Length). */
+    struct raw1536 vendor_ies;
+};
+
+/**
+ * Handler for the wlan-beacon_rx event.
+ *
+ * Triggered when a beacon matching the configured beacon monitor filter(s) is received.
+ *
+ * @note This function will be invoked in the context of the controller data link thread
+ *       and should perform minimal processing.
+ *
+ * @warning This function must not invoke any mmagic API functions.
+ *
+ * @param event_args  Notification arguments received from the agent.
+ * @param arg         Opaque argument that was provided when the callback was registered.
+ */
+typedef void (*mmagic_wlan_beacon_rx_event_handler_t)(
+    const struct mmagic_wlan_beacon_rx_event_args *event_args,
+    void *arg);
+
+/**
+ * Register a handler for the wlan-beacon_rx event.
+ *
+ * Triggered when a beacon matching the configured beacon monitor filter(s) is received.
+ *
+ * @note The handler callbacks will be invoked in the context of the controller data link
+ *       thread. The handler should perform minimal processing.
+ *
+ * @warning The handler callback must not invoke any mmagic API functions.
+ *
+ * @param controller    Reference to the the controller handle.
+ * @param handler       The handler function to register.
+ * @param arg           Opaque argument to be passed to the handler when it is invoked.
+ */
+void mmagic_controller_register_wlan_beacon_rx_handler(
+    struct mmagic_controller *controller,
+    mmagic_wlan_beacon_rx_event_handler_t handler,
+    void *arg);
+
+/** Event arguments structure for wlan_sta_event */
+struct MM_PACKED mmagic_wlan_sta_event_event_args
+{
+    /** The reported WLAN STA evt. */
+    enum mmagic_sta_event event;
+};
+
+/**
+ * Handler for the wlan-sta_event event.
+ *
+ * Triggered when STA event occurs when in STA mode.
+ *
+ * @note This function will be invoked in the context of the controller data link thread
+ *       and should perform minimal processing.
+ *
+ * @warning This function must not invoke any mmagic API functions.
+ *
+ * @param event_args  Notification arguments received from the agent.
+ * @param arg         Opaque argument that was provided when the callback was registered.
+ */
+typedef void (*mmagic_wlan_sta_event_event_handler_t)(
+    const struct mmagic_wlan_sta_event_event_args *event_args,
+    void *arg);
+
+/**
+ * Register a handler for the wlan-sta_event event.
+ *
+ * Triggered when STA event occurs when in STA mode.
+ *
+ * @note The handler callbacks will be invoked in the context of the controller data link
+ *       thread. The handler should perform minimal processing.
  *
  * @warning The handler callback must not invoke any mmagic API functions.
  *
@@ -4523,6 +5244,48 @@ static inline enum mmagic_status mmagic_controller_ip_status(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_ip_status.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_ip_status_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_ip_status_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_IP,
+                                      MMAGIC_IP_CMD_STATUS,
+                                      0,
+                                      NULL,
+                                      0,
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /**
  * Reloads the IP stack network configuration based on the current values in the subsystem config.
  *
@@ -4553,6 +5316,45 @@ static inline enum mmagic_status mmagic_controller_ip_reload(struct mmagic_contr
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_ip_reload.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_ip_reload_async(
+    struct mmagic_controller *controller,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_IP,
+                                      MMAGIC_IP_CMD_RELOAD,
+                                      0,
+                                      NULL,
+                                      0,
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Event arguments structure for ip_link_status */
 struct MM_PACKED mmagic_ip_link_status_event_args
 {
@@ -4910,6 +5712,48 @@ static inline enum mmagic_status mmagic_controller_ping_run(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_ping_run.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_ping_run_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_ping_run_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = -1;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_PING,
+                                      MMAGIC_PING_CMD_RUN,
+                                      0,
+                                      NULL,
+                                      0,
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** @} */
 
 /**
@@ -5303,6 +6147,48 @@ static inline enum mmagic_status mmagic_controller_iperf_run(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_iperf_run.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_iperf_run_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_iperf_run_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = -1;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_IPERF,
+                                      MMAGIC_IPERF_CMD_RUN,
+                                      0,
+                                      NULL,
+                                      0,
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** @} */
 
 /**
@@ -5371,6 +6257,47 @@ static inline enum mmagic_status mmagic_controller_sys_deep_sleep(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_sys_deep_sleep.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_sys_deep_sleep_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_sys_deep_sleep_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SYS,
+                                      MMAGIC_SYS_CMD_DEEP_SLEEP,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Response arguments structure for sys_get_version */
 struct MM_PACKED mmagic_core_sys_get_version_rsp_args
 {
@@ -5418,6 +6345,48 @@ static inline enum mmagic_status mmagic_controller_sys_get_version(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_sys_get_version.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_sys_get_version_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_sys_get_version_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SYS,
+                                      MMAGIC_SYS_CMD_GET_VERSION,
+                                      0,
+                                      NULL,
+                                      0,
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for sys_get_stats */
 struct MM_PACKED mmagic_core_sys_get_stats_cmd_args
 {
@@ -5476,6 +6445,50 @@ static inline enum mmagic_status mmagic_controller_sys_get_stats(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_sys_get_stats.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_sys_get_stats_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_sys_get_stats_cmd_args *cmd_args,
+    struct mmagic_core_sys_get_stats_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SYS,
+                                      MMAGIC_SYS_CMD_GET_STATS,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** @} */
 
 /**
@@ -5546,6 +6559,50 @@ static inline enum mmagic_status mmagic_controller_socket_connect(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_socket_connect.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_socket_connect_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_socket_connect_cmd_args *cmd_args,
+    struct mmagic_core_socket_connect_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = 15000;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SOCKET,
+                                      MMAGIC_SOCKET_CMD_CONNECT,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for socket_bind */
 struct MM_PACKED mmagic_core_socket_bind_cmd_args
 {
@@ -5604,6 +6661,50 @@ static inline enum mmagic_status mmagic_controller_socket_bind(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_socket_bind.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_socket_bind_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_socket_bind_cmd_args *cmd_args,
+    struct mmagic_core_socket_bind_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SOCKET,
+                                      MMAGIC_SOCKET_CMD_BIND,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for socket_recv */
 struct MM_PACKED mmagic_core_socket_recv_cmd_args
 {
@@ -5674,6 +6775,60 @@ static inline enum mmagic_status mmagic_controller_socket_recv(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_socket_recv.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_socket_recv_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_socket_recv_cmd_args *cmd_args,
+    struct mmagic_core_socket_recv_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = cmd_args->stream_id;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    /* Account for the timeout argument when waiting for the response and make sure no overflow. */
+    if (UINT32_MAX - response_timeout_ms >= cmd_args->timeout)
+    {
+        response_timeout_ms += cmd_args->timeout;
+    }
+    else
+    {
+        response_timeout_ms = UINT32_MAX;
+    }
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SOCKET,
+                                      MMAGIC_SOCKET_CMD_RECV,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for socket_send */
 struct MM_PACKED mmagic_core_socket_send_cmd_args
 {
@@ -5721,6 +6876,47 @@ static inline enum mmagic_status mmagic_controller_socket_send(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_socket_send.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_socket_send_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_socket_send_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = cmd_args->stream_id;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SOCKET,
+                                      MMAGIC_SOCKET_CMD_SEND,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for socket_read_poll */
 struct MM_PACKED mmagic_core_socket_read_poll_cmd_args
 {
@@ -5778,6 +6974,57 @@ static inline enum mmagic_status mmagic_controller_socket_read_poll(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_socket_read_poll.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_socket_read_poll_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_socket_read_poll_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = cmd_args->stream_id;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    /* Account for the timeout argument when waiting for the response and make sure no overflow. */
+    if (UINT32_MAX - response_timeout_ms >= cmd_args->timeout)
+    {
+        response_timeout_ms += cmd_args->timeout;
+    }
+    else
+    {
+        response_timeout_ms = UINT32_MAX;
+    }
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SOCKET,
+                                      MMAGIC_SOCKET_CMD_READ_POLL,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for socket_write_poll */
 struct MM_PACKED mmagic_core_socket_write_poll_cmd_args
 {
@@ -5835,6 +7082,57 @@ static inline enum mmagic_status mmagic_controller_socket_write_poll(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_socket_write_poll.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_socket_write_poll_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_socket_write_poll_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = cmd_args->stream_id;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    /* Account for the timeout argument when waiting for the response and make sure no overflow. */
+    if (UINT32_MAX - response_timeout_ms >= cmd_args->timeout)
+    {
+        response_timeout_ms += cmd_args->timeout;
+    }
+    else
+    {
+        response_timeout_ms = UINT32_MAX;
+    }
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SOCKET,
+                                      MMAGIC_SOCKET_CMD_WRITE_POLL,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for socket_accept */
 struct MM_PACKED mmagic_core_socket_accept_cmd_args
 {
@@ -5891,6 +7189,50 @@ static inline enum mmagic_status mmagic_controller_socket_accept(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_socket_accept.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_socket_accept_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_socket_accept_cmd_args *cmd_args,
+    struct mmagic_core_socket_accept_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = cmd_args->stream_id;
+    uint32_t response_timeout_ms = -1;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SOCKET,
+                                      MMAGIC_SOCKET_CMD_ACCEPT,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for socket_close */
 struct MM_PACKED mmagic_core_socket_close_cmd_args
 {
@@ -5936,6 +7278,47 @@ static inline enum mmagic_status mmagic_controller_socket_close(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_socket_close.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_socket_close_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_socket_close_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SOCKET,
+                                      MMAGIC_SOCKET_CMD_CLOSE,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for socket_set_rx_ready_evt_enabled */
 struct MM_PACKED mmagic_core_socket_set_rx_ready_evt_enabled_cmd_args
 {
@@ -5984,6 +7367,47 @@ static inline enum mmagic_status mmagic_controller_socket_set_rx_ready_evt_enabl
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_socket_set_rx_ready_evt_enabled.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_socket_set_rx_ready_evt_enabled_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_socket_set_rx_ready_evt_enabled_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_SOCKET,
+                                      MMAGIC_SOCKET_CMD_SET_RX_READY_EVT_ENABLED,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Event arguments structure for socket_rx_ready */
 struct MM_PACKED mmagic_socket_rx_ready_event_args
 {
@@ -6459,6 +7883,45 @@ static inline enum mmagic_status mmagic_controller_ntp_sync(struct mmagic_contro
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_ntp_sync.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_ntp_sync_async(
+    struct mmagic_controller *controller,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_NTP,
+                                      MMAGIC_NTP_CMD_SYNC,
+                                      0,
+                                      NULL,
+                                      0,
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Response arguments structure for ntp_get_time */
 struct MM_PACKED mmagic_core_ntp_get_time_rsp_args
 {
@@ -6506,6 +7969,48 @@ static inline enum mmagic_status mmagic_controller_ntp_get_time(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_ntp_get_time.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_ntp_get_time_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_ntp_get_time_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_NTP,
+                                      MMAGIC_NTP_CMD_GET_TIME,
+                                      0,
+                                      NULL,
+                                      0,
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** @} */
 
 /**
@@ -6693,6 +8198,50 @@ static inline enum mmagic_status mmagic_controller_mqtt_start_agent(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_mqtt_start_agent.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param[out] rsp_args     Pointer to the data structure to be filled out with the result.
+ *                          This must remain valid until @p cb has been invoked.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_mqtt_start_agent_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_mqtt_start_agent_cmd_args *cmd_args,
+    struct mmagic_core_mqtt_start_agent_rsp_args *rsp_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_MQTT,
+                                      MMAGIC_MQTT_CMD_START_AGENT,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      (uint8_t *)rsp_args,
+                                      sizeof(*rsp_args),
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for mqtt_publish */
 struct MM_PACKED mmagic_core_mqtt_publish_cmd_args
 {
@@ -6744,6 +8293,47 @@ static inline enum mmagic_status mmagic_controller_mqtt_publish(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_mqtt_publish.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_mqtt_publish_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_mqtt_publish_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_MQTT,
+                                      MMAGIC_MQTT_CMD_PUBLISH,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for mqtt_subscribe */
 struct MM_PACKED mmagic_core_mqtt_subscribe_cmd_args
 {
@@ -6793,6 +8383,47 @@ static inline enum mmagic_status mmagic_controller_mqtt_subscribe(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_mqtt_subscribe.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_mqtt_subscribe_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_mqtt_subscribe_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = MMAGIC_CONTROLLER_DEFAULT_RESPONSE_TIMEOUT_MS;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_MQTT,
+                                      MMAGIC_MQTT_CMD_SUBSCRIBE,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Command arguments structure for mqtt_stop_agent */
 struct MM_PACKED mmagic_core_mqtt_stop_agent_cmd_args
 {
@@ -6838,6 +8469,47 @@ static inline enum mmagic_status mmagic_controller_mqtt_stop_agent(
     return status;
 }
 
+/**
+ * Asynchronous variant of @ref mmagic_controller_mqtt_stop_agent.
+ *
+ * Sends the command and returns without waiting for the response. @p cb is invoked once the
+ * response has been received, or with @c MMAGIC_STATUS_TIMEOUT if it does not arrive within the
+ * time that the blocking variant waits.
+ *
+ * @param controller        Reference to the controller handle.
+ * @param[in] cmd_args      Command arguments. These are copied before this function returns.
+ * @param cb                Callback to invoke on completion. May be NULL.
+ * @param cb_arg            Opaque argument to pass to @p cb.
+ * @param[out] tag          If not NULL, set to the tag assigned to this command.
+ *
+ * @return @c MMAGIC_STATUS_OK if the command was sent, @c MMAGIC_STATUS_UNAVAILABLE if too many
+ *         commands are in flight, else an appropriate error code.
+ */
+static inline enum mmagic_status mmagic_controller_mqtt_stop_agent_async(
+    struct mmagic_controller *controller,
+    struct mmagic_core_mqtt_stop_agent_cmd_args *cmd_args,
+    mmagic_controller_rsp_cb_t cb,
+    void *cb_arg,
+    uint32_t *tag)
+{
+    const uint8_t stream_id = CONTROL_STREAM;
+    uint32_t response_timeout_ms = 5000;
+
+    return mmagic_controller_tx_async(controller,
+                                      stream_id,
+                                      MMAGIC_MQTT,
+                                      MMAGIC_MQTT_CMD_STOP_AGENT,
+                                      0,
+                                      (uint8_t *)cmd_args,
+                                      sizeof(*cmd_args),
+                                      NULL,
+                                      0,
+                                      response_timeout_ms,
+                                      cb,
+                                      cb_arg,
+                                      tag);
+}
+
 /** Event arguments structure for mqtt_message_received */
 struct MM_PACKED mmagic_mqtt_message_received_event_args
 {
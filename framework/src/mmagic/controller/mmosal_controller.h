@@ -138,6 +138,111 @@ bool mmosal_queue_pop(struct mmosal_queue *queue, void *item, uint32_t timeout_m
  */
 bool mmosal_queue_push(struct mmosal_queue *queue, const void *item, uint32_t timeout_ms);
 
+/**
+ * @}
+ */
+
+/*
+ * ---------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @defgroup MMOSAL_TIME Time
+ *
+ * Provides support for reading the system time.
+ *
+ * @{
+ */
+
+/**
+ * Get the system time in milliseconds.
+ *
+ * @returns the system time in milliseconds.
+ */
+uint32_t mmosal_get_time_ms(void);
+
+/**
+ * @}
+ */
+
+/*
+ * ---------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @defgroup MMOSAL_TIMER Timers
+ *
+ * Provides support for RTOS timers.
+ *
+ * @{
+ */
+
+/** Timer opaque handler data type. */
+struct mmosal_timer;
+
+/**
+ * Function type definition for timer callbacks.
+ *
+ * @param timer     The timer that triggered the callback.
+ */
+typedef void (*timer_callback_t)(struct mmosal_timer *timer);
+
+/**
+ * Create a new timer.
+ *
+ * @param name              The name for the timer.
+ * @param timer_period_ms   The period of the timer in milliseconds.
+ * @param auto_reload       If @c true then the timer will automatically be reloaded when
+ *                          it expires.
+ * @param arg               Void pointer that can be used to store a value for the timer callback.
+ *                          Pass NULL if unused.
+ * @param callback          Callback to be triggered when the timer expires.
+ *
+ * @returns an opaque handle to the timer, or @c NULL on failure.
+ *
+ * @warning Ensure that the timer callback function does not block or cause the calling task to
+ *          be placed in a blocked state.
+ */
+struct mmosal_timer *mmosal_timer_create(const char *name,
+                                         uint32_t timer_period_ms,
+                                         bool auto_reload,
+                                         void *arg,
+                                         timer_callback_t callback);
+
+/**
+ * Delete a timer.
+ *
+ * @param timer The timer to delete.
+ */
+void mmosal_timer_delete(struct mmosal_timer *timer);
+
+/**
+ * Start a timer.
+ *
+ * @param timer The timer to start.
+ *
+ * @returns @c true if the timer was started successfully, else @c false.
+ */
+bool mmosal_timer_start(struct mmosal_timer *timer);
+
+/**
+ * Stop a timer.
+ *
+ * @param timer The timer to stop.
+ *
+ * @returns @c true if the timer was stopped successfully, else @c false.
+ */
+bool mmosal_timer_stop(struct mmosal_timer *timer);
+
+/**
+ * Get the opaque argument associated with a given timer.
+ *
+ * @param timer The timer to retrieve the argument from.
+ *
+ * @returns void pointer to the argument.
+ */
+void *mmosal_timer_get_arg(struct mmosal_timer *timer);
+
 /**
  * @}
  */
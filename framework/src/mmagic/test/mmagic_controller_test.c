@@ -0,0 +1,841 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host test for the MMAGIC controller.
+ *
+ * The controller is built against single-threaded stubs of mmosal and the data link. The test
+ * plays the part of the agent, injecting packets through the data link RX callback and checking
+ * what the controller passes on to the application.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mmosal.h"
+#include "mmbuf.h"
+#include "mmutils.h"
+#include "mmagic_controller.h"
+#include "mmagic_datalink_controller.h"
+
+/*
+ * ---------------------------------------------------------------------------------------------
+ *
+ * Test helpers
+ */
+
+static int failures;
+
+#define CHECK(_cond)                                                          \
+    do {                                                                      \
+        if (!(_cond))                                                         \
+        {                                                                     \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #_cond); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+/* Wire format of the LLC and M2M headers, which must match mmagic_controller.c. */
+struct MM_PACKED test_llc_header
+{
+    uint8_t tseq;
+    uint8_t sid;
+    uint16_t length;
+};
+
+struct MM_PACKED test_m2m_header
+{
+    uint8_t subsystem;
+    uint8_t command;
+    uint8_t subcommand;
+    uint8_t result;
+};
+
+enum test_ptype
+{
+    TEST_PTYPE_COMMAND = 0,
+    TEST_PTYPE_RESPONSE = 1,
+    TEST_PTYPE_EVENT = 2,
+    TEST_PTYPE_AGENT_START_NOTIFICATION = 5,
+};
+
+/* Event ID of mqtt-message_received, which must match mmagic_controller.c. */
+#define TEST_MQTT_EVT_MESSAGE_RECEIVED (5)
+
+/*
+ * ---------------------------------------------------------------------------------------------
+ *
+ * mmosal stubs
+ */
+
+static uint32_t test_time_ms = 1000;
+static int test_queue_would_block;
+
+struct mmosal_mutex
+{
+    bool held;
+};
+
+struct mmosal_queue
+{
+    size_t num_items;
+    size_t item_size;
+    size_t count;
+    size_t head;
+    uint8_t *items;
+};
+
+struct mmosal_timer
+{
+    void *arg;
+    timer_callback_t callback;
+    bool running;
+};
+
+static struct mmosal_timer *test_timer;
+
+void mmosal_impl_assert(void)
+{
+    abort();
+}
+
+void *mmosal_malloc_(size_t size)
+{
+    return malloc(size);
+}
+
+void mmosal_free(void *p)
+{
+    free(p);
+}
+
+int mmosal_printf(const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int ret = vprintf(format, args);
+    va_end(args);
+    return ret;
+}
+
+uint32_t mmosal_get_time_ms(void)
+{
+    return test_time_ms;
+}
+
+void mmosal_task_sleep(uint32_t duration_ms)
+{
+    test_time_ms += duration_ms;
+}
+
+uint32_t mmosal_random_u32(uint32_t min, uint32_t max)
+{
+    MM_UNUSED(max);
+    return min;
+}
+
+struct mmosal_mutex *mmosal_mutex_create(const char *name)
+{
+    MM_UNUSED(name);
+    return (struct mmosal_mutex *)calloc(1, sizeof(struct mmosal_mutex));
+}
+
+void mmosal_mutex_delete(struct mmosal_mutex *mutex)
+{
+    free(mutex);
+}
+
+bool mmosal_mutex_get(struct mmosal_mutex *mutex, uint32_t timeout_ms)
+{
+    if (mutex->held)
+    {
+        /* Single threaded, so waiting for the mutex would never end. */
+        CHECK(timeout_ms == 0);
+        return false;
+    }
+    mutex->held = true;
+    return true;
+}
+
+bool mmosal_mutex_release(struct mmosal_mutex *mutex)
+{
+    CHECK(mutex->held);
+    mutex->held = false;
+    return true;
+}
+
+struct mmosal_queue *mmosal_queue_create(size_t num_items, size_t item_size, const char *name)
+{
+    MM_UNUSED(name);
+    struct mmosal_queue *queue = (struct mmosal_queue *)calloc(1, sizeof(*queue));
+    queue->num_items = num_items;
+    queue->item_size = item_size;
+    queue->items = (uint8_t *)calloc(num_items, item_size);
+    return queue;
+}
+
+void mmosal_queue_delete(struct mmosal_queue *queue)
+{
+    if (queue != NULL)
+    {
+        free(queue->items);
+        free(queue);
+    }
+}
+
+bool mmosal_queue_pop(struct mmosal_queue *queue, void *item, uint32_t timeout_ms)
+{
+    MM_UNUSED(timeout_ms);
+    if (queue->count == 0)
+    {
+        return false;
+    }
+    memcpy(item, queue->items + queue->head * queue->item_size, queue->item_size);
+    queue->head = (queue->head + 1) % queue->num_items;
+    queue->count--;
+    return true;
+}
+
+bool mmosal_queue_push(struct mmosal_queue *queue, const void *item, uint32_t timeout_ms)
+{
+    if (queue->count == queue->num_items)
+    {
+        /* Nothing else runs to empty the queue, so a non-zero wait would hang the caller. */
+        if (timeout_ms != 0)
+        {
+            test_queue_would_block++;
+        }
+        return false;
+    }
+    size_t tail = (queue->head + queue->count) % queue->num_items;
+    memcpy(queue->items + tail * queue->item_size, item, queue->item_size);
+    queue->count++;
+    return true;
+}
+
+struct mmosal_timer *mmosal_timer_create(const char *name,
+                                         uint32_t timer_period_ms,
+                                         bool auto_reload,
+                                         void *arg,
+                                         timer_callback_t callback)
+{
+    MM_UNUSED(name);
+    MM_UNUSED(timer_period_ms);
+    MM_UNUSED(auto_reload);
+    struct mmosal_timer *timer = (struct mmosal_timer *)calloc(1, sizeof(*timer));
+    timer->arg = arg;
+    timer->callback = callback;
+    test_timer = timer;
+    return timer;
+}
+
+void mmosal_timer_delete(struct mmosal_timer *timer)
+{
+    if (timer == test_timer)
+    {
+        test_timer = NULL;
+    }
+    free(timer);
+}
+
+bool mmosal_timer_start(struct mmosal_timer *timer)
+{
+    timer->running = true;
+    return true;
+}
+
+bool mmosal_timer_stop(struct mmosal_timer *timer)
+{
+    timer->running = false;
+    return true;
+}
+
+void *mmosal_timer_get_arg(struct mmosal_timer *timer)
+{
+    return timer->arg;
+}
+
+/** Advance the time and run the timer callback if the timer is running. */
+static void test_advance_time(uint32_t duration_ms)
+{
+    test_time_ms += duration_ms;
+    if (test_timer != NULL && test_timer->running)
+    {
+        test_timer->callback(test_timer);
+    }
+}
+
+/*
+ * ---------------------------------------------------------------------------------------------
+ *
+ * Data link stub
+ */
+
+/** Maximum number of transmitted commands that are recorded. */
+#define TEST_MAX_SENT (32)
+
+struct mmagic_datalink_controller
+{
+    mmagic_datalink_controller_rx_buffer_cb_t rx_callback;
+    void *rx_arg;
+};
+
+static struct mmagic_datalink_controller test_dl;
+static struct test_m2m_header test_sent[TEST_MAX_SENT];
+static uint8_t test_sent_sid[TEST_MAX_SENT];
+static int test_sent_count;
+static bool test_tx_fail;
+static uint8_t test_agent_seq;
+static size_t test_rx_tailroom;
+
+/* Called with the header of each command once it has been sent, so that the test can respond
+ * before a blocking call starts waiting. */
+static void (*test_on_tx)(uint8_t sid, const struct test_m2m_header *header);
+
+struct mmagic_datalink_controller *mmagic_datalink_controller_init(
+    const struct mmagic_datalink_controller_init_args *args)
+{
+    test_dl.rx_callback = args->rx_callback;
+    test_dl.rx_arg = args->rx_arg;
+    return &test_dl;
+}
+
+void mmagic_datalink_controller_deinit(struct mmagic_datalink_controller *controller_dl)
+{
+    MM_UNUSED(controller_dl);
+}
+
+struct mmbuf *mmagic_datalink_controller_alloc_buffer_for_tx(
+    struct mmagic_datalink_controller *controller_dl,
+    size_t header_size,
+    size_t payload_size)
+{
+    MM_UNUSED(controller_dl);
+    return mmbuf_alloc_on_heap(header_size, payload_size);
+}
+
+int mmagic_datalink_controller_tx_buffer(struct mmagic_datalink_controller *controller_dl,
+                                         struct mmbuf *buf)
+{
+    MM_UNUSED(controller_dl);
+    int len = (int)mmbuf_get_data_length(buf);
+    const struct test_llc_header *llc = (const struct test_llc_header *)mmbuf_get_data_start(buf);
+
+    if (test_tx_fail)
+    {
+        mmbuf_release(buf);
+        return -1;
+    }
+
+    if ((llc->tseq >> 4) == TEST_PTYPE_COMMAND && test_sent_count < TEST_MAX_SENT)
+    {
+        memcpy(&test_sent[test_sent_count], llc + 1, sizeof(test_sent[0]));
+        test_sent_sid[test_sent_count] = llc->sid;
+        test_sent_count++;
+    }
+    if ((llc->tseq >> 4) == TEST_PTYPE_COMMAND && test_on_tx != NULL)
+    {
+        struct test_m2m_header header;
+        uint8_t sid = llc->sid;
+        memcpy(&header, llc + 1, sizeof(header));
+        mmbuf_release(buf);
+        test_on_tx(sid, &header);
+        return len;
+    }
+    mmbuf_release(buf);
+    return len;
+}
+
+/**
+ * Inject a packet from the agent.
+ *
+ * @param ptype   LLC packet type.
+ * @param sid     Stream ID.
+ * @param header  M2M header, or @c NULL for none.
+ * @param payload Payload following the M2M header. May be @c NULL if @p len is 0.
+ * @param len     Length of @p payload.
+ */
+static void test_agent_send(enum test_ptype ptype,
+                            uint8_t sid,
+                            const struct test_m2m_header *header,
+                            const void *payload,
+                            size_t len)
+{
+    size_t header_len = (header != NULL) ? sizeof(*header) : 0;
+    struct mmbuf *buf = mmbuf_alloc_on_heap(0,
+                                            sizeof(struct test_llc_header) + header_len + len +
+                                                test_rx_tailroom);
+    struct test_llc_header llc = {
+        .tseq = (uint8_t)((ptype << 4) | (test_agent_seq++ & 0x0f)),
+        .sid = sid,
+        .length = (uint16_t)(header_len + len),
+    };
+
+    mmbuf_append_data(buf, (const uint8_t *)&llc, sizeof(llc));
+    if (header != NULL)
+    {
+        mmbuf_append_data(buf, (const uint8_t *)header, sizeof(*header));
+    }
+    if (len)
+    {
+        mmbuf_append_data(buf, (const uint8_t *)payload, len);
+    }
+    test_dl.rx_callback(&test_dl, test_dl.rx_arg, buf);
+}
+
+/** Inject a successful response from the agent carrying a one octet payload. */
+static void test_agent_respond(uint8_t sid,
+                               uint8_t subsystem,
+                               uint8_t command,
+                               uint8_t subcommand,
+                               uint8_t value)
+{
+    struct test_m2m_header header = { subsystem, command, subcommand, MMAGIC_STATUS_OK };
+    test_agent_send(TEST_PTYPE_RESPONSE, sid, &header, &value, sizeof(value));
+}
+
+/*
+ * ---------------------------------------------------------------------------------------------
+ *
+ * Test cases
+ */
+
+/** Record of the completion of an asynchronous command. */
+struct test_completion
+{
+    int count;
+    uint32_t tag;
+    enum mmagic_status status;
+};
+
+static void test_rsp_cb(struct mmagic_controller *controller,
+                        uint32_t tag,
+                        enum mmagic_status status,
+                        void *arg)
+{
+    MM_UNUSED(controller);
+    struct test_completion *completion = (struct test_completion *)arg;
+    completion->count++;
+    completion->tag = tag;
+    completion->status = status;
+}
+
+static struct mmagic_controller *test_setup(void)
+{
+    struct mmagic_controller_init_args args = MMAGIC_CONTROLLER_ARGS_INIT;
+    test_sent_count = 0;
+    test_tx_fail = false;
+    test_rx_tailroom = 0;
+    test_on_tx = NULL;
+    test_queue_would_block = 0;
+    struct mmagic_controller *controller = mmagic_controller_init(&args);
+    CHECK(controller != NULL);
+    return controller;
+}
+
+static void test_teardown(struct mmagic_controller *controller)
+{
+    mmagic_controller_deinit(controller);
+}
+
+/** Send an asynchronous command with a one octet response. */
+static enum mmagic_status test_tx_async(struct mmagic_controller *controller,
+                                        uint8_t sid,
+                                        uint8_t command,
+                                        uint8_t *rsp,
+                                        uint32_t timeout_ms,
+                                        struct test_completion *completion,
+                                        uint32_t *tag)
+{
+    return mmagic_controller_tx_async(controller, sid, 1, command, 0, NULL, 0, rsp, 1,
+                                      timeout_ms, test_rsp_cb, completion, tag);
+}
+
+/* A blocking command and an asynchronous command with the same header on one stream each get
+ * their own response, whichever order they were sent in. */
+static void test_blocking_and_async_same_header(void)
+{
+    for (int async_first = 0; async_first <= 1; async_first++)
+    {
+        struct mmagic_controller *controller = test_setup();
+        struct test_completion completion = { 0 };
+        uint8_t async_rsp = 0;
+        uint8_t blocking_rsp = 0;
+        uint32_t tag;
+
+        if (async_first)
+        {
+            CHECK(test_tx_async(controller, 1, 2, &async_rsp, 1000, &completion, &tag) ==
+                  MMAGIC_STATUS_OK);
+        }
+        CHECK(mmagic_controller_tx(controller, 1, 1, 2, 0, NULL, 0) == MMAGIC_STATUS_OK);
+        if (!async_first)
+        {
+            CHECK(test_tx_async(controller, 1, 2, &async_rsp, 1000, &completion, &tag) ==
+                  MMAGIC_STATUS_OK);
+        }
+
+        test_agent_respond(1, 1, 2, 0, 0x11);
+        test_agent_respond(1, 1, 2, 0, 0x22);
+
+        CHECK(mmagic_controller_rx(controller, 1, 1, 2, 0, &blocking_rsp, 1, 0) ==
+              MMAGIC_STATUS_OK);
+        CHECK(completion.count == 1);
+        CHECK(completion.status == MMAGIC_STATUS_OK);
+        CHECK(completion.tag == tag);
+        CHECK(blocking_rsp == (async_first ? 0x22 : 0x11));
+        CHECK(async_rsp == (async_first ? 0x11 : 0x22));
+        CHECK(mmagic_controller_get_in_flight_count(controller) == 0);
+        test_teardown(controller);
+    }
+}
+
+/* Responses to asynchronous commands on one stream are matched in the order that the commands
+ * were sent, and commands on other streams are not affected. */
+static void test_async_ordering(void)
+{
+    struct mmagic_controller *controller = test_setup();
+    struct test_completion completion[3] = { 0 };
+    uint8_t rsp[3] = { 0 };
+
+    CHECK(test_tx_async(controller, 1, 2, &rsp[0], 1000, &completion[0], NULL) ==
+          MMAGIC_STATUS_OK);
+    CHECK(test_tx_async(controller, 2, 2, &rsp[1], 1000, &completion[1], NULL) ==
+          MMAGIC_STATUS_OK);
+    CHECK(test_tx_async(controller, 1, 2, &rsp[2], 1000, &completion[2], NULL) ==
+          MMAGIC_STATUS_OK);
+
+    test_agent_respond(2, 1, 2, 0, 0x20);
+    test_agent_respond(1, 1, 2, 0, 0x10);
+    test_agent_respond(1, 1, 2, 0, 0x11);
+
+    CHECK(rsp[0] == 0x10);
+    CHECK(rsp[1] == 0x20);
+    CHECK(rsp[2] == 0x11);
+    for (int ii = 0; ii < 3; ii++)
+    {
+        CHECK(completion[ii].count == 1);
+        CHECK(completion[ii].status == MMAGIC_STATUS_OK);
+    }
+    test_teardown(controller);
+}
+
+/* Cancelling a command frees its slot straight away and its late response is discarded rather
+ * than being given to a later command with the same header. */
+static void test_cancel(void)
+{
+    struct mmagic_controller *controller = test_setup();
+    struct test_completion completion[MMAGIC_CONTROLLER_MAX_IN_FLIGHT + 1] = { 0 };
+    uint8_t rsp[MMAGIC_CONTROLLER_MAX_IN_FLIGHT + 1] = { 0 };
+    uint32_t tags[MMAGIC_CONTROLLER_MAX_IN_FLIGHT + 1];
+    const int last = MMAGIC_CONTROLLER_MAX_IN_FLIGHT;
+
+    for (int ii = 0; ii < MMAGIC_CONTROLLER_MAX_IN_FLIGHT; ii++)
+    {
+        CHECK(test_tx_async(controller, 1, 2, &rsp[ii], 1000, &completion[ii], &tags[ii]) ==
+              MMAGIC_STATUS_OK);
+    }
+    CHECK(test_tx_async(controller, 1, 2, &rsp[last], 1000, &completion[last], &tags[last]) ==
+          MMAGIC_STATUS_UNAVAILABLE);
+
+    CHECK(mmagic_controller_cancel_async(controller, tags[0]) == MMAGIC_STATUS_OK);
+    CHECK(mmagic_controller_cancel_async(controller, tags[0]) == MMAGIC_STATUS_NOT_FOUND);
+    CHECK(mmagic_controller_get_in_flight_count(controller) == MMAGIC_CONTROLLER_MAX_IN_FLIGHT - 1);
+    CHECK(test_tx_async(controller, 1, 2, &rsp[last], 1000, &completion[last], &tags[last]) ==
+          MMAGIC_STATUS_OK);
+
+    for (int ii = 0; ii <= MMAGIC_CONTROLLER_MAX_IN_FLIGHT; ii++)
+    {
+        test_agent_respond(1, 1, 2, 0, (uint8_t)(0x40 + ii));
+    }
+
+    CHECK(completion[0].count == 0);
+    CHECK(rsp[0] == 0);
+    for (int ii = 1; ii <= MMAGIC_CONTROLLER_MAX_IN_FLIGHT; ii++)
+    {
+        CHECK(completion[ii].count == 1);
+        CHECK(completion[ii].status == MMAGIC_STATUS_OK);
+        CHECK(rsp[ii] == 0x40 + ii);
+    }
+    CHECK(mmagic_controller_get_in_flight_count(controller) == 0);
+    test_teardown(controller);
+}
+
+/* A command whose response does not arrive in time fails with MMAGIC_STATUS_TIMEOUT, and the
+ * response is discarded if it turns up later. */
+static void test_timeout(void)
+{
+    struct mmagic_controller *controller = test_setup();
+    struct test_completion completion[2] = { 0 };
+    uint8_t rsp[2] = { 0 };
+
+    CHECK(test_tx_async(controller, 1, 2, &rsp[0], 500, &completion[0], NULL) ==
+          MMAGIC_STATUS_OK);
+    CHECK(test_timer->running);
+
+    test_advance_time(400);
+    CHECK(completion[0].count == 0);
+    test_advance_time(100);
+    CHECK(completion[0].count == 1);
+    CHECK(completion[0].status == MMAGIC_STATUS_TIMEOUT);
+    CHECK(mmagic_controller_get_in_flight_count(controller) == 0);
+
+    /* Nothing is left waiting so the timer stops. */
+    test_advance_time(100);
+    CHECK(!test_timer->running);
+
+    CHECK(test_tx_async(controller, 1, 2, &rsp[1], 500, &completion[1], NULL) ==
+          MMAGIC_STATUS_OK);
+    CHECK(test_timer->running);
+    test_agent_respond(1, 1, 2, 0, 0x10);
+    CHECK(completion[1].count == 0);
+    test_agent_respond(1, 1, 2, 0, 0x11);
+    CHECK(completion[0].count == 1);
+    CHECK(completion[1].count == 1);
+    CHECK(completion[1].status == MMAGIC_STATUS_OK);
+    CHECK(rsp[0] == 0);
+    CHECK(rsp[1] == 0x11);
+
+    /* A command with no timeout does not keep the timer running. */
+    test_advance_time(100);
+    CHECK(!test_timer->running);
+    CHECK(test_tx_async(controller, 1, 2, &rsp[1], UINT32_MAX, &completion[1], NULL) ==
+          MMAGIC_STATUS_OK);
+    CHECK(!test_timer->running);
+    test_teardown(controller);
+}
+
+/* If the agent does not respond to a command, the response to a later command with a different
+ * header is still matched to it. */
+static void test_missing_response(void)
+{
+    struct mmagic_controller *controller = test_setup();
+    struct test_completion completion[2] = { 0 };
+    uint8_t rsp[2] = { 0 };
+
+    CHECK(test_tx_async(controller, 1, 2, &rsp[0], 500, &completion[0], NULL) ==
+          MMAGIC_STATUS_OK);
+    CHECK(test_tx_async(controller, 1, 3, &rsp[1], 500, &completion[1], NULL) ==
+          MMAGIC_STATUS_OK);
+
+    test_agent_respond(1, 1, 3, 0, 0x30);
+    CHECK(completion[0].count == 0);
+    CHECK(completion[1].count == 1);
+    CHECK(rsp[1] == 0x30);
+
+    test_advance_time(500);
+    CHECK(completion[0].count == 1);
+    CHECK(completion[0].status == MMAGIC_STATUS_TIMEOUT);
+    test_teardown(controller);
+}
+
+/* A response that nobody is waiting for is dropped without blocking the data link thread, and a
+ * stale response left by a blocking command that timed out is not returned for the next one. */
+static void test_unexpected_response(void)
+{
+    struct mmagic_controller *controller = test_setup();
+    uint8_t rsp = 0;
+
+    test_agent_respond(1, 1, 2, 0, 0x10);
+
+    CHECK(mmagic_controller_tx(controller, 1, 1, 2, 0, NULL, 0) == MMAGIC_STATUS_OK);
+    CHECK(mmagic_controller_rx(controller, 1, 1, 2, 0, &rsp, 1, 0) == MMAGIC_STATUS_ERROR);
+    test_agent_respond(1, 1, 2, 0, 0x11);
+    test_agent_respond(1, 1, 2, 0, 0x12);
+
+    CHECK(mmagic_controller_tx(controller, 1, 1, 2, 0, NULL, 0) == MMAGIC_STATUS_OK);
+    test_agent_respond(1, 1, 2, 0, 0x13);
+    test_agent_respond(1, 1, 2, 0, 0x14);
+    CHECK(mmagic_controller_rx(controller, 1, 1, 2, 0, &rsp, 1, 0) == MMAGIC_STATUS_OK);
+    CHECK(rsp == 0x13);
+    CHECK(test_queue_would_block == 0);
+    test_teardown(controller);
+}
+
+/* A command that could not be sent does not take a sequence number. */
+static void test_tx_failure(void)
+{
+    struct mmagic_controller *controller = test_setup();
+    struct test_completion completion[2] = { 0 };
+    uint8_t rsp[2] = { 0 };
+
+    test_tx_fail = true;
+    CHECK(test_tx_async(controller, 1, 2, &rsp[0], 500, &completion[0], NULL) ==
+          MMAGIC_STATUS_TX_ERROR);
+    CHECK(completion[0].count == 0);
+    CHECK(mmagic_controller_get_in_flight_count(controller) == 0);
+
+    test_tx_fail = false;
+    CHECK(test_tx_async(controller, 1, 2, &rsp[1], 500, &completion[1], NULL) ==
+          MMAGIC_STATUS_OK);
+    test_agent_respond(1, 1, 2, 0, 0x10);
+    CHECK(completion[1].count == 1);
+    CHECK(rsp[1] == 0x10);
+    test_teardown(controller);
+}
+
+/* Commands in flight when the agent restarts fail with MMAGIC_STATUS_CLOSED, and numbering
+ * starts afresh. */
+static void test_agent_restart(void)
+{
+    struct mmagic_controller *controller = test_setup();
+    struct test_completion completion[2] = { 0 };
+    uint8_t rsp[2] = { 0 };
+
+    CHECK(test_tx_async(controller, 1, 2, &rsp[0], 500, &completion[0], NULL) ==
+          MMAGIC_STATUS_OK);
+    test_agent_send(TEST_PTYPE_AGENT_START_NOTIFICATION, CONTROL_STREAM, NULL, NULL, 0);
+    CHECK(completion[0].count == 1);
+    CHECK(completion[0].status == MMAGIC_STATUS_CLOSED);
+    CHECK(mmagic_controller_get_in_flight_count(controller) == 0);
+
+    CHECK(test_tx_async(controller, 1, 2, &rsp[1], 500, &completion[1], NULL) ==
+          MMAGIC_STATUS_OK);
+    test_agent_respond(1, 1, 2, 0, 0x10);
+    CHECK(completion[0].count == 1);
+    CHECK(completion[1].count == 1);
+    CHECK(rsp[1] == 0x10);
+    test_teardown(controller);
+}
+
+/* Lengths of variable length tails to send, including some beyond the size of the field. */
+static const uint16_t test_tail_lens[] = { 0, 1, 100, 1535, 1536, 1537, UINT16_MAX };
+
+static struct mmagic_core_socket_recv_rsp_args test_recv_rsp;
+
+static void test_fill(uint8_t *data, size_t len, uint8_t seed)
+{
+    for (size_t ii = 0; ii < len; ii++)
+    {
+        data[ii] = (uint8_t)(ii * 7 + seed);
+    }
+}
+
+/** Respond to a socket recv command as the agent does, sending only the used part of the tail. */
+static void test_respond_recv(uint8_t sid, const struct test_m2m_header *header)
+{
+    struct test_m2m_header rsp_header = *header;
+    size_t used = MM_MIN(test_recv_rsp.buffer.len, sizeof(test_recv_rsp.buffer.data));
+
+    rsp_header.result = MMAGIC_STATUS_OK;
+    test_agent_send(TEST_PTYPE_RESPONSE, sid, &rsp_header, &test_recv_rsp,
+                    offsetof(struct mmagic_core_socket_recv_rsp_args, buffer.data) + used);
+}
+
+/* A response whose variable length tail is sent at its used length is zero-padded out to the
+ * full size of the response structure, by both the blocking and the asynchronous path. */
+static void test_tail_response(void)
+{
+    for (size_t ii = 0; ii < MM_ARRAY_COUNT(test_tail_lens); ii++)
+    {
+        struct mmagic_controller *controller = test_setup();
+        struct mmagic_core_socket_recv_cmd_args cmd_args = { .stream_id = 2, .len = 1536 };
+        struct mmagic_core_socket_recv_rsp_args expected;
+        struct mmagic_core_socket_recv_rsp_args rsp_args;
+        struct test_completion completion = { 0 };
+        size_t used = MM_MIN(test_tail_lens[ii], sizeof(expected.buffer.data));
+
+        memset(&test_recv_rsp, 0, sizeof(test_recv_rsp));
+        test_recv_rsp.buffer.len = test_tail_lens[ii];
+        test_fill(test_recv_rsp.buffer.data, used, 1);
+        expected = test_recv_rsp;
+
+        memset(&rsp_args, 0xa5, sizeof(rsp_args));
+        test_on_tx = test_respond_recv;
+        CHECK(mmagic_controller_socket_recv(controller, &cmd_args, &rsp_args) == MMAGIC_STATUS_OK);
+        CHECK(memcmp(&rsp_args, &expected, sizeof(expected)) == 0);
+
+        memset(&rsp_args, 0xa5, sizeof(rsp_args));
+        test_on_tx = NULL;
+        CHECK(mmagic_controller_socket_recv_async(controller, &cmd_args, &rsp_args, test_rsp_cb,
+                                                  &completion, NULL) == MMAGIC_STATUS_OK);
+        CHECK(test_sent_count == 2);
+        test_respond_recv(2, &test_sent[1]);
+        CHECK(completion.count == 1);
+        CHECK(completion.status == MMAGIC_STATUS_OK);
+        CHECK(memcmp(&rsp_args, &expected, sizeof(expected)) == 0);
+        test_teardown(controller);
+    }
+}
+
+static struct mmagic_mqtt_message_received_event_args test_event_args;
+static int test_event_count;
+
+static void test_mqtt_message_received_handler(
+    const struct mmagic_mqtt_message_received_event_args *event_args,
+    void *arg)
+{
+    MM_UNUSED(arg);
+    test_event_args = *event_args;
+    test_event_count++;
+}
+
+/* An event whose variable length tail is sent at its used length is zero-padded out to the full
+ * size of the event arguments, whether or not the received buffer has room to pad in place. An
+ * event that is shorter than its fixed fields is dropped. */
+static void test_tail_event(void)
+{
+    const size_t tail_offset =
+        offsetof(struct mmagic_mqtt_message_received_event_args, payload.data);
+    const struct test_m2m_header header = { MMAGIC_MQTT, TEST_MQTT_EVT_MESSAGE_RECEIVED, 0, 0 };
+
+    for (size_t ii = 0; ii < MM_ARRAY_COUNT(test_tail_lens); ii++)
+    {
+        for (int in_place = 0; in_place <= 1; in_place++)
+        {
+            struct mmagic_controller *controller = test_setup();
+            struct mmagic_mqtt_message_received_event_args event;
+            size_t used = MM_MIN(test_tail_lens[ii], sizeof(event.payload.data));
+
+            mmagic_controller_register_mqtt_message_received_handler(
+                controller,
+                test_mqtt_message_received_handler,
+                NULL);
+
+            memset(&event, 0, sizeof(event));
+            event.stream_id = 3;
+            event.topic.len = 5;
+            memcpy(event.topic.data, "a/b/c", 6);
+            event.payload.len = test_tail_lens[ii];
+            test_fill(event.payload.data, used, 3);
+
+            memset(&test_event_args, 0xa5, sizeof(test_event_args));
+            test_event_count = 0;
+            test_rx_tailroom = in_place ? sizeof(event) - (tail_offset + used) : 0;
+            test_agent_send(TEST_PTYPE_EVENT, CONTROL_STREAM, &header, &event, tail_offset + used);
+            CHECK(test_event_count == 1);
+            CHECK(memcmp(&test_event_args, &event, sizeof(event)) == 0);
+
+            test_agent_send(TEST_PTYPE_EVENT, CONTROL_STREAM, &header, &event, tail_offset - 1);
+            CHECK(test_event_count == 1);
+            test_teardown(controller);
+        }
+    }
+}
+
+int main(void)
+{
+    test_blocking_and_async_same_header();
+    test_async_ordering();
+    test_cancel();
+    test_timeout();
+    test_missing_response();
+    test_unexpected_response();
+    test_tx_failure();
+    test_agent_restart();
+    test_tail_response();
+    test_tail_event();
+
+    if (failures)
+    {
+        printf("%d check(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("All checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Port definitions for building the MMAGIC controller on the host for testing.
+ */
+
+#pragma once
+
+/** Trigger a breakpoint. */
+#define MMPORT_BREAKPOINT() __builtin_trap()
+
+/** Get the link register. */
+#define MMPORT_GET_LR()     __builtin_return_address(0)
+
+/** Get the program counter. */
+#define MMPORT_GET_PC(_a)   ((_a) = 0)
+
+/** Memory synchronization barrier. */
+#define MMPORT_MEM_SYNC()   __sync_synchronize()
@@ -9,6 +9,7 @@
 #include "mmnetif.h"
 #include "mmosal.h"
 #include "mmutils.h"
+#include "mmwlan.h"
 
 #include "lwip/api.h"
 #include "lwip/autoip.h"
@@ -739,6 +740,51 @@ void mmipal_set_tx_qos_tid(uint8_t tid)
     mmnetif_set_tx_qos_tid(&data->lwip_mmnetif, tid);
 }
 
+enum mmipal_status mmipal_set_tx_qos_dscp_tid(uint8_t dscp, uint8_t tid)
+{
+    struct mmipal_data *data = mmipal_get_data();
+    bool ok = tcpip_init_done;
+    MMOSAL_ASSERT(ok);
+
+    if (dscp > MMNETIF_DSCP_MAX || (tid > MMWLAN_MAX_QOS_TID && tid != MMIPAL_TX_QOS_TID_UNMAPPED))
+    {
+        return MMIPAL_INVALID_ARGUMENT;
+    }
+
+    LOCK_TCPIP_CORE();
+    mmnetif_set_tx_qos_dscp_tid(&data->lwip_mmnetif, dscp, tid);
+    UNLOCK_TCPIP_CORE();
+    return MMIPAL_SUCCESS;
+}
+
+enum mmipal_status mmipal_add_tx_qos_rule(const struct mmipal_tx_qos_rule *rule)
+{
+    struct mmipal_data *data = mmipal_get_data();
+    bool ok = tcpip_init_done;
+    MMOSAL_ASSERT(ok);
+
+    if (rule == NULL || rule->tid > MMWLAN_MAX_QOS_TID)
+    {
+        return MMIPAL_INVALID_ARGUMENT;
+    }
+
+    LOCK_TCPIP_CORE();
+    ok = mmnetif_add_tx_qos_rule(&data->lwip_mmnetif, rule);
+    UNLOCK_TCPIP_CORE();
+    return ok ? MMIPAL_SUCCESS : MMIPAL_NO_MEM;
+}
+
+void mmipal_clear_tx_qos_rules(void)
+{
+    struct mmipal_data *data = mmipal_get_data();
+    bool ok = tcpip_init_done;
+    MMOSAL_ASSERT(ok);
+
+    LOCK_TCPIP_CORE();
+    mmnetif_clear_tx_qos_rules(&data->lwip_mmnetif);
+    UNLOCK_TCPIP_CORE();
+}
+
 enum mmipal_link_state mmipal_get_link_state(void)
 {
     struct mmipal_data *data = mmipal_get_data();
@@ -12,14 +12,25 @@
 #include "lwip/etharp.h"
 #include "lwip/ethip6.h"
 #include "lwip/tcpip.h"
+#include "lwip/prot/ethernet.h"
+#include "lwip/prot/ip.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/ip6.h"
 #if LWIP_SNMP
 #include "lwip/snmp.h"
 #endif
 
+/** Number of octets of a frame that are inspected to classify it: Ethernet and VLAN headers,
+ *  the largest IPv4 header and the transport layer ports. */
+#define MMNETIF_CLASSIFY_HDR_LEN (SIZEOF_ETH_HDR + SIZEOF_VLAN_HDR + 60 + 4)
+
 struct netif_state
 {
     enum mmwlan_vif vif;
     volatile uint8_t tx_qos_tid;
+    uint8_t num_tx_qos_rules;
+    uint8_t tx_qos_dscp_tid[MMNETIF_DSCP_MAX + 1];
+    struct mmipal_tx_qos_rule tx_qos_rules[MMIPAL_MAX_TX_QOS_RULES];
 };
 
 static struct netif_state *get_netif_state(struct netif *netif)
@@ -160,6 +171,108 @@ static void mmnetif_vif_state(const struct mmwlan_vif_state *state, void *arg)
     UNLOCK_TCPIP_CORE();
 }
 
+static bool mmnetif_tx_qos_rule_match(const struct mmipal_tx_qos_rule *rule,
+                                      uint8_t ip_proto,
+                                      bool has_ports,
+                                      uint16_t src_port,
+                                      uint16_t dst_port)
+{
+    if (rule->ip_proto != 0 && rule->ip_proto != ip_proto)
+    {
+        return false;
+    }
+    if (rule->local_port != 0 && (!has_ports || rule->local_port != src_port))
+    {
+        return false;
+    }
+    if (rule->remote_port != 0 && (!has_ports || rule->remote_port != dst_port))
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Select the TID for a frame from the configured flow rules, its 802.1p priority, its DSCP
+ * value or the default TID, in that order.
+ */
+static uint8_t mmnetif_classify_tx(struct netif_state *state, const struct pbuf *p)
+{
+    uint8_t hdr[MMNETIF_CLASSIFY_HDR_LEN];
+    uint16_t len = pbuf_copy_partial(p, hdr, sizeof(hdr), 0);
+    uint16_t offset = SIZEOF_ETH_HDR;
+    int pcp = -1;
+    uint8_t dscp;
+    uint8_t ip_proto;
+    bool has_ports = false;
+    uint16_t src_port = 0;
+    uint16_t dst_port = 0;
+    unsigned ii;
+
+    if (len < SIZEOF_ETH_HDR)
+    {
+        return state->tx_qos_tid;
+    }
+
+    uint16_t type = (hdr[offset - 2] << 8) | hdr[offset - 1];
+    if (type == ETHTYPE_VLAN && len >= offset + SIZEOF_VLAN_HDR)
+    {
+        pcp = hdr[offset] >> 5;
+        type = (hdr[offset + 2] << 8) | hdr[offset + 3];
+        offset += SIZEOF_VLAN_HDR;
+    }
+
+    if (type == ETHTYPE_IP && len >= offset + IP_HLEN)
+    {
+        const uint8_t *iphdr = hdr + offset;
+        dscp = iphdr[1] >> 2;
+        ip_proto = iphdr[9];
+        has_ports = ((iphdr[6] & 0x1f) | iphdr[7]) == 0;
+        offset += (iphdr[0] & 0x0f) * 4;
+    }
+    else if (type == ETHTYPE_IPV6 && len >= offset + IP6_HLEN)
+    {
+        const uint8_t *ip6hdr = hdr + offset;
+        dscp = ((ip6hdr[0] & 0x0f) << 2) | (ip6hdr[1] >> 6);
+        ip_proto = ip6hdr[6];
+        has_ports = true;
+        offset += IP6_HLEN;
+    }
+    else
+    {
+        return (pcp >= 0) ? (uint8_t)pcp : state->tx_qos_tid;
+    }
+
+    has_ports = has_ports && (ip_proto == IP_PROTO_TCP || ip_proto == IP_PROTO_UDP) &&
+                len >= offset + 4;
+    if (has_ports)
+    {
+        src_port = (hdr[offset] << 8) | hdr[offset + 1];
+        dst_port = (hdr[offset + 2] << 8) | hdr[offset + 3];
+    }
+
+    for (ii = 0; ii < state->num_tx_qos_rules; ii++)
+    {
+        const struct mmipal_tx_qos_rule *rule = &state->tx_qos_rules[ii];
+        if (mmnetif_tx_qos_rule_match(rule, ip_proto, has_ports, src_port, dst_port))
+        {
+            return rule->tid;
+        }
+    }
+
+    if (pcp >= 0)
+    {
+        return (uint8_t)pcp;
+    }
+
+    if (state->tx_qos_dscp_tid[dscp] != MMIPAL_TX_QOS_TID_UNMAPPED)
+    {
+        return state->tx_qos_dscp_tid[dscp];
+    }
+
+    return state->tx_qos_tid;
+}
+
 static err_t mmnetif_tx(struct netif *netif, struct pbuf *p)
 {
     struct mmpkt *pkt;
@@ -168,7 +281,7 @@ static err_t mmnetif_tx(struct netif *netif, struct pbuf *p)
     struct pbuf *walk;
     struct netif_state *state = get_netif_state(netif);
     struct mmwlan_tx_metadata metadata = {
-        .tid = state->tx_qos_tid,
+        .tid = mmnetif_classify_tx(state, p),
         .vif = state->vif,
     };
 
@@ -269,6 +382,7 @@ err_t mmnetif_init(struct netif *netif)
     struct netif_state *state = (struct netif_state *)mmosal_calloc(1, sizeof(*state));
     MMOSAL_ASSERT(state != NULL);
     state->tx_qos_tid = MMWLAN_TX_DEFAULT_QOS_TID;
+    memset(state->tx_qos_dscp_tid, MMIPAL_TX_QOS_TID_UNMAPPED, sizeof(state->tx_qos_dscp_tid));
     state->vif = MMWLAN_VIF_UNSPECIFIED;
     netif->state = state;
 
@@ -289,3 +403,29 @@ void mmnetif_set_tx_qos_tid(struct netif *netif, uint8_t tid)
     MMOSAL_ASSERT(tid <= MMWLAN_MAX_QOS_TID);
     get_netif_state(netif)->tx_qos_tid = tid;
 }
+
+void mmnetif_set_tx_qos_dscp_tid(struct netif *netif, uint8_t dscp, uint8_t tid)
+{
+    MMOSAL_ASSERT(dscp <= MMNETIF_DSCP_MAX);
+    MMOSAL_ASSERT(tid <= MMWLAN_MAX_QOS_TID || tid == MMIPAL_TX_QOS_TID_UNMAPPED);
+    get_netif_state(netif)->tx_qos_dscp_tid[dscp] = tid;
+}
+
+bool mmnetif_add_tx_qos_rule(struct netif *netif, const struct mmipal_tx_qos_rule *rule)
+{
+    struct netif_state *state = get_netif_state(netif);
+
+    MMOSAL_ASSERT(rule->tid <= MMWLAN_MAX_QOS_TID);
+    if (state->num_tx_qos_rules >= MMIPAL_MAX_TX_QOS_RULES)
+    {
+        return false;
+    }
+
+    state->tx_qos_rules[state->num_tx_qos_rules++] = *rule;
+    return true;
+}
+
+void mmnetif_clear_tx_qos_rules(struct netif *netif)
+{
+    get_netif_state(netif)->num_tx_qos_rules = 0;
+}
@@ -9,6 +9,8 @@
 #include "lwip/netif.h"
 #include "lwip/err.h"
 
+#include "mmipal.h"
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -25,6 +27,41 @@ err_t mmnetif_init(struct netif *netif);
  */
 void mmnetif_set_tx_qos_tid(struct netif *netif, uint8_t tid);
 
+/** Maximum IP DSCP value. */
+#define MMNETIF_DSCP_MAX (63)
+
+/**
+ * Map an IP DSCP value to a QoS TID for the @c netif.
+ *
+ * @note Must be called with the lwIP core lock held.
+ *
+ * @param netif The @c netif to configure.
+ * @param dscp  The DSCP value (0 - @ref MMNETIF_DSCP_MAX).
+ * @param tid   The TID value to set, or @ref MMIPAL_TX_QOS_TID_UNMAPPED to remove the mapping.
+ */
+void mmnetif_set_tx_qos_dscp_tid(struct netif *netif, uint8_t dscp, uint8_t tid);
+
+/**
+ * Add a flow rule used to select the QoS TID of packets sent on the @c netif.
+ *
+ * @note Must be called with the lwIP core lock held.
+ *
+ * @param netif The @c netif to configure.
+ * @param rule  The rule to add.
+ *
+ * @returns @c true on success, @c false if the rule table is full.
+ */
+bool mmnetif_add_tx_qos_rule(struct netif *netif, const struct mmipal_tx_qos_rule *rule);
+
+/**
+ * Remove all flow rules from the @c netif.
+ *
+ * @note Must be called with the lwIP core lock held.
+ *
+ * @param netif The @c netif to configure.
+ */
+void mmnetif_clear_tx_qos_rules(struct netif *netif);
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,6 +38,16 @@ extern "C"
 #define MMIPAL_MACADDR_LEN (6)
 #endif
 
+/** Maximum number of flow rules that can be added with @ref mmipal_add_tx_qos_rule(). */
+#ifndef MMIPAL_MAX_TX_QOS_RULES
+#define MMIPAL_MAX_TX_QOS_RULES (8)
+#endif
+
+/** Value used in the DSCP to TID map to indicate that a DSCP value is not mapped. */
+#ifndef MMIPAL_TX_QOS_TID_UNMAPPED
+#define MMIPAL_TX_QOS_TID_UNMAPPED (0xff)
+#endif
+
 /** Enumeration of status codes returned by MMIPAL functions. */
 enum mmipal_status
 {
@@ -288,6 +298,56 @@ void mmipal_get_link_packet_counts(uint32_t *tx_packets, uint32_t *rx_packets);
  */
 void mmipal_set_tx_qos_tid(uint8_t tid);
 
+/**
+ * Map an IP DSCP value to the QoS TID used to transmit packets carrying it.
+ *
+ * Outgoing packets are classified in the following order, with the first match used:
+ * 1. Flow rules added with @ref mmipal_add_tx_qos_rule().
+ * 2. The 802.1p priority of VLAN tagged frames.
+ * 3. The DSCP to TID map configured by this function.
+ * 4. The TID set with @ref mmipal_set_tx_qos_tid().
+ *
+ * All DSCP values are initially unmapped.
+ *
+ * @param dscp The DSCP value (0 - 63).
+ * @param tid  The QoS TID to use (0 - @ref MMWLAN_MAX_QOS_TID), or
+ *             @ref MMIPAL_TX_QOS_TID_UNMAPPED to remove the mapping.
+ *
+ * @returns @ref MMIPAL_SUCCESS on success, otherwise @ref MMIPAL_INVALID_ARGUMENT.
+ */
+enum mmipal_status mmipal_set_tx_qos_dscp_tid(uint8_t dscp, uint8_t tid);
+
+/** Flow rule used to select the QoS TID of outgoing packets. */
+struct mmipal_tx_qos_rule
+{
+    /** IP protocol number to match (e.g., 6 for TCP, 17 for UDP), or 0 to match any protocol. */
+    uint8_t ip_proto;
+    /** Local (source) port to match, or 0 to match any port. */
+    uint16_t local_port;
+    /** Remote (destination) port to match, or 0 to match any port. */
+    uint16_t remote_port;
+    /** The QoS TID to use for matching packets (0 - @ref MMWLAN_MAX_QOS_TID). */
+    uint8_t tid;
+};
+
+/**
+ * Add a flow rule used to select the QoS TID of outgoing packets.
+ *
+ * Rules are evaluated in the order they were added. Rules that specify a port only match
+ * TCP and UDP packets that are not IP fragments.
+ *
+ * @param rule The rule to add. The contents are copied.
+ *
+ * @returns @ref MMIPAL_SUCCESS on success, @ref MMIPAL_INVALID_ARGUMENT if the rule is invalid
+ *          or @ref MMIPAL_NO_MEM if @ref MMIPAL_MAX_TX_QOS_RULES rules have already been added.
+ */
+enum mmipal_status mmipal_add_tx_qos_rule(const struct mmipal_tx_qos_rule *rule);
+
+/**
+ * Remove all flow rules added with @ref mmipal_add_tx_qos_rule().
+ */
+void mmipal_clear_tx_qos_rules(void);
+
 /**
  * Gets the local address for the MMWLAN interface that is appropriate for a given
  * destination address.
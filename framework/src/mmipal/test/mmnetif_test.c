@@ -0,0 +1,411 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host test for the TX classifier in mmnetif.c. Every frame is classified whole and split across
+ * two pbufs at every offset, and truncated frames are classified at every length.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mmnetif.c"
+#include "mmutils.h"
+
+/** Number of octets of transport payload that follow the headers of a test frame. */
+#define TEST_PAYLOAD_LEN (30)
+
+/** Largest test frame: Ethernet and VLAN headers, IPv4 header with options, ports and payload. */
+#define TEST_MAX_FRAME_LEN (SIZEOF_ETH_HDR + SIZEOF_VLAN_HDR + 60 + 4 + TEST_PAYLOAD_LEN)
+
+/** IPv4 header length, in 32-bit words, without options. */
+#define TEST_IHL_NO_OPTIONS (5)
+
+/** IPv4 header length, in 32-bit words, with the most options. */
+#define TEST_IHL_MAX (15)
+
+/** IPv4 fragment offset field with a non-zero offset. */
+#define TEST_FRAG_NOT_FIRST (0x0010)
+
+/** IPv4 fragment offset field with only the more fragments flag set. */
+#define TEST_FRAG_MORE (0x2000)
+
+/** Headers of a test frame. */
+struct test_frame_args
+{
+    /** 802.1p priority of the VLAN tag, or -1 for an untagged frame. */
+    int vlan_pcp;
+    /** Whether the frame is IPv6 rather than IPv4. */
+    bool ipv6;
+    /** DSCP value. */
+    uint8_t dscp;
+    /** IP protocol number. */
+    uint8_t ip_proto;
+    /** IPv4 header length in 32-bit words. */
+    uint8_t ihl;
+    /** IPv4 flags and fragment offset. */
+    uint16_t frag;
+    /** Source port. */
+    uint16_t src_port;
+    /** Destination port. */
+    uint16_t dst_port;
+};
+
+/** A test frame and the TID it is expected to be classified to. */
+struct test_case
+{
+    /** Line of the test case, for reporting failures. */
+    int line;
+    /** Headers of the frame. */
+    struct test_frame_args args;
+    /** Expected TID. */
+    uint8_t tid;
+};
+
+/** Shorthand for a test case. */
+#define TEST_CASE(_tid, ...) { __LINE__, { __VA_ARGS__ }, (_tid) }
+
+static int test_failures;
+
+static struct netif_state test_state;
+
+static struct netif test_netif = { .state = &test_state };
+
+/** Record a failure if @p _cond does not hold, and carry on. */
+#define CHECK(_cond)                                                          \
+    do {                                                                      \
+        if (!(_cond))                                                         \
+        {                                                                     \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #_cond); \
+            test_failures++;                                                  \
+        }                                                                     \
+    } while (0)
+
+void mmosal_impl_assert(void)
+{
+    abort();
+}
+
+u16_t pbuf_copy_partial(const struct pbuf *buf, void *dataptr, u16_t len, u16_t offset)
+{
+    u16_t copied = 0;
+
+    for (; buf != NULL && copied < len; buf = buf->next)
+    {
+        if (offset >= buf->len)
+        {
+            offset -= buf->len;
+            continue;
+        }
+        u16_t chunk = MM_MIN(buf->len - offset, len - copied);
+        memcpy((uint8_t *)dataptr + copied, (const uint8_t *)buf->payload + offset, chunk);
+        copied += chunk;
+        offset = 0;
+    }
+    return copied;
+}
+
+/** Build a frame with the given headers, returning its length. */
+static unsigned test_build_frame(uint8_t *frame, const struct test_frame_args *args)
+{
+    unsigned offset = 2 * ETH_HWADDR_LEN;
+
+    memset(frame, 0, TEST_MAX_FRAME_LEN);
+    if (args->vlan_pcp >= 0)
+    {
+        frame[offset++] = ETHTYPE_VLAN >> 8;
+        frame[offset++] = ETHTYPE_VLAN & 0xff;
+        frame[offset++] = (args->vlan_pcp << 5) | 0x01;
+        frame[offset++] = 0x23;
+    }
+    if (args->ipv6)
+    {
+        frame[offset++] = ETHTYPE_IPV6 >> 8;
+        frame[offset++] = ETHTYPE_IPV6 & 0xff;
+        frame[offset] = 0x60 | (args->dscp >> 2);
+        frame[offset + 1] = (args->dscp & 0x03) << 6;
+        frame[offset + 6] = args->ip_proto;
+        offset += IP6_HLEN;
+    }
+    else
+    {
+        frame[offset++] = ETHTYPE_IP >> 8;
+        frame[offset++] = ETHTYPE_IP & 0xff;
+        frame[offset] = 0x40 | args->ihl;
+        frame[offset + 1] = args->dscp << 2;
+        frame[offset + 6] = args->frag >> 8;
+        frame[offset + 7] = args->frag & 0xff;
+        frame[offset + 9] = args->ip_proto;
+        offset += args->ihl * 4;
+    }
+    frame[offset] = args->src_port >> 8;
+    frame[offset + 1] = args->src_port & 0xff;
+    frame[offset + 2] = args->dst_port >> 8;
+    frame[offset + 3] = args->dst_port & 0xff;
+    return offset + 4 + TEST_PAYLOAD_LEN;
+}
+
+/**
+ * Classify the first @p len octets of a frame, split into two pbufs at @p split or held in one
+ * pbuf if @p split is 0. Each pbuf is allocated at its exact size so that any read past the end
+ * of the frame is caught by AddressSanitizer.
+ */
+static uint8_t test_classify(const uint8_t *frame, unsigned len, unsigned split)
+{
+    struct pbuf head = { 0 };
+    struct pbuf tail = { 0 };
+
+    if (split == 0 || split >= len)
+    {
+        split = len;
+    }
+
+    uint8_t *head_payload = malloc(split);
+    uint8_t *tail_payload = malloc(len - split + 1);
+    memcpy(head_payload, frame, split);
+    memcpy(tail_payload, frame + split, len - split);
+
+    head.payload = head_payload;
+    head.len = split;
+    head.tot_len = len;
+    head.next = (split < len) ? &tail : NULL;
+    tail.payload = tail_payload;
+    tail.len = len - split;
+    tail.tot_len = len - split;
+
+    uint8_t tid = mmnetif_classify_tx(&test_state, &head);
+
+    free(head_payload);
+    free(tail_payload);
+    return tid;
+}
+
+/** Check that each frame is classified as expected whether it is split or not. */
+static void test_check_cases(const struct test_case *cases, size_t num_cases)
+{
+    uint8_t frame[TEST_MAX_FRAME_LEN];
+
+    for (size_t ii = 0; ii < num_cases; ii++)
+    {
+        unsigned len = test_build_frame(frame, &cases[ii].args);
+        for (unsigned split = 0; split < len; split++)
+        {
+            uint8_t tid = test_classify(frame, len, split);
+            if (tid != cases[ii].tid)
+            {
+                printf("%s:%d: TID %u, expected %u (split at %u)\n",
+                       __FILE__, cases[ii].line, tid, cases[ii].tid, split);
+                test_failures++;
+                break;
+            }
+        }
+    }
+}
+
+static void test_reset(void)
+{
+    memset(&test_state, 0, sizeof(test_state));
+    memset(test_state.tx_qos_dscp_tid, MMIPAL_TX_QOS_TID_UNMAPPED,
+           sizeof(test_state.tx_qos_dscp_tid));
+}
+
+/* With nothing configured every frame uses the default TID, apart from the 802.1p priority of
+ * tagged frames. */
+static void test_default(void)
+{
+    static const struct test_case cases[] = {
+        TEST_CASE(3, -1, false, 46, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, 0, 5000, 5001),
+        TEST_CASE(3, -1, true, 46, IP_PROTO_UDP, 0, 0, 5000, 5001),
+        TEST_CASE(3, -1, false, 0, IP_PROTO_ICMP, TEST_IHL_NO_OPTIONS, 0, 0, 0),
+        TEST_CASE(4, 4, false, 46, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, 0, 5000, 5001),
+    };
+
+    test_reset();
+    mmnetif_set_tx_qos_tid(&test_netif, 3);
+    test_check_cases(cases, MM_ARRAY_COUNT(cases));
+}
+
+/* The DSCP map applies to both IPv4 and IPv6, and the 802.1p priority takes precedence. */
+static void test_dscp(void)
+{
+    static const struct test_case cases[] = {
+        TEST_CASE(6, -1, false, 46, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, 0, 1, 2),
+        TEST_CASE(6, -1, true, 46, IP_PROTO_TCP, 0, 0, 1, 2),
+        TEST_CASE(1, -1, true, 8, IP_PROTO_TCP, 0, 0, 1, 2),
+        TEST_CASE(1, -1, false, 8, IP_PROTO_TCP, TEST_IHL_MAX, 0, 1, 2),
+        TEST_CASE(0, -1, false, 10, IP_PROTO_TCP, TEST_IHL_NO_OPTIONS, 0, 1, 2),
+        TEST_CASE(5, 5, false, 46, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, 0, 1, 2),
+        TEST_CASE(0, 0, true, 46, IP_PROTO_UDP, 0, 0, 1, 2),
+    };
+
+    test_reset();
+    mmnetif_set_tx_qos_dscp_tid(&test_netif, 46, 6);
+    mmnetif_set_tx_qos_dscp_tid(&test_netif, 8, 1);
+    test_check_cases(cases, MM_ARRAY_COUNT(cases));
+
+    mmnetif_set_tx_qos_dscp_tid(&test_netif, 46, MMIPAL_TX_QOS_TID_UNMAPPED);
+    uint8_t frame[TEST_MAX_FRAME_LEN];
+    unsigned len = test_build_frame(frame, &cases[0].args);
+    CHECK(test_classify(frame, len, 0) == 0);
+}
+
+static void test_add_rules(void)
+{
+    static const struct mmipal_tx_qos_rule rules[] = {
+        { .ip_proto = IP_PROTO_UDP, .local_port = 0, .remote_port = 5353, .tid = 7 },
+        { .ip_proto = 0, .local_port = 22, .remote_port = 0, .tid = 5 },
+        { .ip_proto = IP_PROTO_TCP, .local_port = 0, .remote_port = 0, .tid = 2 },
+    };
+
+    test_reset();
+    mmnetif_set_tx_qos_dscp_tid(&test_netif, 46, 6);
+    mmnetif_set_tx_qos_dscp_tid(&test_netif, 8, 1);
+    for (size_t ii = 0; ii < MM_ARRAY_COUNT(rules); ii++)
+    {
+        CHECK(mmnetif_add_tx_qos_rule(&test_netif, &rules[ii]));
+    }
+}
+
+/* Flow rules are checked in order, 0 is a wildcard and the local port is the source port. Rules
+ * take precedence over the 802.1p priority and the DSCP map. */
+static void test_rules(void)
+{
+    static const struct test_case cases[] = {
+        TEST_CASE(7, -1, false, 0, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, 0, 4000, 5353),
+        TEST_CASE(7, -1, true, 0, IP_PROTO_UDP, 0, 0, 4000, 5353),
+        TEST_CASE(2, -1, false, 0, IP_PROTO_TCP, TEST_IHL_NO_OPTIONS, 0, 4000, 5353),
+        TEST_CASE(2, -1, true, 0, IP_PROTO_TCP, 0, 0, 4000, 5353),
+        TEST_CASE(5, -1, false, 0, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, 0, 22, 80),
+        TEST_CASE(5, -1, true, 0, IP_PROTO_TCP, 0, 0, 22, 80),
+        TEST_CASE(6, -1, false, 46, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, 0, 4000, 4001),
+        TEST_CASE(6, -1, true, 46, IP_PROTO_UDP, 0, 0, 4000, 4001),
+        TEST_CASE(7, 3, false, 0, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, 0, 4000, 5353),
+        TEST_CASE(7, 3, true, 0, IP_PROTO_UDP, 0, 0, 4000, 5353),
+        TEST_CASE(3, 3, false, 0, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, 0, 4000, 4001),
+        /* ICMP has no ports, so only protocol rules could match it. */
+        TEST_CASE(1, -1, false, 8, IP_PROTO_ICMP, TEST_IHL_NO_OPTIONS, 0, 22, 5353),
+        TEST_CASE(1, -1, true, 8, IP6_NEXTH_ICMP6, 0, 0, 22, 5353),
+        /* The ports follow the IPv4 options. */
+        TEST_CASE(7, -1, false, 0, IP_PROTO_UDP, TEST_IHL_MAX, 0, 4000, 5353),
+        TEST_CASE(7, 4, false, 0, IP_PROTO_UDP, TEST_IHL_MAX, 0, 4000, 5353),
+        /* Fragments other than the first have no ports, but protocol rules still match. */
+        TEST_CASE(6, -1, false, 46, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, TEST_FRAG_NOT_FIRST, 4000,
+                  5353),
+        TEST_CASE(2, -1, false, 46, IP_PROTO_TCP, TEST_IHL_NO_OPTIONS, TEST_FRAG_NOT_FIRST, 22,
+                  80),
+        TEST_CASE(7, -1, false, 46, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, TEST_FRAG_MORE, 4000, 5353),
+    };
+
+    test_add_rules();
+    test_check_cases(cases, MM_ARRAY_COUNT(cases));
+
+    mmnetif_clear_tx_qos_rules(&test_netif);
+    uint8_t frame[TEST_MAX_FRAME_LEN];
+    unsigned len = test_build_frame(frame, &cases[0].args);
+    CHECK(test_classify(frame, len, 0) == 0);
+}
+
+/* A rule is refused once the table is full. */
+static void test_rules_full(void)
+{
+    static const struct mmipal_tx_qos_rule rule = { .ip_proto = IP_PROTO_UDP, .tid = 1 };
+
+    test_reset();
+    for (unsigned ii = 0; ii < MMIPAL_MAX_TX_QOS_RULES; ii++)
+    {
+        CHECK(mmnetif_add_tx_qos_rule(&test_netif, &rule));
+    }
+    CHECK(!mmnetif_add_tx_qos_rule(&test_netif, &rule));
+}
+
+/* A truncated frame is classified on the headers that it holds in full. */
+static void test_truncated(void)
+{
+    static const struct test_frame_args ipv4 = {
+        -1, false, 46, IP_PROTO_UDP, TEST_IHL_NO_OPTIONS, 0, 22, 5353
+    };
+    static const struct test_frame_args ipv4_options = {
+        -1, false, 46, IP_PROTO_UDP, TEST_IHL_MAX, 0, 22, 5353
+    };
+    static const struct test_frame_args ipv6_vlan = { 2, true, 46, IP_PROTO_UDP, 0, 0, 22, 5353 };
+    uint8_t frame[TEST_MAX_FRAME_LEN];
+    unsigned full_len;
+    uint8_t tid;
+
+    test_add_rules();
+
+    full_len = test_build_frame(frame, &ipv4);
+    for (unsigned len = 1; len <= full_len; len++)
+    {
+        tid = test_classify(frame, len, len / 2);
+        if (len >= SIZEOF_ETH_HDR + IP_HLEN + 4)
+        {
+            CHECK(tid == 7);
+        }
+        else if (len >= SIZEOF_ETH_HDR + IP_HLEN)
+        {
+            CHECK(tid == 6);
+        }
+        else
+        {
+            CHECK(tid == 0);
+        }
+    }
+
+    full_len = test_build_frame(frame, &ipv4_options);
+    for (unsigned len = 1; len <= full_len; len++)
+    {
+        tid = test_classify(frame, len, len / 2);
+        if (len >= SIZEOF_ETH_HDR + TEST_IHL_MAX * 4 + 4)
+        {
+            CHECK(tid == 7);
+        }
+        else if (len >= SIZEOF_ETH_HDR + IP_HLEN)
+        {
+            CHECK(tid == 6);
+        }
+        else
+        {
+            CHECK(tid == 0);
+        }
+    }
+
+    full_len = test_build_frame(frame, &ipv6_vlan);
+    for (unsigned len = 1; len <= full_len; len++)
+    {
+        tid = test_classify(frame, len, len / 2);
+        if (len >= SIZEOF_ETH_HDR + SIZEOF_VLAN_HDR + IP6_HLEN + 4)
+        {
+            CHECK(tid == 7);
+        }
+        else if (len >= SIZEOF_ETH_HDR + SIZEOF_VLAN_HDR)
+        {
+            CHECK(tid == 2);
+        }
+        else
+        {
+            CHECK(tid == 0);
+        }
+    }
+}
+
+int main(void)
+{
+    test_default();
+    test_dscp();
+    test_rules();
+    test_rules_full();
+    test_truncated();
+
+    if (test_failures)
+    {
+        printf("%d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+    printf("All checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Functions that mmnetif.c links against but that the paths exercised by mmnetif_test.c never
+ * call. Reaching any of them fails the test.
+ */
+
+#include <stdlib.h>
+
+/** Define a function that must not be called by the test. */
+#define TEST_NOT_CALLED(_name) \
+    void _name(void);          \
+    void _name(void)           \
+    {                          \
+        abort();               \
+    }
+
+TEST_NOT_CALLED(etharp_output)
+TEST_NOT_CALLED(ethip6_output)
+TEST_NOT_CALLED(lock_tcpip_core)
+TEST_NOT_CALLED(memp_free_pool)
+TEST_NOT_CALLED(memp_init_pool)
+TEST_NOT_CALLED(memp_malloc_pool)
+TEST_NOT_CALLED(mmosal_calloc_)
+TEST_NOT_CALLED(mmosal_get_time_ms)
+TEST_NOT_CALLED(mmosal_printf)
+TEST_NOT_CALLED(mmosal_task_name)
+TEST_NOT_CALLED(mmpkt_release)
+TEST_NOT_CALLED(mmwlan_alloc_mmpkt_for_tx)
+TEST_NOT_CALLED(mmwlan_boot)
+TEST_NOT_CALLED(mmwlan_get_vif_mac_addr)
+TEST_NOT_CALLED(mmwlan_register_rx_pkt_ext_cb)
+TEST_NOT_CALLED(mmwlan_register_vif_state_cb)
+TEST_NOT_CALLED(mmwlan_tx_pkt)
+TEST_NOT_CALLED(mmwlan_tx_wait_until_ready)
+TEST_NOT_CALLED(netif_set_link_down)
+TEST_NOT_CALLED(netif_set_link_up)
+TEST_NOT_CALLED(pbuf_alloced_custom)
+TEST_NOT_CALLED(pbuf_free)
+TEST_NOT_CALLED(sys_mutex_lock)
+TEST_NOT_CALLED(sys_mutex_unlock)
+TEST_NOT_CALLED(tcpip_try_callback)
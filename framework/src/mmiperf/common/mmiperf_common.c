@@ -6,25 +6,68 @@
 #include <endian.h>
 
 #include "mmiperf_private.h"
+#include "mmutils.h"
 
-void iperf_finalize_report_and_invoke_callback(struct mmiperf_state *base_state,
-                                               uint32_t duration_ms,
-                                               enum mmiperf_report_type report_type)
+MM_WEAK uint64_t mmiperf_get_time_us(void)
 {
-    base_state->report.report_type = report_type;
-    base_state->report.duration_ms = duration_ms;
+    static uint32_t last_ticks;
+    static uint64_t tick_count_hi;
+    uint64_t ticks;
+
+    /* Extend the 32 bit tick counter to 64 bits so that the microsecond time does not wrap. */
+    MMOSAL_TASK_ENTER_CRITICAL();
+    uint32_t now_ticks = mmosal_get_time_ticks();
+    if (now_ticks < last_ticks)
+    {
+        tick_count_hi += (1ull << 32);
+    }
+    last_ticks = now_ticks;
+    ticks = tick_count_hi | now_ticks;
+    MMOSAL_TASK_EXIT_CRITICAL();
+
+    return ticks * 1000000 / mmosal_ticks_per_second();
+}
+
+void iperf_report_set_duration(struct mmiperf_report *report, uint32_t duration_ms)
+{
+    report->duration_ms = duration_ms;
     /* This shouldn't be possible in practice but, just in case, we clamp the duration
      * to be greater than or equal to zero. */
     if ((int32_t)duration_ms <= 0)
     {
-        base_state->report.duration_ms = 0;
-        base_state->report.bandwidth_kbitpsec = 0;
+        report->duration_ms = 0;
+        report->bandwidth_kbitpsec = 0;
     }
     else
     {
-        base_state->report.bandwidth_kbitpsec =
-            base_state->report.bytes_transferred * 8 / duration_ms;
+        report->bandwidth_kbitpsec = report->bytes_transferred * 8 / duration_ms;
     }
+}
+
+void iperf_report_update_latency_stats(const struct mmiperf_state *base_state,
+                                       struct mmiperf_report *report)
+{
+    if (base_state->delay_variation_hist != NULL)
+    {
+        iperf_histogram_summarise(base_state->delay_variation_hist, 1, &report->delay_variation);
+    }
+    if (base_state->one_way_latency_hist != NULL)
+    {
+        iperf_histogram_summarise(base_state->one_way_latency_hist, 1, &report->one_way_latency);
+    }
+    if (base_state->rtt_hists != NULL)
+    {
+        iperf_histogram_summarise(base_state->rtt_hists, base_state->num_rtt_hists, &report->rtt);
+    }
+}
+
+void iperf_finalize_report_and_invoke_callback(struct mmiperf_state *base_state,
+                                               uint32_t duration_ms,
+                                               enum mmiperf_report_type report_type)
+{
+    base_state->report.report_type = report_type;
+    iperf_report_set_duration(&base_state->report, duration_ms);
+    iperf_report_update_latency_stats(base_state, &base_state->report);
 
     if (base_state->report_fn != NULL)
     {
@@ -48,18 +91,8 @@ bool mmiperf_get_interim_report(mmiperf_handle_t handle, struct mmiperf_report *
      * it has been a while since the last time the report as updated. */
     if (report->report_type == MMIPERF_INTERRIM_REPORT)
     {
-        report->duration_ms = mmosal_get_time_ms() - base_state->time_started_ms;
-        /* This shouldn't be possible in practice but, just in case, we clamp the duration
-         * to be greater than or equal to zero. */
-        if ((int32_t)report->duration_ms <= 0)
-        {
-            report->duration_ms = 0;
-            report->bandwidth_kbitpsec = 0;
-        }
-        else
-        {
-            report->bandwidth_kbitpsec = report->bytes_transferred * 8 / report->duration_ms;
-        }
+        iperf_report_set_duration(report, mmosal_get_time_ms() - base_state->time_started_ms);
+        iperf_report_update_latency_stats(base_state, report);
     }
 
     return true;
@@ -78,11 +111,13 @@ void iperf_populate_udp_server_report(struct mmiperf_state *base_state,
     report->error_cnt = htobe32(base_state->report.error_count);
     report->outorder_cnt = htobe32(base_state->report.out_of_sequence_frames);
     report->datagrams = htobe32(base_state->report.rx_frames);
+    report->jitter1 = htobe32(base_state->report.jitter_us / 1000000);
+    report->jitter2 = htobe32(base_state->report.jitter_us % 1000000);
     report->IPGcnt = htobe32(base_state->report.ipg_count);
     report->IPGsum = htobe32(base_state->report.ipg_sum_ms);
 }
 
-bool iperf_parse_udp_server_report(struct mmiperf_state *base_state,
+bool iperf_parse_udp_server_report(struct mmiperf_report *result,
                                    const struct iperf_udp_header *hdr,
                                    const struct iperf_udp_server_report *report,
                                    enum iperf_version version)
@@ -110,14 +145,14 @@ bool iperf_parse_udp_server_report(struct mmiperf_state *base_state,
         }
     }
 
-    base_state->report.bytes_transferred = (uint64_t)be32toh(report->total_len1) << 32;
-    base_state->report.bytes_transferred |= be32toh(report->total_len2);
-    base_state->report.error_count = be32toh(report->error_cnt);
-    base_state->report.out_of_sequence_frames = be32toh(report->outorder_cnt);
-    base_state->report.rx_frames = be32toh(report->datagrams);
-    base_state->report.duration_ms =
-        be32toh(report->stop_sec) * 1000 + be32toh(report->stop_usec) / 1000;
+    result->bytes_transferred = (uint64_t)be32toh(report->total_len1) << 32;
+    result->bytes_transferred |= be32toh(report->total_len2);
+    result->error_count = be32toh(report->error_cnt);
+    result->out_of_sequence_frames = be32toh(report->outorder_cnt);
+    result->rx_frames = be32toh(report->datagrams);
+    result->duration_ms = be32toh(report->stop_sec) * 1000 + be32toh(report->stop_usec) / 1000;
+    result->jitter_us = be32toh(report->jitter1) * 1000000 + be32toh(report->jitter2);
     /* This will be calculated later. */
-    base_state->report.bandwidth_kbitpsec = 0;
+    result->bandwidth_kbitpsec = 0;
     return true;
 }
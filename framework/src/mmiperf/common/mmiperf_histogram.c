@@ -0,0 +1,115 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include "mmiperf_private.h"
+
+/** Largest value that can be recorded; larger samples are clamped to this. */
+#define MAX_VALUE ((1ul << IPERF_HISTOGRAM_MAX_VALUE_BITS) - 1)
+
+void iperf_histogram_add(struct iperf_histogram *hist, uint32_t value_us)
+{
+    if (value_us > MAX_VALUE)
+    {
+        value_us = MAX_VALUE;
+    }
+
+    if (hist->count == 0 || value_us < hist->min)
+    {
+        hist->min = value_us;
+    }
+    if (value_us > hist->max)
+    {
+        hist->max = value_us;
+    }
+    hist->count++;
+    hist->sum += value_us;
+    hist->buckets[mmhist_bucket_index(value_us,
+                                      IPERF_HISTOGRAM_SUB_BUCKET_BITS,
+                                      IPERF_HISTOGRAM_MAX_VALUE_BITS)]++;
+}
+
+/**
+ * Find the given percentile across a set of histograms.
+ *
+ * @param hists      Array of histograms.
+ * @param num_hists  Number of histograms in @p hists.
+ * @param count      Total number of samples across all histograms.
+ * @param per_mille  The percentile to find, in units of 0.1%.
+ *
+ * @returns the upper bound of the bucket that contains the percentile.
+ */
+static uint32_t iperf_histogram_percentile(const struct iperf_histogram *hists,
+                                           unsigned num_hists,
+                                           uint32_t count,
+                                           uint32_t per_mille)
+{
+    uint32_t rank = mmhist_percentile_rank(count, per_mille);
+    uint32_t cumulative = 0;
+    unsigned ii;
+
+    for (ii = 0; ii < IPERF_HISTOGRAM_NUM_BUCKETS; ii++)
+    {
+        unsigned jj;
+        for (jj = 0; jj < num_hists; jj++)
+        {
+            cumulative += hists[jj].buckets[ii];
+        }
+        if (cumulative >= rank)
+        {
+            return mmhist_bucket_upper_bound(ii, IPERF_HISTOGRAM_SUB_BUCKET_BITS);
+        }
+    }
+
+    return MAX_VALUE;
+}
+
+void iperf_histogram_summarise(const struct iperf_histogram *hists,
+                               unsigned num_hists,
+                               struct mmiperf_latency_stats *stats)
+{
+    uint64_t sum = 0;
+    unsigned ii;
+
+    memset(stats, 0, sizeof(*stats));
+
+    for (ii = 0; ii < num_hists; ii++)
+    {
+        const struct iperf_histogram *hist = &hists[ii];
+        if (hist->count == 0)
+        {
+            continue;
+        }
+        if (stats->count == 0 || hist->min < stats->min_us)
+        {
+            stats->min_us = hist->min;
+        }
+        if (hist->max > stats->max_us)
+        {
+            stats->max_us = hist->max;
+        }
+        stats->count += hist->count;
+        sum += hist->sum;
+    }
+
+    if (stats->count == 0)
+    {
+        return;
+    }
+
+    stats->mean_us = (uint32_t)(sum / stats->count);
+    stats->p50_us = iperf_histogram_percentile(hists, num_hists, stats->count, 500);
+    stats->p90_us = iperf_histogram_percentile(hists, num_hists, stats->count, 900);
+    stats->p99_us = iperf_histogram_percentile(hists, num_hists, stats->count, 990);
+    stats->p999_us = iperf_histogram_percentile(hists, num_hists, stats->count, 999);
+
+    /* Bucket upper bounds may overshoot the actual range of the samples. */
+    stats->p50_us = mmhist_clamp(stats->p50_us, stats->min_us, stats->max_us);
+    stats->p90_us = mmhist_clamp(stats->p90_us, stats->min_us, stats->max_us);
+    stats->p99_us = mmhist_clamp(stats->p99_us, stats->min_us, stats->max_us);
+    stats->p999_us = mmhist_clamp(stats->p999_us, stats->min_us, stats->max_us);
+}
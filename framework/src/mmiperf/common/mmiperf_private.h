@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include "mmhist.h"
 #include "mmiperf.h"
 #include "mmosal.h"
 
@@ -139,6 +140,57 @@ struct iperf_udp_server_report
     int32_t IPGsum;
 };
 
+/** Number of linear sub-buckets per power of two in an @ref iperf_histogram, as a power of 2. */
+#define IPERF_HISTOGRAM_SUB_BUCKET_BITS (3)
+
+/** Samples are clamped to be less than 2^IPERF_HISTOGRAM_MAX_VALUE_BITS microseconds. */
+#ifndef IPERF_HISTOGRAM_MAX_VALUE_BITS
+#define IPERF_HISTOGRAM_MAX_VALUE_BITS (22)
+#endif
+
+/** Number of buckets in an @ref iperf_histogram. */
+#define IPERF_HISTOGRAM_NUM_BUCKETS \
+    MMHIST_NUM_BUCKETS(IPERF_HISTOGRAM_SUB_BUCKET_BITS, IPERF_HISTOGRAM_MAX_VALUE_BITS)
+
+/**
+ * Fixed size log-linear histogram of latency samples (in microseconds).
+ *
+ * Each power of two range is divided into linearly spaced sub-buckets, giving a constant
+ * relative error across the whole range without requiring any dynamic allocation.
+ */
+struct iperf_histogram
+{
+    /** Number of samples recorded. */
+    uint32_t count;
+    /** Smallest sample recorded. */
+    uint32_t min;
+    /** Largest sample recorded. */
+    uint32_t max;
+    /** Sum of all samples recorded. */
+    uint64_t sum;
+    /** Sample count for each bucket. */
+    uint32_t buckets[IPERF_HISTOGRAM_NUM_BUCKETS];
+};
+
+/**
+ * Record a sample in a histogram.
+ *
+ * @param hist     The histogram to update.
+ * @param value_us The sample value in microseconds.
+ */
+void iperf_histogram_add(struct iperf_histogram *hist, uint32_t value_us);
+
+/**
+ * Summarise one or more histograms as a combined distribution.
+ *
+ * @param hists     Array of histograms to summarise.
+ * @param num_hists Number of histograms in @p hists.
+ * @param stats     Summary to populate.
+ */
+void iperf_histogram_summarise(const struct iperf_histogram *hists,
+                               unsigned num_hists,
+                               struct mmiperf_latency_stats *stats);
+
 struct mmiperf_state
 {
     /* Allow these state structures to be collected as a linked list. */
@@ -158,6 +210,14 @@ struct mmiperf_state
     mmiperf_report_fn report_fn;
     /** Argument to pass to callback function. */
     void *report_arg;
+    /** Histogram of transit time variation to include in reports, or @c NULL. */
+    const struct iperf_histogram *delay_variation_hist;
+    /** Histogram of one-way latency to include in reports, or @c NULL. */
+    const struct iperf_histogram *one_way_latency_hist;
+    /** Array of round trip time histograms to combine in reports, or @c NULL. */
+    const struct iperf_histogram *rtt_hists;
+    /** Number of entries in @c rtt_hists. */
+    uint8_t num_rtt_hists;
 };
 
 /** Add an iperf session to the 'active' list */
@@ -166,6 +226,23 @@ void iperf_list_add(struct mmiperf_state *item);
 /** Remove an iperf session from the 'active' list */
 void iperf_list_remove(struct mmiperf_state *item);
 
+/**
+ * Set the duration of the given report and update its bandwidth accordingly.
+ *
+ * @param report      The report to update.
+ * @param duration_ms Duration of the test in milliseconds.
+ */
+void iperf_report_set_duration(struct mmiperf_report *report, uint32_t duration_ms);
+
+/**
+ * Update the latency statistics of a report from the histograms of the given session.
+ *
+ * @param base_state Iperf session state data structure.
+ * @param report     The report to update.
+ */
+void iperf_report_update_latency_stats(const struct mmiperf_state *base_state,
+                                       struct mmiperf_report *report);
+
 /** Update the report data for the given iperf session based on the given time. */
 void iperf_finalize_report_and_invoke_callback(struct mmiperf_state *state,
                                                uint32_t duration_ms,
@@ -183,13 +260,12 @@ void iperf_populate_udp_server_report(struct mmiperf_state *base_state,
 /**
  * Parse an iperf UDP server report received from a server.
  *
- * @param base_state Iperf session state data structure. This will be updated based on the
- *                      received report.
+ * @param result     The report data structure to update based on the received report.
  * @param hdr        The iperf UDP header in the iperf frame.
  * @param report     The iperf UDP server report in the iperf frame.
  * @param version    The iperf version.
  */
-bool iperf_parse_udp_server_report(struct mmiperf_state *base_state,
+bool iperf_parse_udp_server_report(struct mmiperf_report *result,
                                    const struct iperf_udp_header *hdr,
                                    const struct iperf_udp_server_report *report,
                                    enum iperf_version version);
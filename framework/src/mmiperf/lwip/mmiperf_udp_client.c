@@ -7,6 +7,7 @@
 #include <stdatomic.h>
 
 #include "lwip/err.h"
+#include "mmhal_core.h"
 #include "mmosal.h"
 #include "../common/mmiperf_private.h"
 #include "mmiperf_lwip.h"
@@ -20,6 +21,43 @@
 /* Currently, only UDP is implemented */
 #if LWIP_UDP && LWIP_CALLBACK_API
 
+/**
+ * Maximum amount of time (in microseconds) that a paced stream may fall behind its schedule
+ * before the schedule is reset. This bounds the burst that is sent to catch up after a stall
+ * (e.g., a transmit failure).
+ */
+#ifndef IPERF_UDP_CLIENT_MAX_PACING_LAG_US
+#define IPERF_UDP_CLIENT_MAX_PACING_LAG_US (20000)
+#endif
+
+struct iperf_client_state_udp;
+
+/** State for a single stream of a UDP iperf client session. */
+struct iperf_udp_client_stream
+{
+    /** The session that this stream belongs to. */
+    struct iperf_client_state_udp *session;
+    /** PCB used to send and receive for this stream. */
+    struct udp_pcb *pcb;
+    /** Statistics for this stream. */
+    struct mmiperf_report report;
+    /** Report received from the server for this stream, or @c NULL if not yet received. */
+    struct pbuf *server_report;
+    /** True once the final packet has been sent and we are waiting for the server report. */
+    bool awaiting_report;
+    /** True once the final packet has been sent for this stream. */
+    bool done;
+    /** Number of bytes remaining to be sent (if the test is limited by amount). */
+    uint64_t remaining_amount;
+    /** Time at which the next packet of this stream is due to be sent. */
+    uint64_t next_tx_time_us;
+    /** End of the current block (@ref MMIPERF_TRAFFIC_BLOCK) or on period
+     *  (@ref MMIPERF_TRAFFIC_ON_OFF). */
+    uint64_t period_end_time_us;
+    /** Amount of data that may still be sent in the current block (@ref MMIPERF_TRAFFIC_BLOCK). */
+    uint32_t block_remaining_tx_amount;
+};
+
 struct iperf_client_state_udp
 {
     struct mmiperf_state base;
@@ -29,18 +67,22 @@ struct iperf_client_state_udp
     ip_addr_t server_addr;
 
     /* State */
-    struct udp_pcb *pcb;
-    uint16_t local_port;
-    uint32_t check_interval;
     struct mmosal_task *task;
     struct mmosal_semb *report_semb;
-    bool awaiting_report;
-    struct pbuf *report;
-    int32_t next_packet_id;
 
     /* block parameter for bandwdith limit */
     uint32_t block_tx_amount;
 
+    /** Mean interval between packets of each stream in microseconds (0 means unpaced). */
+    uint32_t tx_interval_us;
+
+    /** Per stream state. Only the first @c args.num_streams entries are used. */
+    struct iperf_udp_client_stream streams[MMIPERF_MAX_STREAMS];
+
+    /** Per stream round trip time histograms (only used if @c args.rtt_echo is set). These are
+     *  kept in a separate array so that they can be combined for the aggregate report. */
+    struct iperf_histogram rtt_hists[MMIPERF_MAX_STREAMS];
+
     /** True when mmiperf_stop() has been called for this session. */
     bool stop_requested;
 };
@@ -49,16 +91,21 @@ struct iperf_client_state_udp
 #define min(a, b) ((b) < (a) ? (b) : (a))
 #endif
 
+#ifndef max
+#define max(a, b) ((b) > (a) ? (b) : (a))
+#endif
+
 /* ip_addr_cmp_zoneless may not be defined if IPv6 is not enabled. In that case we don't have
  * zones so a normal compare is sufficient. */
 #ifndef ip_addr_cmp_zoneless
 #define ip_addr_cmp_zoneless(addr1, addr2) ip_addr_cmp(addr1, addr2)
 #endif
 
-static err_t iperf_udp_client_send_packet(struct iperf_client_state_udp *session,
+static err_t iperf_udp_client_send_packet(struct iperf_udp_client_stream *stream,
                                           uint32_t tx_amount,
                                           bool final)
 {
+    struct iperf_client_state_udp *session = stream->session;
     struct iperf_udp_header *udp_hdr;
     struct iperf_settings *settings;
     uint32_t hdrs_len = sizeof(*udp_hdr) + sizeof(*settings);
@@ -81,7 +128,7 @@ static err_t iperf_udp_client_send_packet(struct iperf_client_state_udp *session
         LWIP_PLATFORM_ASSERT("pbuf length mismatch");
     }
 
-    int64_t datagrams_cnt = session->base.report.tx_frames;
+    int64_t datagrams_cnt = stream->report.tx_frames;
     if (final)
     {
         datagrams_cnt = -datagrams_cnt;
@@ -97,9 +144,9 @@ static err_t iperf_udp_client_send_packet(struct iperf_client_state_udp *session
         udp_hdr->id_lo = htonl((uint32_t)((uint64_t)datagrams_cnt));
         udp_hdr->id_hi = htonl((uint32_t)(((uint64_t)datagrams_cnt) >> 32));
     }
-    uint32_t now = sys_now();
-    udp_hdr->tv_usec = htonl((now % 1000) * 1000);
-    udp_hdr->tv_sec = htonl(now / 1000);
+    uint64_t now_us = mmiperf_get_time_us();
+    udp_hdr->tv_usec = htonl((uint32_t)(now_us % 1000000));
+    udp_hdr->tv_sec = htonl((uint32_t)(now_us / 1000000));
 
     settings = (struct iperf_settings *)(udp_hdr + 1);
     memset(settings, 0, sizeof(*settings));
@@ -123,7 +170,7 @@ static err_t iperf_udp_client_send_packet(struct iperf_client_state_udp *session
 
     LOCK_TCPIP_CORE();
     err_t err =
-        udp_sendto(session->pcb, hdrs_pbuf, &(session->server_addr), session->args.server_port);
+        udp_sendto(stream->pcb, hdrs_pbuf, &(session->server_addr), session->args.server_port);
     UNLOCK_TCPIP_CORE();
     pbuf_free(hdrs_pbuf);
     if (err != ERR_OK)
@@ -135,175 +182,475 @@ static err_t iperf_udp_client_send_packet(struct iperf_client_state_udp *session
     return ERR_OK;
 }
 
-static void iperf_udp_client_report(struct iperf_client_state_udp *session,
-                                    uint32_t *final_duration_ms)
+static void iperf_udp_client_report(struct iperf_udp_client_stream *stream)
 {
     struct iperf_udp_header hdr;
     struct iperf_udp_server_report report;
 
-    uint16_t copy_len = pbuf_copy_partial(session->report, &hdr, sizeof(hdr), 0);
+    uint16_t copy_len = pbuf_copy_partial(stream->server_report, &hdr, sizeof(hdr), 0);
     if (copy_len != sizeof(hdr))
     {
         LWIP_DEBUGF(LWIP_DBG_LEVEL_WARNING, ("iperf UDP received report too short\n"));
         return;
     }
 
-    copy_len = pbuf_copy_partial(session->report, &report, sizeof(report), sizeof(hdr));
+    copy_len = pbuf_copy_partial(stream->server_report, &report, sizeof(report), sizeof(hdr));
     if (copy_len != sizeof(report))
     {
         LWIP_DEBUGF(LWIP_DBG_LEVEL_WARNING, ("iperf UDP received report too short\n"));
         return;
     }
 
-    iperf_parse_udp_server_report(&session->base, &hdr, &report, session->args.version);
-    *final_duration_ms = session->base.report.duration_ms;
+    iperf_parse_udp_server_report(&stream->report, &hdr, &report, stream->session->args.version);
+}
+
+/**
+ * Generate an exponentially distributed random interval.
+ *
+ * This uses the inverse transform method, @c -mean*ln(U) for uniformly distributed @c U, with
+ * a fixed point approximation of the logarithm so that we do not depend on floating point
+ * maths support.
+ *
+ * @param mean_us The mean of the distribution in microseconds.
+ *
+ * @returns a random interval in microseconds.
+ */
+static uint64_t iperf_udp_client_exp_interval_us(uint32_t mean_us)
+{
+    /* ln(2) in Q16 fixed point. */
+    const uint32_t ln2_q16 = 45426;
+    /* Coefficient for log2(1 + f) ~= f + c * f * (1 - f), in Q16 fixed point. */
+    const uint32_t log2_coeff_q16 = 22713;
+
+    uint32_t x = mmhal_random_u32(1, UINT32_MAX);
+    uint32_t msb = 31 - __builtin_clz(x);
+
+    /* Fractional part of log2(x) in Q16, derived from the bits below the most significant bit. */
+    uint32_t frac = (msb >= 16) ? (x >> (msb - 16)) : (x << (16 - msb));
+    frac -= (1ul << 16);
+    frac += (uint32_t)(((uint64_t)frac * ((1ul << 16) - frac) * log2_coeff_q16) >> 32);
+
+    /* -ln(x / 2^32) = (32 - log2(x)) * ln(2) */
+    uint32_t neg_log2_q16 = (32ul << 16) - ((msb << 16) + frac);
+    uint64_t neg_ln_q16 = ((uint64_t)neg_log2_q16 * ln2_q16) >> 16;
+
+    return (mean_us * neg_ln_q16) >> 16;
+}
+
+/**
+ * Work out when the next packet of the given stream should be sent, based on the configured
+ * traffic shape. This is invoked after each packet has been sent.
+ *
+ * @param stream    The stream to schedule.
+ * @param tx_amount The amount of data that was just sent.
+ * @param now_us    The current time in microseconds.
+ */
+static void iperf_udp_client_schedule_next(struct iperf_udp_client_stream *stream,
+                                           uint32_t tx_amount,
+                                           uint64_t now_us)
+{
+    struct iperf_client_state_udp *session = stream->session;
+    uint64_t next_tx_time_us = now_us;
+
+    if (session->args.traffic_shape == MMIPERF_TRAFFIC_BLOCK)
+    {
+        /* when bw_limit is not set, always send packets without checking the block budget */
+        if (session->block_tx_amount != 0)
+        {
+            stream->block_remaining_tx_amount -= min(stream->block_remaining_tx_amount, tx_amount);
+            if (stream->block_remaining_tx_amount < session->args.packet_size)
+            {
+                next_tx_time_us = max(stream->period_end_time_us, now_us);
+                stream->period_end_time_us = next_tx_time_us + BLOCK_DURATION_MS * 1000;
+                stream->block_remaining_tx_amount += session->block_tx_amount;
+            }
+        }
+        stream->next_tx_time_us = next_tx_time_us;
+        return;
+    }
+
+    if (session->tx_interval_us != 0)
+    {
+        /* Advance from the previous scheduled time rather than the current time so that
+         * scheduling jitter does not accumulate, but do not let the schedule lag too far behind
+         * or we will send a large burst to catch up. */
+        next_tx_time_us = stream->next_tx_time_us;
+        if (next_tx_time_us + IPERF_UDP_CLIENT_MAX_PACING_LAG_US < now_us)
+        {
+            next_tx_time_us = now_us - IPERF_UDP_CLIENT_MAX_PACING_LAG_US;
+        }
+        if (session->args.traffic_shape == MMIPERF_TRAFFIC_POISSON)
+        {
+            next_tx_time_us += iperf_udp_client_exp_interval_us(session->tx_interval_us);
+        }
+        else
+        {
+            next_tx_time_us += session->tx_interval_us;
+        }
+    }
+
+    if (session->args.traffic_shape == MMIPERF_TRAFFIC_ON_OFF)
+    {
+        /* If the next packet would fall outside the on period, defer it to the start of the
+         * following on period. */
+        while (next_tx_time_us >= stream->period_end_time_us)
+        {
+            next_tx_time_us = stream->period_end_time_us + session->args.off_time_ms * 1000ull;
+            stream->period_end_time_us = next_tx_time_us + session->args.on_time_ms * 1000ull;
+        }
+    }
+
+    stream->next_tx_time_us = next_tx_time_us;
+}
+
+/**
+ * Select the stream whose next packet is due soonest.
+ *
+ * @param session The iperf client session.
+ *
+ * @returns the selected stream, or @c NULL if all streams are done.
+ */
+static struct iperf_udp_client_stream *iperf_udp_client_next_stream(
+    struct iperf_client_state_udp *session)
+{
+    struct iperf_udp_client_stream *next = NULL;
+    unsigned ii;
+
+    for (ii = 0; ii < session->args.num_streams; ii++)
+    {
+        struct iperf_udp_client_stream *stream = &session->streams[ii];
+        if (!stream->done && (next == NULL || stream->next_tx_time_us < next->next_tx_time_us))
+        {
+            next = stream;
+        }
+    }
+
+    return next;
+}
+
+/**
+ * Wait until the given time. Delays shorter than an OS tick sleep until the next tick rather
+ * than spinning. Since @ref iperf_udp_client_schedule_next() advances from the previous
+ * scheduled time rather than the time the packet was actually sent, any lateness this introduces
+ * is made up by the packets that follow.
+ *
+ * @param wake_time_us The time to wait until.
+ * @param now_us       The current time in microseconds.
+ */
+static void iperf_udp_client_wait_until(uint64_t wake_time_us, uint64_t now_us)
+{
+    uint32_t tick_ms = max(1000 / mmosal_ticks_per_second(), 1);
+    uint32_t delay_ms = (uint32_t)min((wake_time_us - now_us + 999) / 1000, UINT32_MAX);
+
+    mmosal_task_sleep(max(delay_ms, tick_ms));
+}
+
+/**
+ * Check whether a server report has been received for every stream.
+ *
+ * @param session The iperf client session.
+ *
+ * @returns @c true if all reports have been received, else @c false.
+ */
+static bool iperf_udp_client_all_reports_received(struct iperf_client_state_udp *session)
+{
+    unsigned ii;
+    for (ii = 0; ii < session->args.num_streams; ii++)
+    {
+        if (session->streams[ii].server_report == NULL)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Wait for the server reports of all streams to be received, or for the report timeout to
+ * elapse.
+ *
+ * @param session The iperf client session.
+ */
+static void iperf_udp_client_wait_for_reports(struct iperf_client_state_udp *session)
+{
+    uint32_t timeout_at = mmosal_get_time_ms() + IPERF_UDP_CLIENT_REPORT_TIMEOUT_MS;
+
+    while (!iperf_udp_client_all_reports_received(session))
+    {
+        int32_t remaining_ms = (int32_t)(timeout_at - mmosal_get_time_ms());
+        if (remaining_ms <= 0 || !mmosal_semb_wait(session->report_semb, remaining_ms))
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * Combine the per stream statistics into the session report.
+ *
+ * @param session The iperf client session.
+ *
+ * @returns the duration of the longest stream in milliseconds.
+ */
+static uint32_t iperf_udp_client_aggregate_reports(struct iperf_client_state_udp *session)
+{
+    struct mmiperf_report *aggregate = &session->base.report;
+    uint32_t duration_ms = 0;
+    unsigned ii;
+
+    aggregate->bytes_transferred = 0;
+    aggregate->tx_frames = 0;
+    aggregate->rx_frames = 0;
+    aggregate->error_count = 0;
+    aggregate->out_of_sequence_frames = 0;
+
+    for (ii = 0; ii < session->args.num_streams; ii++)
+    {
+        const struct mmiperf_report *report = &session->streams[ii].report;
+        aggregate->bytes_transferred += report->bytes_transferred;
+        aggregate->tx_frames += report->tx_frames;
+        aggregate->rx_frames += report->rx_frames;
+        aggregate->error_count += report->error_count;
+        aggregate->out_of_sequence_frames += report->out_of_sequence_frames;
+        duration_ms = max(duration_ms, report->duration_ms);
+    }
+
+    return duration_ms;
 }
 
 static void iperf_udp_client_task(void *arg)
 {
     struct iperf_client_state_udp *session = (struct iperf_client_state_udp *)arg;
 
-    uint32_t end_time = UINT32_MAX;
-    uint64_t remaining_amount = UINT64_MAX;
+    uint64_t now_us = mmiperf_get_time_us();
+    uint64_t end_time_us = UINT64_MAX;
+    uint64_t amount = UINT64_MAX;
+    unsigned ii;
 
     /* A negative amount means it is a time (in hundredths of seconds), a postive amount is
      * number of bytes. */
     if (session->args.amount < 0)
     {
-        end_time = session->base.time_started_ms + (-(session->args.amount) * 10);
+        end_time_us = now_us + (-(int64_t)session->args.amount) * 10000;
     }
     else
     {
-        remaining_amount = session->args.amount;
+        amount = session->args.amount;
     }
 
     uint32_t tx_amount = 0;
-    bool final = false;
     unsigned failure_cnt = 0;
 
-    /* if no input for bandwidth limit, set bw_limit flag to false */
-    bool bw_limit = true;
-    if (session->args.target_bw == 0)
-    {
-        bw_limit = false;
-    }
-    uint32_t block_end_time = sys_now() + BLOCK_DURATION_MS;
-    uint32_t block_remaining_tx_amount = session->block_tx_amount;
-
     const char *result;
 
-    result = ipaddr_ntoa_r(&session->pcb->local_ip,
+    result = ipaddr_ntoa_r(&session->streams[0].pcb->local_ip,
                            session->base.report.local_addr,
                            sizeof(session->base.report.local_addr));
-    session->base.report.local_port = session->pcb->local_port;
+    session->base.report.local_port = session->streams[0].pcb->local_port;
     LWIP_ASSERT("IP buf too short", result != NULL);
     mmosal_safer_strcpy(session->base.report.remote_addr,
                         session->args.server_addr,
                         sizeof(session->base.report.remote_addr));
     session->base.report.remote_port = session->args.server_port;
 
-    while (!final && failure_cnt < IPERF_UDP_CLIENT_MAX_CONSEC_FAILURES)
+    for (ii = 0; ii < session->args.num_streams; ii++)
+    {
+        struct iperf_udp_client_stream *stream = &session->streams[ii];
+
+        memcpy(&stream->report, &session->base.report, sizeof(stream->report));
+        stream->report.local_port = stream->pcb->local_port;
+        stream->report.stream_index = ii;
+        stream->report.dscp = session->args.dscp[ii];
+        stream->remaining_amount = amount;
+        stream->next_tx_time_us = now_us;
+        if (session->args.traffic_shape == MMIPERF_TRAFFIC_ON_OFF)
+        {
+            stream->period_end_time_us = now_us + session->args.on_time_ms * 1000ull;
+        }
+        else
+        {
+            stream->period_end_time_us = now_us + BLOCK_DURATION_MS * 1000;
+            stream->block_remaining_tx_amount = session->block_tx_amount;
+        }
+    }
+
+    while (failure_cnt < IPERF_UDP_CLIENT_MAX_CONSEC_FAILURES)
     {
         if (session->stop_requested)
         {
             break;
         }
-        /* If this is the last packet then set the counter to negative to inform the other side. */
-        if (sys_now() > end_time ||
-            remaining_amount <= (uint64_t)session->args.packet_size ||
-            session->base.report.tx_frames >= UINT32_MAX - 10)
+
+        struct iperf_udp_client_stream *stream = iperf_udp_client_next_stream(session);
+        if (stream == NULL)
         {
-            final = true;
-            session->awaiting_report = true;
+            break;
         }
-        tx_amount = min(remaining_amount, session->args.packet_size);
 
-        /* when bw_limit is set to false, always send packets without check block parameter */
-        if (bw_limit && block_end_time < sys_now())
+        now_us = mmiperf_get_time_us();
+        if (stream->next_tx_time_us > now_us && now_us < end_time_us)
         {
-            block_end_time = sys_now() + BLOCK_DURATION_MS;
-            block_remaining_tx_amount += session->block_tx_amount;
+            iperf_udp_client_wait_until(min(stream->next_tx_time_us, end_time_us), now_us);
+            continue;
         }
-        if (!bw_limit || block_remaining_tx_amount >= tx_amount || sys_now() > end_time)
+
+        /* If this is the last packet then set the counter to negative to inform the other side. */
+        bool final = false;
+        if (now_us >= end_time_us ||
+            stream->remaining_amount <= (uint64_t)session->args.packet_size ||
+            stream->report.tx_frames >= UINT32_MAX - 10)
         {
-            err_t err = iperf_udp_client_send_packet(session, tx_amount, final);
+            final = true;
+            stream->awaiting_report = true;
+            stream->done = true;
+        }
+        tx_amount = min(stream->remaining_amount, session->args.packet_size);
 
-            if (err == ERR_OK)
-            {
-                session->base.report.bytes_transferred += tx_amount;
-                session->base.report.tx_frames++;
-                remaining_amount -= tx_amount;
-                block_remaining_tx_amount -= tx_amount;
-                failure_cnt = 0;
-            }
-            else
-            {
-                failure_cnt++;
-                mmosal_task_sleep(IPERF_UDP_CLIENT_RETRY_WAIT_TIME_MS);
-            }
+        err_t err = iperf_udp_client_send_packet(stream, tx_amount, final);
+        if (err == ERR_OK)
+        {
+            stream->report.bytes_transferred += tx_amount;
+            stream->report.tx_frames++;
+            session->base.report.bytes_transferred += tx_amount;
+            session->base.report.tx_frames++;
+            stream->remaining_amount -= tx_amount;
+            failure_cnt = 0;
+            iperf_udp_client_schedule_next(stream, tx_amount, now_us);
         }
         else
         {
-            mmosal_task_sleep(1);
+            failure_cnt++;
+            mmosal_task_sleep(IPERF_UDP_CLIENT_RETRY_WAIT_TIME_MS);
         }
     }
     /* When stopped early, send final packet (negative count) to notify server. */
     if (session->stop_requested)
     {
-        session->awaiting_report = true;
-        tx_amount = min(remaining_amount, session->args.packet_size);
-        if (tx_amount == 0)
+        for (ii = 0; ii < session->args.num_streams; ii++)
         {
-            tx_amount = session->args.packet_size;
+            struct iperf_udp_client_stream *stream = &session->streams[ii];
+            if (stream->done)
+            {
+                continue;
+            }
+            stream->awaiting_report = true;
+            stream->done = true;
+            tx_amount = min(stream->remaining_amount, session->args.packet_size);
+            if (tx_amount == 0)
+            {
+                tx_amount = session->args.packet_size;
+            }
+            iperf_udp_client_send_packet(stream, tx_amount, true);
         }
-        iperf_udp_client_send_packet(session, tx_amount, true);
     }
     /* Wait for status report from other end.  Use a binary semaphore to block us until
      * we receive report. */
-    mmosal_semb_wait(session->report_semb, IPERF_UDP_CLIENT_REPORT_TIMEOUT_MS);
+    iperf_udp_client_wait_for_reports(session);
     if (!ip_addr_ismulticast(&(session->server_addr)))
     {
-        unsigned ii;
-        for (ii = 0; ii < IPERF_UDP_CLIENT_REPORT_RETRIES && session->report == NULL; ii++)
+        for (ii = 0; ii < IPERF_UDP_CLIENT_REPORT_RETRIES; ii++)
         {
-            iperf_udp_client_send_packet(session, tx_amount, true);
-            mmosal_semb_wait(session->report_semb, IPERF_UDP_CLIENT_REPORT_TIMEOUT_MS);
+            if (iperf_udp_client_all_reports_received(session))
+            {
+                break;
+            }
+
+            unsigned jj;
+            for (jj = 0; jj < session->args.num_streams; jj++)
+            {
+                struct iperf_udp_client_stream *stream = &session->streams[jj];
+                if (stream->awaiting_report && stream->server_report == NULL)
+                {
+                    iperf_udp_client_send_packet(stream, session->args.packet_size, true);
+                }
+            }
+            iperf_udp_client_wait_for_reports(session);
         }
     }
 
-    uint32_t final_duration_ms = 0;
-    if (session->report != NULL)
+    uint32_t elapsed_ms = mmosal_get_time_ms() - session->base.time_started_ms;
+    for (ii = 0; ii < session->args.num_streams; ii++)
     {
-        iperf_udp_client_report(session, &final_duration_ms);
-        pbuf_free(session->report);
-        session->report = NULL;
-    }
-    else
-    {
-        final_duration_ms = mmosal_get_time_ms() - session->base.time_started_ms;
-        if (!ip_addr_ismulticast(&(session->server_addr)))
+        struct iperf_udp_client_stream *stream = &session->streams[ii];
+        if (stream->server_report != NULL)
+        {
+            iperf_udp_client_report(stream);
+            pbuf_free(stream->server_report);
+            stream->server_report = NULL;
+        }
+        else
         {
-            /* If we receive no response from the server in unicast mode then set
-             * bytes_transferred to zero so it is obvious in the report. */
-            session->base.report.bytes_transferred = 0;
+            stream->report.duration_ms = elapsed_ms;
+            if (!ip_addr_ismulticast(&(session->server_addr)))
+            {
+                /* If we receive no response from the server in unicast mode then set
+                 * bytes_transferred to zero so it is obvious in the report. */
+                stream->report.bytes_transferred = 0;
+            }
         }
     }
+    uint32_t final_duration_ms = iperf_udp_client_aggregate_reports(session);
 
     /* Clean up state and free allocated memory. */
     LOCK_TCPIP_CORE();
-    udp_remove(session->pcb);
+    for (ii = 0; ii < session->args.num_streams; ii++)
+    {
+        udp_remove(session->streams[ii].pcb);
+        session->streams[ii].pcb = NULL;
+    }
     UNLOCK_TCPIP_CORE();
     mmosal_semb_delete(session->report_semb);
     session->report_semb = NULL;
-    session->pcb = NULL;
     iperf_list_remove(&(session->base));
-    iperf_finalize_report_and_invoke_callback(&session->base,
-                                              final_duration_ms,
-                                              session->stop_requested ? MMIPERF_STOPPED :
-                                                                        MMIPERF_UDP_DONE_CLIENT);
+
+    enum mmiperf_report_type report_type =
+        session->stop_requested ? MMIPERF_STOPPED : MMIPERF_UDP_DONE_CLIENT;
+    /* For multi-stream tests each stream is reported individually before the aggregate. */
+    if (session->args.num_streams > 1 && session->base.report_fn != NULL)
+    {
+        for (ii = 0; ii < session->args.num_streams; ii++)
+        {
+            struct mmiperf_report *report = &session->streams[ii].report;
+            report->report_type = report_type;
+            iperf_report_set_duration(report, report->duration_ms);
+            if (session->args.rtt_echo)
+            {
+                iperf_histogram_summarise(&session->rtt_hists[ii], 1, &report->rtt);
+            }
+            session->base.report_fn(report, session->base.report_arg, &session->base);
+        }
+    }
+    iperf_finalize_report_and_invoke_callback(&session->base, final_duration_ms, report_type);
     IPERF_FREE(struct iperf_client_state_udp, session);
 }
 
+/**
+ * Handle a packet header echoed back by the server, recording the round trip time.
+ *
+ * @param stream The stream that the echo was received on.
+ * @param p      The received packet.
+ *
+ * @returns @c true if the packet was an echo, or @c false if it was not (e.g., it was the
+ *          server report).
+ */
+static bool iperf_udp_client_handle_echo(struct iperf_udp_client_stream *stream, struct pbuf *p)
+{
+    struct iperf_client_state_udp *session = stream->session;
+    struct iperf_udp_header hdr;
+
+    /* Echoes consist of just the header, whereas the server report is appended to a header. */
+    if (p->tot_len != sizeof(hdr) || pbuf_copy_partial(p, &hdr, sizeof(hdr), 0) != sizeof(hdr))
+    {
+        return false;
+    }
+
+    uint64_t tx_time_us = (uint64_t)ntohl(hdr.tv_sec) * 1000000 + ntohl(hdr.tv_usec);
+    uint64_t rtt_us = mmiperf_get_time_us() - tx_time_us;
+    iperf_histogram_add(&session->rtt_hists[stream - session->streams],
+                        (uint32_t)min(rtt_us, UINT32_MAX));
+    return true;
+}
+
 static void iperf_udp_client_recv(void *arg,
                                   struct udp_pcb *pcb,
                                   struct pbuf *p,
@@ -312,7 +659,8 @@ static void iperf_udp_client_recv(void *arg,
 {
     (void)pcb;
 
-    struct iperf_client_state_udp *session = (struct iperf_client_state_udp *)arg;
+    struct iperf_udp_client_stream *stream = (struct iperf_udp_client_stream *)arg;
+    struct iperf_client_state_udp *session = stream->session;
 
     if (!ip_addr_cmp_zoneless(addr, &(session->server_addr)))
     {
@@ -327,19 +675,24 @@ static void iperf_udp_client_recv(void *arg,
         goto cleanup;
     }
 
-    if (!session->awaiting_report)
+    if (session->args.rtt_echo && iperf_udp_client_handle_echo(stream, p))
+    {
+        goto cleanup;
+    }
+
+    if (!stream->awaiting_report)
     {
         LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL, ("UDP client rx unexpected\n"));
         goto cleanup;
     }
 
-    if (session->report != NULL)
+    if (stream->server_report != NULL)
     {
         /* Report already received; we can drop this one. */
         goto cleanup;
     }
 
-    session->report = p;
+    stream->server_report = p;
     p = NULL;
 
     mmosal_semb_give(session->report_semb);
@@ -369,12 +722,11 @@ mmiperf_handle_t mmiperf_start_udp_client(const struct mmiperf_client_args *args
 {
     LOCK_TCPIP_CORE();
 
-    struct udp_pcb *pcb;
     struct iperf_client_state_udp *s;
     mmiperf_handle_t result = NULL;
     int ok;
     uint32_t pkt_size = 0;
-    err_t err = ERR_VAL;
+    unsigned ii;
 
     LWIP_ASSERT_CORE_LOCKED();
 
@@ -419,64 +771,105 @@ mmiperf_handle_t mmiperf_start_udp_client(const struct mmiperf_client_args *args
         s->args.amount = MMIPERF_DEFAULT_AMOUNT;
     }
 
+    if (s->args.num_streams == 0)
+    {
+        s->args.num_streams = 1;
+    }
+
+    if (s->args.num_streams > MMIPERF_MAX_STREAMS)
+    {
+        LWIP_DEBUGF(LWIP_DBG_LEVEL_SERIOUS, ("too many streams.\n"));
+        goto exit;
+    }
+
+    if (s->args.traffic_shape == MMIPERF_TRAFFIC_ON_OFF && s->args.on_time_ms == 0)
+    {
+        LWIP_DEBUGF(LWIP_DBG_LEVEL_SERIOUS, ("on time must be non-zero.\n"));
+        goto exit;
+    }
+
     LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL,
-                ("Starting UDP iperf client to %s:%u, amount %ld\n",
+                ("Starting UDP iperf client to %s:%u, amount %ld, %u stream(s)\n",
                  s->args.server_addr,
                  s->args.server_port,
-                 args->amount));
+                 args->amount,
+                 s->args.num_streams));
 
     /* target_bw (kbps) convert to block_tx_amount (bytes) = bw * (BLOCK_DURATION_MS / 8) */
     s->block_tx_amount = s->args.target_bw * BLOCK_DURATION_MS / 8;
+    /* target_bw (kbps) convert to tx_interval_us = packet_size * 8 / (bw * 1000) seconds */
+    if (s->args.target_bw != 0)
+    {
+        s->tx_interval_us = (uint64_t)s->args.packet_size * 8000 / s->args.target_bw;
+    }
     /* check packet size. If the target_bw is too low, error message is printed. */
     pkt_size = s->args.target_bw * 1000 / 8;
-    if (s->args.target_bw != 0 && s->args.packet_size > pkt_size)
+    if (s->args.traffic_shape == MMIPERF_TRAFFIC_BLOCK && s->args.target_bw != 0 &&
+        s->args.packet_size > pkt_size)
     {
         LWIP_DEBUGF(LWIP_DBG_LEVEL_SERIOUS, ("bandwidth limit too low.\n"));
-        s->pcb = NULL;
         goto exit;
     }
 
-    /* We use a counter across a range of local ports so we don't use the same port for subsequent
-     * iterations. */
-    static atomic_uint session_counter = 0;
-    (void)atomic_fetch_add(&session_counter, 1);
-    s->local_port = IPERF_UDP_CLIENT_LOCAL_PORT_RANGE_BASE +
-                    (session_counter & (IPERF_UDP_CLIENT_LOCAL_PORT_RANGE_SIZE - 1));
     s->report_semb = mmosal_semb_create("iperf_udp");
 
     s->base.report.report_type = MMIPERF_INTERRIM_REPORT;
+    s->base.report.num_streams = s->args.num_streams;
+    s->base.report.stream_index = (s->args.num_streams > 1) ? MMIPERF_STREAM_AGGREGATE : 0;
+    s->base.report.dscp = s->args.dscp[0];
     s->base.time_started_ms = mmosal_get_time_ms();
     s->base.report_fn = args->report_fn;
     s->base.report_arg = args->report_arg;
-
-    /* Create PCB to receive response from server */
-    pcb = udp_new_ip_type(IPADDR_TYPE_ANY);
-    if (pcb == NULL)
+    if (s->args.rtt_echo)
     {
-        goto exit;
+        s->base.rtt_hists = s->rtt_hists;
+        s->base.num_rtt_hists = s->args.num_streams;
     }
 
-#if LWIP_IPV4
-    if (IP_IS_V4(&(s->server_addr)))
+    for (ii = 0; ii < s->args.num_streams; ii++)
     {
-        err = udp_bind(pcb, IP4_ADDR_ANY, s->local_port);
-    }
+        struct iperf_udp_client_stream *stream = &s->streams[ii];
+        err_t err = ERR_VAL;
+
+        /* We use a counter across a range of local ports so we don't use the same port for
+         * subsequent iterations or for parallel streams. */
+        static atomic_uint session_counter = 0;
+        unsigned port_index = atomic_fetch_add(&session_counter, 1) + 1;
+        uint16_t local_port = IPERF_UDP_CLIENT_LOCAL_PORT_RANGE_BASE +
+                              (port_index & (IPERF_UDP_CLIENT_LOCAL_PORT_RANGE_SIZE - 1));
+
+        stream->session = s;
+
+        /* Create PCB to receive response from server */
+        stream->pcb = udp_new_ip_type(IPADDR_TYPE_ANY);
+        if (stream->pcb == NULL)
+        {
+            goto exit;
+        }
+
+        /* The DSCP occupies the upper six bits of the TOS field. */
+        stream->pcb->tos = (uint8_t)(s->args.dscp[ii] << 2);
+
+#if LWIP_IPV4
+        if (IP_IS_V4(&(s->server_addr)))
+        {
+            err = udp_bind(stream->pcb, IP4_ADDR_ANY, local_port);
+        }
 #endif
 #if LWIP_IPV6
-    if (IP_IS_V6(&(s->server_addr)))
-    {
-        err = udp_bind(pcb, IP6_ADDR_ANY, s->local_port);
-    }
+        if (IP_IS_V6(&(s->server_addr)))
+        {
+            err = udp_bind(stream->pcb, IP6_ADDR_ANY, local_port);
+        }
 #endif
 
-    if (err != ERR_OK)
-    {
-        goto exit;
-    }
-
-    udp_recv(pcb, iperf_udp_client_recv, s);
+        if (err != ERR_OK)
+        {
+            goto exit;
+        }
 
-    s->pcb = pcb;
+        udp_recv(stream->pcb, iperf_udp_client_recv, stream);
+    }
 
     iperf_list_add(&s->base);
 
@@ -492,6 +885,17 @@ mmiperf_handle_t mmiperf_start_udp_client(const struct mmiperf_client_args *args
 exit:
     if (s != NULL)
     {
+        for (ii = 0; ii < MMIPERF_MAX_STREAMS; ii++)
+        {
+            if (s->streams[ii].pcb != NULL)
+            {
+                udp_remove(s->streams[ii].pcb);
+            }
+        }
+        if (s->report_semb != NULL)
+        {
+            mmosal_semb_delete(s->report_semb);
+        }
         IPERF_FREE(struct iperf_client_state_udp, s);
     }
     UNLOCK_TCPIP_CORE();
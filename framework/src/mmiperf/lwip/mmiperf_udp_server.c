@@ -30,6 +30,15 @@ struct iperf_server_session_udp
     ip_addr_t client_addr;
     uint16_t client_port;
     struct timeval ipg_start;
+
+    /** Transit time (receive time minus transmit timestamp) of the previous packet. */
+    int64_t last_transit_us;
+    /** RFC 3550 jitter estimate, scaled by 16 to preserve precision. */
+    uint32_t jitter_x16;
+    /** Histogram of the difference in transit time between consecutive packets. */
+    struct iperf_histogram delay_variation_hist;
+    /** Histogram of one-way latency. */
+    struct iperf_histogram one_way_latency_hist;
 };
 
 /** Connection handle for a UDP iperf server */
@@ -42,11 +51,16 @@ struct iperf_server_state_udp
         ip_addr_t local_addr;
         uint16_t local_port;
         enum iperf_version version;
+        bool echo;
     } args;
     struct udp_pcb *pcb;
     struct iperf_server_session_udp session;
 };
 
+#ifndef min
+#define min(a, b) ((b) < (a) ? (b) : (a))
+#endif
+
 /* ip_addr_cmp_zoneless may not be defined if IPv6 is not enabled. In that case we don't have
  * zones so a normal compare is sufficient. */
 #ifndef ip_addr_cmp_zoneless
@@ -123,6 +137,61 @@ static int32_t time_delta(const struct timeval *a, const struct timeval *b)
     return delta;
 }
 
+/**
+ * Update the latency and jitter statistics for a received packet.
+ *
+ * @param server_state The iperf server state.
+ * @param session      The session that the packet was received on.
+ * @param packet_time  Transmit timestamp from the packet header.
+ * @param rx_time_us   Time at which the packet was received.
+ */
+static void iperf_udp_server_update_latency(struct iperf_server_state_udp *server_state,
+                                            struct iperf_server_session_udp *session,
+                                            const struct timeval *packet_time,
+                                            uint64_t rx_time_us)
+{
+    uint64_t tx_time_us = (uint64_t)packet_time->tv_sec * 1000000 + packet_time->tv_usec;
+    int64_t transit_us = (int64_t)(rx_time_us - tx_time_us);
+
+    iperf_histogram_add(&session->one_way_latency_hist,
+                        transit_us > 0 ? (uint32_t)min(transit_us, UINT32_MAX) : 0);
+
+    /* The first packet has nothing to compare against. */
+    if (session->one_way_latency_hist.count > 1)
+    {
+        int64_t delta_us = transit_us - session->last_transit_us;
+        uint32_t abs_delta_us = (uint32_t)min(delta_us < 0 ? -delta_us : delta_us, UINT32_MAX);
+        iperf_histogram_add(&session->delay_variation_hist, abs_delta_us);
+
+        /* J = J + (|D| - J) / 16, from RFC 3550 section 6.4.1. */
+        session->jitter_x16 += abs_delta_us - ((session->jitter_x16 + 8) >> 4);
+        server_state->base.report.jitter_us = session->jitter_x16 >> 4;
+    }
+    session->last_transit_us = transit_us;
+}
+
+/* Echo the header of a received packet back to the client so it can measure round trip time. */
+static void iperf_udp_server_echo(struct udp_pcb *pcb,
+                                  const ip_addr_t *addr,
+                                  uint16_t port,
+                                  const struct iperf_udp_header *hdr)
+{
+    struct pbuf *echo_pbuf = pbuf_alloc(PBUF_TRANSPORT, sizeof(*hdr), PBUF_RAM);
+    if (echo_pbuf == NULL)
+    {
+        LWIP_DEBUGF(LWIP_DBG_LEVEL_WARNING, ("Pbuf alloc failure.\n"));
+        return;
+    }
+
+    memcpy(echo_pbuf->payload, hdr, sizeof(*hdr));
+    err_t err = udp_sendto(pcb, echo_pbuf, addr, port);
+    if (err != ERR_OK)
+    {
+        LWIP_DEBUGF(LWIP_DBG_LEVEL_WARNING, ("Failed to send Iperf echo.\n"));
+    }
+    pbuf_free(echo_pbuf);
+}
+
 /* Construct and send server report after final packet if not a multicast address. */
 static void iperf_udp_server_handle_final_packet(struct iperf_server_state_udp *server_state,
                                                  struct udp_pcb *pcb,
@@ -183,6 +252,7 @@ static void iperf_udp_server_recv(void *arg,
                                   uint16_t port)
 {
     struct iperf_server_state_udp *server_state = (struct iperf_server_state_udp *)arg;
+    uint64_t rx_time_us = mmiperf_get_time_us();
 
     LWIP_ASSERT("NULL packet", p != NULL);
 
@@ -244,6 +314,7 @@ static void iperf_udp_server_recv(void *arg,
         server_state->base.report.ipg_count++;
         server_state->base.report.ipg_sum_ms += time_delta(&packet_time, &(session->ipg_start));
         session->ipg_start = packet_time;
+        iperf_udp_server_update_latency(server_state, session, &packet_time, rx_time_us);
 
         if (packet_id < session->next_packet_id)
         {
@@ -260,6 +331,12 @@ static void iperf_udp_server_recv(void *arg,
         }
     }
 
+    if (server_state->args.echo && !final_packet &&
+        !ip_addr_ismulticast(&(server_state->args.local_addr)))
+    {
+        iperf_udp_server_echo(pcb, addr, port, &hdr);
+    }
+
     if (final_packet)
     {
         /* Handle the local report if this is the first time receiving the final packet. */
@@ -366,6 +443,9 @@ mmiperf_handle_t mmiperf_start_udp_server(const struct mmiperf_server_args *args
     s->base.report_arg = args->report_arg;
     s->args.local_port = args->local_port;
     s->args.version = args->version;
+    s->args.echo = args->echo;
+    s->base.delay_variation_hist = &s->session.delay_variation_hist;
+    s->base.one_way_latency_hist = &s->session.one_way_latency_hist;
     /* Set next_packet_id to -1 to show that there is no session active. We will start a new
      * session with the first packet we receive from a client. */
     s->session.next_packet_id = -1;
@@ -45,6 +45,12 @@ extern "C"
 /** Maximum length of an IP address string including null-terminator. */
 #define MMIPERF_IPADDR_MAXLEN (48)
 
+/** Maximum number of parallel streams supported by a single UDP client session. */
+#define MMIPERF_MAX_STREAMS (4)
+
+/** Value of @ref mmiperf_report.stream_index for a report aggregated across all streams. */
+#define MMIPERF_STREAM_AGGREGATE (0xff)
+
 #ifndef MMIPERF_STACK_SIZE
 /** Default stack to use for MMIPERF tasks. */
 #define MMIPERF_STACK_SIZE 512
@@ -95,6 +101,54 @@ enum iperf_version
     IPERF_VERSION_2_0_9,
 };
 
+/** Enumeration of traffic shapes used to pace UDP client transmission. */
+enum mmiperf_traffic_shape
+{
+    /**
+     * Send up to the bandwidth limit worth of data at the start of each @ref BLOCK_DURATION_MS
+     * block, then wait for the next block.
+     */
+    MMIPERF_TRAFFIC_BLOCK,
+    /** Constant bit rate: packets are evenly spaced to meet the bandwidth limit. */
+    MMIPERF_TRAFFIC_CBR,
+    /**
+     * Poisson arrivals: inter-packet gaps are exponentially distributed with a mean that meets
+     * the bandwidth limit.
+     */
+    MMIPERF_TRAFFIC_POISSON,
+    /**
+     * Alternate between constant bit rate transmission for @c on_time_ms and silence for
+     * @c off_time_ms.
+     */
+    MMIPERF_TRAFFIC_ON_OFF,
+};
+
+/**
+ * Summary of a latency distribution. All values are in microseconds.
+ *
+ * Percentiles are derived from a log-linear histogram and are reported as the upper bound of
+ * the histogram bucket that they fall in, so are accurate to within 12.5%.
+ */
+struct mmiperf_latency_stats
+{
+    /** Number of samples. If zero then the remaining fields are invalid. */
+    uint32_t count;
+    /** Smallest sample. */
+    uint32_t min_us;
+    /** Mean of all samples. */
+    uint32_t mean_us;
+    /** 50th percentile (median). */
+    uint32_t p50_us;
+    /** 90th percentile. */
+    uint32_t p90_us;
+    /** 99th percentile. */
+    uint32_t p99_us;
+    /** 99.9th percentile. */
+    uint32_t p999_us;
+    /** Largest sample. */
+    uint32_t max_us;
+};
+
 /** Iperf client/server handle. */
 typedef struct mmiperf_state *mmiperf_handle_t;
 
@@ -134,6 +188,30 @@ struct mmiperf_report
      *       packet start times.
      */
     uint32_t ipg_sum_ms;
+    /**
+     * Index of the stream that this report relates to, or @ref MMIPERF_STREAM_AGGREGATE if
+     * this report covers all streams of a multi-stream test (UDP client only).
+     */
+    uint8_t stream_index;
+    /** Number of streams in the test (UDP client only). */
+    uint8_t num_streams;
+    /** DSCP value that was used for the stream (UDP client only). */
+    uint8_t dscp;
+    /** Smoothed inter-arrival jitter as defined by RFC 3550, in microseconds (UDP only). */
+    uint32_t jitter_us;
+    /** Distribution of the difference in transit time between consecutive packets (UDP server
+     *  only). */
+    struct mmiperf_latency_stats delay_variation;
+    /**
+     * Distribution of one-way latency (UDP server only).
+     *
+     * @note This is derived from the client transmit timestamp and the local receive time, so
+     *       is only meaningful if the client and server clocks are synchronized. Samples where
+     *       the receive time precedes the transmit time are recorded as zero.
+     */
+    struct mmiperf_latency_stats one_way_latency;
+    /** Distribution of round trip time (UDP client with @c rtt_echo enabled only). */
+    struct mmiperf_latency_stats rtt;
 };
 
 /**
@@ -178,13 +256,31 @@ struct mmiperf_client_args
     void *report_arg;
     /** Iperf version used to parse packet header. */
     enum iperf_version version;
+    /** Traffic shape used to pace transmission. Only applies to UDP iperf tests. Shapes other
+     *  than @ref MMIPERF_TRAFFIC_ON_OFF require @c target_bw to be non-zero to have any
+     *  effect. */
+    enum mmiperf_traffic_shape traffic_shape;
+    /** Duration of each on period in milliseconds (@ref MMIPERF_TRAFFIC_ON_OFF only). */
+    uint32_t on_time_ms;
+    /** Duration of each off period in milliseconds (@ref MMIPERF_TRAFFIC_ON_OFF only). */
+    uint32_t off_time_ms;
+    /** Number of parallel streams, up to @ref MMIPERF_MAX_STREAMS. Only applies to UDP iperf
+     *  tests. Each stream uses its own local port and is reported separately by the server.
+     *  @c target_bw and @c amount apply to each stream individually. Zero is treated as one. */
+    uint8_t num_streams;
+    /** DSCP value to mark the packets of each stream with. Only applies to UDP iperf tests.
+     *  The network interface derives the 802.11 TID from the DSCP value. */
+    uint8_t dscp[MMIPERF_MAX_STREAMS];
+    /** Measure round trip time using the header of each packet echoed by the server. Only
+     *  applies to UDP iperf tests, and requires the server to have @c echo enabled. */
+    bool rtt_echo;
 };
 
 /** Initializer for @ref mmiperf_client_args. */
 #define MMIPERF_CLIENT_ARGS_DEFAULT                                                              \
     {                                                                                            \
         { 0 }, MMIPERF_DEFAULT_PORT, MMIPERF_DEFAULT_BANDWIDTH, 0, MMIPERF_DEFAULT_AMOUNT, NULL, \
-        NULL,  IPERF_VERSION_2_0_13,                                                             \
+        NULL,  IPERF_VERSION_2_0_13, MMIPERF_TRAFFIC_BLOCK, 0, 0, 1, { 0 }, false,               \
     }
 
 /**
@@ -209,12 +305,15 @@ struct mmiperf_server_args
     void *report_arg;
     /** Iperf version used to parse packet header. */
     enum iperf_version version;
+    /** Echo the header of each received packet back to the client so that it can measure
+     *  round trip time. Only applies to UDP iperf tests. */
+    bool echo;
 };
 
 /** Initializer for @ref mmiperf_server_args. */
-#define MMIPERF_SERVER_ARGS_DEFAULT                                    \
-    {                                                                  \
-        { 0 }, MMIPERF_DEFAULT_PORT, NULL, NULL, IPERF_VERSION_2_0_13, \
+#define MMIPERF_SERVER_ARGS_DEFAULT                                           \
+    {                                                                         \
+        { 0 }, MMIPERF_DEFAULT_PORT, NULL, NULL, IPERF_VERSION_2_0_13, false, \
     }
 
 /**
@@ -282,6 +381,16 @@ bool mmiperf_get_interim_report(mmiperf_handle_t handle, struct mmiperf_report *
  */
 bool mmiperf_stop(mmiperf_handle_t handle);
 
+/**
+ * Get the current time in microseconds, used for pacing iperf transmission.
+ *
+ * The default implementation is derived from the OS tick. It is declared weak so that a
+ * platform may override it with an implementation based on a higher resolution hardware timer.
+ *
+ * @returns the current time in microseconds.
+ */
+uint64_t mmiperf_get_time_us(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -28,6 +28,16 @@
  * The ping retry timeout is calculated as the 2 times average RTT if one or more ping responses
  * have been received, otherwise it will be @c MMPING_INITIAL_RETRY_INTERVAL_MS.
  *
+ * By default only one request is outstanding at a time. Setting @c max_in_flight allows up to
+ * @ref MMPING_MAX_IN_FLIGHT requests to be outstanding at once, with a new request sent at each
+ * interval regardless of whether earlier requests have been answered. If the interval is zero
+ * then a new request is sent as soon as the number of outstanding requests drops below
+ * @c max_in_flight (flood mode), which is useful for benchmarking datapath latency.
+ *
+ * Up to @ref MMPING_MAX_SESSIONS sessions may run concurrently, for example to ping several
+ * targets at once. @ref mmping_stats() aggregates the statistics of all sessions, while
+ * @ref mmping_session_stats() returns the statistics of a single session.
+ *
  * @{
  */
 
@@ -58,6 +68,11 @@ extern "C"
 /** Rate at which to retry unacknowledged ping requests when the RTT is not known.`` */
 #define MMPING_INITIAL_RETRY_INTERVAL_MS (1000)
 
+/** Maximum number of ping requests that a session may have outstanding at once. */
+#define MMPING_MAX_IN_FLIGHT (32)
+/** Maximum number of ping sessions that may run concurrently. */
+#define MMPING_MAX_SESSIONS (4)
+
 /** Maximum length of an IP address string including null-terminator. */
 #define MMPING_IPADDR_MAXLEN (48)
 
@@ -90,6 +105,11 @@ struct mmping_args
     uint32_t ping_count;
     /** Specifies the data packet size in bytes excluding 8 bytes ICMP header */
     uint32_t ping_size;
+    /**
+     * Maximum number of ping requests to have outstanding at once. Must not exceed
+     * @ref MMPING_MAX_IN_FLIGHT. Zero is treated as one.
+     */
+    uint16_t max_in_flight;
 };
 
 /** Initializer for @ref mmping_args. */
@@ -100,6 +120,7 @@ struct mmping_args
         MMPING_DEFAULT_PING_INTERVAL_MS, \
         MMPING_DEFAULT_PING_COUNT,       \
         MMPING_DEFAULT_DATA_SIZE,        \
+        1,                               \
     }
 
 /**
@@ -107,7 +128,8 @@ struct mmping_args
  */
 struct mmping_stats
 {
-    /** String representation of the IP address of the ping receiver */
+    /** String representation of the IP address of the ping receiver. This will be empty if the
+     *  statistics are aggregated across sessions with different receivers. */
     char ping_receiver[MMPING_IPADDR_MAXLEN];
     /** Total number of requests sent */
     uint32_t ping_total_count;
@@ -121,6 +143,14 @@ struct mmping_stats
     uint32_t ping_max_time_ms;
     /** Stores the ping running status */
     bool ping_is_running;
+    /** The 50th percentile (median) latency in ms, accurate to within 12.5% */
+    uint32_t ping_p50_time_ms;
+    /** The 90th percentile latency in ms, accurate to within 12.5% */
+    uint32_t ping_p90_time_ms;
+    /** The 99th percentile latency in ms, accurate to within 12.5% */
+    uint32_t ping_p99_time_ms;
+    /** The number of sessions that these statistics were gathered from */
+    uint32_t ping_session_count;
 };
 
 /**
@@ -133,19 +163,38 @@ struct mmping_stats
 uint16_t mmping_start(const struct mmping_args *args);
 
 /**
- * Stop any running ping request.
+ * Stop all running ping sessions.
  */
 void mmping_stop(void);
 
 /**
- * Get Ping Statistics.
+ * Stop a single running ping session.
+ *
+ * @param session_id The ID of the session, as returned by @ref mmping_start().
+ */
+void mmping_stop_session(uint16_t session_id);
+
+/**
+ * Get Ping Statistics, aggregated across all sessions.
  *
  * @param stats Instance to receive ping statistics
  *
- * @note Calling @c mmping_start() will reset the ping statistics
+ * @note Calling @c mmping_start() when no other session is running will reset the ping
+ *       statistics of all sessions.
  */
 void mmping_stats(struct mmping_stats *stats);
 
+/**
+ * Get Ping Statistics for a single session.
+ *
+ * @param session_id The ID of the session, as returned by @ref mmping_start().
+ * @param stats      Instance to receive ping statistics
+ *
+ * @returns @c true on success, or @c false if the session was not found (e.g., because its
+ *          statistics have since been reset).
+ */
+bool mmping_session_stats(uint16_t session_id, struct mmping_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
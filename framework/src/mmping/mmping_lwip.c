@@ -14,6 +14,7 @@
 #include "lwip/prot/ip4.h"
 #include "lwip/prot/icmp6.h"
 #include "lwip/inet.h"
+#include "mmhist.h"
 #include "mmping.h"
 #include "mmosal.h"
 #include "mmutils.h"
@@ -33,25 +34,38 @@
 /** Magic number we put in the packet to make sure that the payload gets echoed. */
 #define PING_MAGIC_NUMBER (0xabcd0123lu)
 
-/** Number of bits in our duplicate check bitmap. */
-#define N_DUP_CHECK_BITS (128)
-
 /** Time to wait on failing to send a ping request. */
 #define PING_ERROR_RETRY_INTERVAL_MS (1000)
 
+/** Minimum time to wait for a response before retransmitting a ping request. */
+#define PING_MIN_RETRY_INTERVAL_MS (10)
+
+/** Maximum time that the ping task will sleep for between checks of session state. */
+#define PING_MAX_SLEEP_MS (1000)
+
 /** Network layer Pbuf IPv4 header length. */
 #define PBUF_IP_HLEN_V4 (20)
 /** Network layer Pbuf IPv6 header length. */
 #define PBUF_IP_HLEN_V6 (40)
 
-enum ping_state
+/** Number of linear sub-buckets per power of two in the RTT histogram, as a power of 2. */
+#define RTT_HIST_SUB_BUCKET_BITS (3)
+/** RTTs are clamped to be less than 2^RTT_HIST_MAX_VALUE_BITS milliseconds. */
+#define RTT_HIST_MAX_VALUE_BITS (16)
+/** Number of buckets in the RTT histogram. */
+#define RTT_HIST_NUM_BUCKETS MMHIST_NUM_BUCKETS(RTT_HIST_SUB_BUCKET_BITS, RTT_HIST_MAX_VALUE_BITS)
+
+/** A ping request that has been sent and is awaiting a response. */
+struct ping_request
 {
-    /** Ping is not currently running (may have stats left over from last run). */
-    PING_IDLE,
-    /** Last sent request has been acknowledged. Waiting for timeout to send next. */
-    PING_AWAITING_SND,
-    /** Last sent request has not yet been acknowledged. */
-    PING_AWAITING_RSP,
+    /** Sequence number of the request. */
+    uint16_t seq_num;
+    /** Number of retries of this request. */
+    uint16_t num_retries;
+    /** Time at which the request should be retransmitted or given up on. */
+    uint32_t timeout_time_ms;
+    /** Whether this request is still awaiting a response. */
+    bool outstanding;
 };
 
 struct ping_session
@@ -73,125 +87,90 @@ struct ping_session
         uint32_t ping_count;
         /** Specifies the data packet size in bytes excluding 8 bytes ICMP header */
         uint32_t ping_size;
+        /** Maximum number of ping requests to have outstanding at once. */
+        uint16_t max_in_flight;
     } args;
 
     /** This is where we record ping statistics. */
     volatile struct mmping_stats stats;
-    /** Last received sequence number (excluding out-of-order packets). A negative number indicates
-     *  no packets received yet. */
-    volatile int32_t last_rx_seq_num;
-    /** Bitmap used to check for duplicates. */
-    volatile uint32_t dup_check_bitmap[N_DUP_CHECK_BITS / sizeof(uint32_t)];
     /** Sum of all RTTs for this session. */
     volatile uint32_t rtt_sum_ms;
-    /** Absolute time for the next timeout event for this session. */
-    volatile uint32_t timeout_time_ms;
+    /** Log-linear histogram of RTTs. Since a session sends at most @ref MMPING_MAX_COUNT
+     *  requests the counts cannot overflow. */
+    volatile uint16_t rtt_hist[RTT_HIST_NUM_BUCKETS];
+    /** Requests awaiting a response, indexed by sequence number modulo
+     *  @ref MMPING_MAX_IN_FLIGHT. A response that does not match an outstanding request is a
+     *  duplicate or arrived after we gave up on the request, and is ignored. */
+    struct ping_request requests[MMPING_MAX_IN_FLIGHT];
+    /** Number of entries in @c requests that are outstanding. */
+    volatile uint16_t num_in_flight;
     /** The time at which to send the next ping request with a new sequence number (i.e.,
-     *  not including retries for the current sequence number). */
+     *  not including retries). */
     volatile uint32_t next_seq_time_ms;
-    /** ID of this session. This will be included in ping packets. */
+    /** ID of this session. This will be included in ping packets. Zero if the slot is unused. */
     volatile uint16_t session_id;
-    /** Number of retries of current request. */
-    volatile uint16_t num_retries;
-    /** Current ping state. */
-    volatile enum ping_state state;
+    /** Whether the session is running. */
+    volatile bool running;
     /** Handle of the running ping task, or NULL if it is not running. */
     struct mmosal_task *task_handle;
     /** Semaphore to notify ping task of state changes. */
     struct mmosal_semb *semb;
 };
 
-/** The current ping session. At present we only support a single session, but in future this
- *  may be an array of sessions. */
-static struct ping_session ping_session;
+/** The ping sessions. */
+static struct ping_session ping_sessions[MMPING_MAX_SESSIONS];
 /** The next session ID to use. */
 static uint16_t ping_next_session_id;
 
 /**
- * Set the given bit in the duplicate checking bitmap for the given ping session.
- *
- * @warning This function does not perfom bounds checking. @p bit_num must be less than
- *          @ref N_DUP_CHECK_BITS.
- *
- * @param session The ping session data structure.
- * @param bit_num The offset of the bit to set. Must be less than @ref N_DUP_CHECK_BITS.
- */
-static void dup_check_bitmap_set(volatile struct ping_session *session, uint16_t bit_num)
-{
-    size_t word_num = bit_num / sizeof(uint32_t);
-    uint32_t mask = (1ul << bit_num % sizeof(uint32_t));
-
-    session->dup_check_bitmap[word_num] |= mask;
-}
-
-/**
- * Clear the given bit in the duplicate checking bitmap for the given ping session.
+ * Find the given RTT percentile across the sessions that match the given session ID.
  *
- * @warning This function does not perfom bounds checking. @p bit_num must be less than
- *          @ref N_DUP_CHECK_BITS.
+ * @param session_id  Session to include, or zero to include all sessions.
+ * @param count       Total number of RTT samples in the included sessions.
+ * @param per_mille   The percentile to find, in units of 0.1%.
  *
- * @param session The ping session data structure.
- * @param bit_num The offset of the bit to clear. Must be less than @ref N_DUP_CHECK_BITS.
- */
-static void dup_check_bitmap_clear(volatile struct ping_session *session, uint16_t bit_num)
-{
-    size_t word_num = bit_num / sizeof(uint32_t);
-    uint32_t mask = (1ul << bit_num % sizeof(uint32_t));
-
-    session->dup_check_bitmap[word_num] &= ~mask;
-}
-
-/**
- * Check whether the given bit is set in the duplicate checking bitmap for the given ping session.
- *
- * @warning This function does not perfom bounds checking. @p bit_num must be less than
- *          @ref N_DUP_CHECK_BITS.
- *
- * @param session The ping session data structure.
- * @param bit_num The offset of the bit to check. Must be less than @ref N_DUP_CHECK_BITS.
- *
- * @returns @c true if the bit is set, else @c false.
- */
-static bool dup_check_bitmap_is_set(volatile struct ping_session *session, uint16_t bit_num)
-{
-    size_t word_num = bit_num / sizeof(uint32_t);
-    uint32_t mask = (1ul << bit_num % sizeof(uint32_t));
-
-    return (session->dup_check_bitmap[word_num] & mask) != 0;
-}
-
-/**
- * Update session state on acknowledgement of the most recently sent ping request.
+ * @returns the upper bound of the histogram bucket that contains the percentile.
  */
-static void process_ping_acknowledgement(struct ping_session *session)
+static uint32_t rtt_hist_percentile(uint16_t session_id, uint32_t count, uint32_t per_mille)
 {
-    /* If we are in the AWAITNG_RSP state, then check if all outstanding ping requests have now
-     * been acknowledged, and if so transition into the IDLE state; otherwise update timeout and
-     * return to the AWAITING_SND state in preparation to send the next request. */
+    uint32_t rank = mmhist_percentile_rank(count, per_mille);
+    uint32_t cumulative = 0;
+    unsigned ii;
 
-    if (session->state == PING_AWAITING_RSP)
+    for (ii = 0; ii < RTT_HIST_NUM_BUCKETS; ii++)
     {
-        if (session->last_rx_seq_num >= ((int32_t)session->args.ping_count - 1))
+        unsigned jj;
+        for (jj = 0; jj < MMPING_MAX_SESSIONS; jj++)
         {
-            LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL,
-                        ("Final ping response received, transitioning to IDLE state\n"));
-            session->state = PING_IDLE;
+            const struct ping_session *session = &ping_sessions[jj];
+            if (session->session_id != 0 &&
+                (session_id == 0 || session->session_id == session_id))
+            {
+                cumulative += session->rtt_hist[ii];
+            }
         }
-        else
+        if (cumulative >= rank)
         {
-            session->state = PING_AWAITING_SND;
-            session->timeout_time_ms = mmosal_get_time_ms() + session->args.ping_interval_ms;
+            return mmhist_bucket_upper_bound(ii, RTT_HIST_SUB_BUCKET_BITS);
         }
-
-        /* Wake up the ping task to handle the state change. */
-        mmosal_semb_give(session->semb);
     }
+
+    return mmhist_bucket_upper_bound(RTT_HIST_NUM_BUCKETS - 1, RTT_HIST_SUB_BUCKET_BITS);
+}
+
+/**
+ * Get the request slot for the given sequence number.
+ */
+static struct ping_request *ping_get_request(struct ping_session *session, uint16_t seq_num)
+{
+    return &session->requests[seq_num % MMPING_MAX_IN_FLIGHT];
 }
 
 /**
  * Performs the bulk of the handling for a ping response.
  */
-static uint8_t process_ping_response(uint16_t ping_id,
+static uint8_t process_ping_response(struct ping_session *session,
+                                     uint16_t ping_id,
                                      uint16_t seq_num,
                                      uint32_t sent_time,
                                      uint32_t magic_number,
@@ -199,31 +178,27 @@ static uint8_t process_ping_response(uint16_t ping_id,
                                      const ip_addr_t *remote_ip_addr)
 {
     LWIP_UNUSED_ARG(icmp_echo_len);
-    struct ping_session *session = &ping_session;
 
     if (ping_id != session->session_id)
     {
-        LWIP_DEBUGF(LWIP_DBG_LEVEL_WARNING,
+        /* The response may belong to another session, so let the next PCB have a look. */
+        LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL,
                     ("ID mismatch (%u vs %u)\n", ping_id, session->session_id));
         return 0;
     }
 
-    if (dup_check_bitmap_is_set(session, seq_num % N_DUP_CHECK_BITS))
+    struct ping_request *request = ping_get_request(session, seq_num);
+    if (!request->outstanding || request->seq_num != seq_num)
     {
         LWIP_DEBUGF(LWIP_DBG_LEVEL_WARNING,
-                    ("Duplicate ping response received: seq=%u\n", seq_num));
+                    ("Duplicate or late ping response received: seq=%u\n", seq_num));
         return 1;
     }
 
-    dup_check_bitmap_set(session, seq_num % N_DUP_CHECK_BITS);
-
-    if ((int32_t)seq_num < session->last_rx_seq_num)
-    {
-        LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL,
-                    ("Ping response received out-of-order (got %u, expect %ld)\n",
-                     seq_num,
-                     session->last_rx_seq_num));
-    }
+    /* This request has now been answered, so it no longer counts towards the in-flight limit. */
+    request->outstanding = false;
+    session->num_in_flight--;
+    mmosal_semb_give(session->semb);
 
     if (magic_number != PING_MAGIC_NUMBER)
     {
@@ -264,15 +239,10 @@ static uint8_t process_ping_response(uint16_t ping_id,
     }
 
     session->rtt_sum_ms += ping_rtt;
+    session->rtt_hist[mmhist_bucket_index(ping_rtt,
+                                          RTT_HIST_SUB_BUCKET_BITS,
+                                          RTT_HIST_MAX_VALUE_BITS)]++;
     session->stats.ping_recv_count++;
-    session->last_rx_seq_num = seq_num;
-
-    /* If the seq_num matches the most recently sent request then process this as acknowledgement
-     * of that request. */
-    if (seq_num == (session->stats.ping_total_count - 1))
-    {
-        process_ping_acknowledgement(session);
-    }
     return 1;
 }
 
@@ -281,7 +251,7 @@ static uint8_t process_ping_response(uint16_t ping_id,
  */
 static uint8_t ping_recv(void *arg, struct raw_pcb *pcb, struct pbuf *p, const ip_addr_t *addr)
 {
-    LWIP_UNUSED_ARG(arg);
+    struct ping_session *session = (struct ping_session *)arg;
     LWIP_UNUSED_ARG(pcb);
     LWIP_UNUSED_ARG(addr);
     LWIP_ASSERT("p != NULL", p != NULL);
@@ -344,7 +314,8 @@ static uint8_t ping_recv(void *arg, struct raw_pcb *pcb, struct pbuf *p, const i
         return 0;
     }
 
-    uint8_t ret = process_ping_response(ping_id,
+    uint8_t ret = process_ping_response(session,
+                                        ping_id,
                                         seq_num,
                                         ntohl(payload.sent_time),
                                         ntohl(payload.magic_number),
@@ -359,12 +330,12 @@ static uint8_t ping_recv(void *arg, struct raw_pcb *pcb, struct pbuf *p, const i
 }
 
 /**
- * Update the timeout time for a session after successfully sending a ping packet.
+ * Get the time to wait for a response to a request before retransmitting it.
  *
- * The timeout time is 2 times the average RTT. If no packets have been sent then
- * @c MMPING_INITIAL_RETRY_INTERVAL will be used.
+ * The timeout is 2 times the average RTT, but no less than @c PING_MIN_RETRY_INTERVAL_MS. If
+ * no responses have been received then @c MMPING_INITIAL_RETRY_INTERVAL_MS will be used.
  */
-static void ping_session_update_timeout_on_send(struct ping_session *session, bool success)
+static uint32_t ping_session_get_retry_timeout(struct ping_session *session, bool success)
 {
     uint32_t timeout_duration = PING_ERROR_RETRY_INTERVAL_MS;
     if (success)
@@ -372,13 +343,17 @@ static void ping_session_update_timeout_on_send(struct ping_session *session, bo
         if (session->stats.ping_recv_count > 0)
         {
             timeout_duration = 2 * session->rtt_sum_ms / session->stats.ping_recv_count;
+            if (timeout_duration < PING_MIN_RETRY_INTERVAL_MS)
+            {
+                timeout_duration = PING_MIN_RETRY_INTERVAL_MS;
+            }
         }
         else
         {
             timeout_duration = MMPING_INITIAL_RETRY_INTERVAL_MS;
         }
     }
-    session->timeout_time_ms = mmosal_get_time_ms() + timeout_duration;
+    return timeout_duration;
 }
 
 /**
@@ -465,11 +440,13 @@ void ping6_echo_pbuf(struct pbuf *p, struct ping_session *session, uint16_t seq_
 #endif
 
 /**
- * Generate and send an ICMP echo request. This will update the session state as appropriate.
+ * Generate and send an ICMP echo request. This will update the request state as appropriate.
  *
  * @note Must be invoked with TCPIP core locked.
  */
-static void ping_send_req(struct raw_pcb *ping_pcb, struct ping_session *session, uint16_t seq_num)
+static void ping_send_req(struct raw_pcb *ping_pcb,
+                          struct ping_session *session,
+                          struct ping_request *request)
 {
     err_t err = ERR_ABRT;
     struct pbuf *p;
@@ -487,105 +464,146 @@ static void ping_send_req(struct raw_pcb *ping_pcb, struct ping_session *session
     {
         LWIP_DEBUGF(LWIP_DBG_LEVEL_WARNING, ("Ping pbuf not contiguous\n"));
         pbuf_free(p);
+        p = NULL;
         err = ERR_MEM;
         goto finish;
     }
 #if LWIP_IPV4
     if (IP_IS_V4(&(session->args.ping_target)))
     {
-        ping_echo_pbuf(p, session, seq_num, size);
+        ping_echo_pbuf(p, session, request->seq_num, size);
     }
 #endif
 #if LWIP_IPV6
     if (IP_IS_V6(&(session->args.ping_target)))
     {
-        ping6_echo_pbuf(p, session, seq_num);
+        ping6_echo_pbuf(p, session, request->seq_num);
     }
 #endif
 
     err = raw_sendto(ping_pcb, p, (const ip_addr_t *)&(session->args.ping_target));
 
 finish:
-    /* If the ping request was sent successfully then we stash the send time and update the total
-     * count. */
     if (err == ERR_OK)
     {
         if (session->args.ping_interval_ms >= PING_DISPLAY_THRESHOLD_MS)
         {
-            LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL,
-                        ("Ping req seq=%lu\n", session->stats.ping_total_count));
+            LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL, ("Ping req seq=%u\n", request->seq_num));
         }
-
-        /* Ping request sent successfully, update timeout. */
-        ping_session_update_timeout_on_send(session, true);
     }
     else
     {
         LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL,
-                    ("Failed to send ping req %u (retry %u)\n", seq_num, session->num_retries));
-        ping_session_update_timeout_on_send(session, false);
+                    ("Failed to send ping req %u (retry %u)\n",
+                     request->seq_num,
+                     request->num_retries));
+    }
+    request->timeout_time_ms =
+        mmosal_get_time_ms() + ping_session_get_retry_timeout(session, err == ERR_OK);
+    if (p != NULL)
+    {
+        pbuf_free(p);
     }
-    pbuf_free(p);
 }
 
 /**
- * Invoked when the timeout time is reached for a given session.
+ * Retransmit or give up on any outstanding requests that have timed out.
  *
  * @note Will be called with TCP/IP core locked.
- * @note This should update @c session->timeout_time_ms to the next timeout time.
+ *
+ * @param session  The ping session.
+ * @param ping_pcb PCB to send retransmissions on.
+ * @param wake_ms  Updated to the earliest remaining request timeout, if that is sooner.
  */
-static void ping_session_timeout(struct ping_session *session, struct raw_pcb *ping_pcb)
+static void ping_session_process_timeouts(struct ping_session *session,
+                                          struct raw_pcb *ping_pcb,
+                                          uint32_t *wake_ms)
 {
-    if (session->state == PING_AWAITING_SND)
-    {
-        session->num_retries = 0;
-        uint16_t seq = session->stats.ping_total_count;
-        /* Increment the count and update state first, since we might get the receive callback
-         * before ping_send_req() returns. */
-        session->stats.ping_total_count++;
-        dup_check_bitmap_clear(session, session->stats.ping_total_count % N_DUP_CHECK_BITS);
-        session->state = PING_AWAITING_RSP;
-        session->next_seq_time_ms = mmosal_get_time_ms() + session->args.ping_interval_ms;
-        ping_send_req(ping_pcb, session, seq);
-    }
-    else if (session->state == PING_AWAITING_RSP)
+    unsigned ii;
+
+    for (ii = 0; ii < MMPING_MAX_IN_FLIGHT; ii++)
     {
-        if (session->num_retries < MMPING_MAX_RETRIES)
+        struct ping_request *request = &session->requests[ii];
+        if (!request->outstanding)
         {
-            session->num_retries++;
-            ping_send_req(ping_pcb, session, session->stats.ping_total_count - 1);
+            continue;
         }
-        else
-        {
-            /* Maximum number of retries received. Give up and move on if we have more to send.
-             * Otherwise we are finished. */
 
-            if (session->stats.ping_total_count < session->args.ping_count)
+        if (mmosal_time_le(request->timeout_time_ms, mmosal_get_time_ms()))
+        {
+            if (request->num_retries < MMPING_MAX_RETRIES)
             {
-                LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL, ("Maximum number of retries reached\n"));
-                session->state = PING_AWAITING_SND;
-                /* Set the timeout time to previously calculated next request time. Note that
-                 * this may be in the past (and thus we will time out immediately) if the RTT
-                 * was longer than the interval or if transmissions made us take longer than
-                 * the interval. */
-                session->timeout_time_ms = session->next_seq_time_ms;
+                request->num_retries++;
+                ping_send_req(ping_pcb, session, request);
             }
             else
             {
                 LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL,
-                            ("Timeout waiting for final response, transitioning to IDLE state\n"));
-                session->state = PING_IDLE;
+                            ("Maximum number of retries reached (seq=%u)\n", request->seq_num));
+                request->outstanding = false;
+                session->num_in_flight--;
+                continue;
             }
         }
+
+        if (mmosal_time_lt(request->timeout_time_ms, *wake_ms))
+        {
+            *wake_ms = request->timeout_time_ms;
+        }
+    }
+}
+
+/**
+ * Send as many new requests as the interval and in-flight limit allow.
+ *
+ * @note Will be called with TCP/IP core locked.
+ *
+ * @param session  The ping session.
+ * @param ping_pcb PCB to send requests on.
+ * @param wake_ms  Updated to the time at which the next request is due, if that is sooner.
+ */
+static void ping_session_send_new(struct ping_session *session,
+                                  struct raw_pcb *ping_pcb,
+                                  uint32_t *wake_ms)
+{
+    while (session->stats.ping_total_count < session->args.ping_count &&
+           session->num_in_flight < session->args.max_in_flight)
+    {
+        uint16_t seq = session->stats.ping_total_count;
+        struct ping_request *request = ping_get_request(session, seq);
+
+        /* An older request that is still being retried may occupy the slot. It will be freed
+         * when it is answered or times out. */
+        if (request->outstanding)
+        {
+            break;
+        }
+
+        if (!mmosal_time_le(session->next_seq_time_ms, mmosal_get_time_ms()))
+        {
+            if (mmosal_time_lt(session->next_seq_time_ms, *wake_ms))
+            {
+                *wake_ms = session->next_seq_time_ms;
+            }
+            break;
+        }
+
+        /* Update state first, since we might get the receive callback before ping_send_req()
+         * returns. */
+        request->seq_num = seq;
+        request->num_retries = 0;
+        request->outstanding = true;
+        session->num_in_flight++;
+        session->stats.ping_total_count++;
+        session->next_seq_time_ms = mmosal_get_time_ms() + session->args.ping_interval_ms;
+        ping_send_req(ping_pcb, session, request);
     }
 }
 
 void ping_task(void *arg)
 {
     struct raw_pcb *ping_pcb = NULL;
-    struct ping_session *session = &ping_session;
-
-    LWIP_UNUSED_ARG(arg);
+    struct ping_session *session = (struct ping_session *)arg;
 
     LOCK_TCPIP_CORE();
 #if LWIP_IPV4
@@ -593,7 +611,7 @@ void ping_task(void *arg)
     {
         ping_pcb = raw_new(IP_PROTO_ICMP);
         LWIP_ASSERT("ping_pcb != NULL", ping_pcb != NULL);
-        raw_recv(ping_pcb, ping_recv, NULL);
+        raw_recv(ping_pcb, ping_recv, session);
         raw_bind(ping_pcb, IP4_ADDR_ANY);
     }
 #endif
@@ -602,41 +620,55 @@ void ping_task(void *arg)
     {
         ping_pcb = raw_new(IP6_NEXTH_ICMP6);
         LWIP_ASSERT("ping_pcb != NULL", ping_pcb != NULL);
-        raw_recv(ping_pcb, ping_recv, NULL);
+        raw_recv(ping_pcb, ping_recv, session);
         raw_bind(ping_pcb, IP6_ADDR_ANY);
     }
 #endif
 
-    while (session->state != PING_IDLE)
+    while (session->running)
     {
-        if (mmosal_time_le(session->timeout_time_ms, mmosal_get_time_ms()))
+        uint32_t wake_ms = mmosal_get_time_ms() + PING_MAX_SLEEP_MS;
+
+        ping_session_process_timeouts(session, ping_pcb, &wake_ms);
+        ping_session_send_new(session, ping_pcb, &wake_ms);
+
+        if (session->stats.ping_total_count >= session->args.ping_count &&
+            session->num_in_flight == 0)
         {
-            ping_session_timeout(session, ping_pcb);
+            LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL, ("All ping requests complete, stopping session\n"));
+            session->running = false;
+            break;
         }
-        else
+
+        uint32_t sleep_time = wake_ms - mmosal_get_time_ms();
+        UNLOCK_TCPIP_CORE();
+        /* Sanity check that the current time hasn't passed the wake time. */
+        if ((int32_t)sleep_time > 0)
         {
-            uint32_t sleep_time = session->timeout_time_ms - mmosal_get_time_ms();
-            UNLOCK_TCPIP_CORE();
-            /* Sanity check that the current time hasn't passed the timeout time. */
-            if ((int32_t)sleep_time > 0)
-            {
-                mmosal_semb_wait(session->semb, sleep_time);
-            }
-            LOCK_TCPIP_CORE();
+            mmosal_semb_wait(session->semb, sleep_time);
         }
+        LOCK_TCPIP_CORE();
     }
 
-    LWIP_DEBUGF(
-        LWIP_DBG_LEVEL_ALL,
-        ("Ping summary: %lu sent/%lu received (%lu%% loss) %lu/%lu/%lu min/avg/max RTT ms\n",
-         session->stats.ping_total_count,
-         session->stats.ping_recv_count,
-         (session->stats.ping_total_count - session->stats.ping_recv_count) *
-             100 /
+    if (session->stats.ping_recv_count > 0)
+    {
+        LWIP_DEBUGF(
+            LWIP_DBG_LEVEL_ALL,
+            ("Ping summary: %lu sent/%lu received (%lu%% loss) %lu/%lu/%lu min/avg/max RTT ms\n",
              session->stats.ping_total_count,
-         session->stats.ping_min_time_ms,
-         session->rtt_sum_ms / session->stats.ping_recv_count,
-         session->stats.ping_max_time_ms));
+             session->stats.ping_recv_count,
+             (session->stats.ping_total_count - session->stats.ping_recv_count) *
+                 100 /
+                 session->stats.ping_total_count,
+             session->stats.ping_min_time_ms,
+             session->rtt_sum_ms / session->stats.ping_recv_count,
+             session->stats.ping_max_time_ms));
+    }
+    else
+    {
+        LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL,
+                    ("Ping summary: %lu sent/0 received\n", session->stats.ping_total_count));
+    }
 
     raw_disconnect(ping_pcb);
     raw_remove(ping_pcb);
@@ -646,33 +678,106 @@ void ping_task(void *arg)
     session->task_handle = NULL;
 }
 
-void mmping_stats(struct mmping_stats *stats)
+/**
+ * Collect statistics across sessions.
+ *
+ * @note Must be invoked with TCPIP core locked.
+ *
+ * @param session_id Session to collect statistics for, or zero to aggregate all sessions.
+ * @param stats      Instance to receive ping statistics.
+ */
+static void ping_collect_stats(uint16_t session_id, struct mmping_stats *stats)
 {
-    LOCK_TCPIP_CORE();
-    struct ping_session *session = &ping_session;
-    *stats = session->stats;
-    stats->ping_is_running = (session->state != PING_IDLE);
-    if (session->stats.ping_recv_count)
-    {
-        stats->ping_avg_time_ms = session->rtt_sum_ms / session->stats.ping_recv_count;
-    }
-    else
+    uint32_t rtt_sum_ms = 0;
+    unsigned ii;
+
+    memset(stats, 0, sizeof(*stats));
+
+    for (ii = 0; ii < MMPING_MAX_SESSIONS; ii++)
     {
-        stats->ping_avg_time_ms = 0;
+        struct ping_session *session = &ping_sessions[ii];
+        if (session->session_id == 0 || (session_id != 0 && session->session_id != session_id))
+        {
+            continue;
+        }
+
+        char receiver[MMPING_IPADDR_MAXLEN];
+        ipaddr_ntoa_r(&session->args.ping_target, receiver, sizeof(receiver));
+        if (stats->ping_session_count == 0)
+        {
+            memcpy(stats->ping_receiver, receiver, sizeof(stats->ping_receiver));
+        }
+        else if (strncmp(stats->ping_receiver, receiver, sizeof(receiver)) != 0)
+        {
+            stats->ping_receiver[0] = '\0';
+        }
+
+        if (session->stats.ping_recv_count > 0)
+        {
+            if (stats->ping_recv_count == 0 ||
+                session->stats.ping_min_time_ms < stats->ping_min_time_ms)
+            {
+                stats->ping_min_time_ms = session->stats.ping_min_time_ms;
+            }
+            if (session->stats.ping_max_time_ms > stats->ping_max_time_ms)
+            {
+                stats->ping_max_time_ms = session->stats.ping_max_time_ms;
+            }
+        }
+        stats->ping_total_count += session->stats.ping_total_count;
+        stats->ping_recv_count += session->stats.ping_recv_count;
+        stats->ping_is_running |= session->running;
+        stats->ping_session_count++;
+        rtt_sum_ms += session->rtt_sum_ms;
+    }
+
+    if (stats->ping_recv_count)
+    {
+        stats->ping_avg_time_ms = rtt_sum_ms / stats->ping_recv_count;
+        stats->ping_p50_time_ms = rtt_hist_percentile(session_id, stats->ping_recv_count, 500);
+        stats->ping_p90_time_ms = rtt_hist_percentile(session_id, stats->ping_recv_count, 900);
+        stats->ping_p99_time_ms = rtt_hist_percentile(session_id, stats->ping_recv_count, 990);
+
+        /* Bucket upper bounds may exceed the largest RTT actually observed. */
+        stats->ping_p50_time_ms = mmhist_clamp(stats->ping_p50_time_ms,
+                                               stats->ping_min_time_ms,
+                                               stats->ping_max_time_ms);
+        stats->ping_p90_time_ms = mmhist_clamp(stats->ping_p90_time_ms,
+                                               stats->ping_min_time_ms,
+                                               stats->ping_max_time_ms);
+        stats->ping_p99_time_ms = mmhist_clamp(stats->ping_p99_time_ms,
+                                               stats->ping_min_time_ms,
+                                               stats->ping_max_time_ms);
     }
-    if (stats->ping_receiver[0] == '\0')
+}
+
+void mmping_stats(struct mmping_stats *stats)
+{
+    LOCK_TCPIP_CORE();
+    ping_collect_stats(0, stats);
+    UNLOCK_TCPIP_CORE();
+}
+
+bool mmping_session_stats(uint16_t session_id, struct mmping_stats *stats)
+{
+    if (session_id == 0)
     {
-        ipaddr_ntoa_r(&session->args.ping_target,
-                      stats->ping_receiver,
-                      sizeof(stats->ping_receiver));
+        return false;
     }
+
+    LOCK_TCPIP_CORE();
+    ping_collect_stats(session_id, stats);
     UNLOCK_TCPIP_CORE();
+
+    return stats->ping_session_count != 0;
 }
 
-void mmping_stop(void)
+/**
+ * Stop the given session and wait for its task to terminate.
+ */
+static void ping_session_stop(struct ping_session *session)
 {
-    struct ping_session *session = &ping_session;
-    session->state = PING_IDLE;
+    session->running = false;
 
     if (session->semb != NULL)
     {
@@ -684,18 +789,64 @@ void mmping_stop(void)
     }
 }
 
+void mmping_stop(void)
+{
+    unsigned ii;
+    for (ii = 0; ii < MMPING_MAX_SESSIONS; ii++)
+    {
+        ping_session_stop(&ping_sessions[ii]);
+    }
+}
+
+void mmping_stop_session(uint16_t session_id)
+{
+    unsigned ii;
+    for (ii = 0; ii < MMPING_MAX_SESSIONS; ii++)
+    {
+        if (session_id != 0 && ping_sessions[ii].session_id == session_id)
+        {
+            ping_session_stop(&ping_sessions[ii]);
+        }
+    }
+}
+
+static bool ping_session_is_active(const struct ping_session *session)
+{
+    return session->running || session->task_handle != NULL;
+}
+
 static struct ping_session *ping_get_empty_session(void)
 {
-    struct ping_session *session = &ping_session;
+    struct ping_session *empty = NULL;
+    bool any_active = false;
+    unsigned ii;
 
-    if (session->state == PING_IDLE && session->task_handle == NULL)
+    for (ii = 0; ii < MMPING_MAX_SESSIONS; ii++)
     {
-        return session;
+        struct ping_session *session = &ping_sessions[ii];
+        if (ping_session_is_active(session))
+        {
+            any_active = true;
+        }
+        else if (empty == NULL || (empty->session_id != 0 && session->session_id == 0))
+        {
+            /* Prefer a slot that has never been used so that the statistics of finished
+             * sessions are retained for as long as possible. */
+            empty = session;
+        }
     }
-    else
+
+    /* If nothing else is running then this is the start of a new set of sessions, so reset the
+     * statistics of any previous sessions. */
+    if (!any_active)
     {
-        return NULL;
+        for (ii = 0; ii < MMPING_MAX_SESSIONS; ii++)
+        {
+            ping_sessions[ii].session_id = 0;
+        }
     }
+
+    return empty;
 }
 
 uint16_t mmping_start(const struct mmping_args *args)
@@ -710,11 +861,22 @@ uint16_t mmping_start(const struct mmping_args *args)
         return 0;
     }
 
+    if (args->max_in_flight > MMPING_MAX_IN_FLIGHT)
+    {
+        LWIP_DEBUGF(LWIP_DBG_LEVEL_WARNING,
+                    ("Invalid max in flight %u (maximum %d)\n",
+                     args->max_in_flight,
+                     MMPING_MAX_IN_FLIGHT));
+        return 0;
+    }
+
+    LOCK_TCPIP_CORE();
     struct ping_session *session = ping_get_empty_session();
     if (session == NULL)
     {
+        UNLOCK_TCPIP_CORE();
         LWIP_DEBUGF(LWIP_DBG_LEVEL_WARNING,
-                    ("Unable to start ping: session already in progress\n"));
+                    ("Unable to start ping: too many sessions in progress\n"));
         return 0;
     }
 
@@ -722,27 +884,33 @@ uint16_t mmping_start(const struct mmping_args *args)
      * won't be multiple threads accessing the data structure. */
     memset((void *)session, 0, sizeof(*session));
 
+    /* Claim the slot so that a concurrent call does not select it as well. */
+    session->running = true;
+
     /* Start at a random session identifier */
     if (ping_next_session_id == 0)
     {
         ping_next_session_id = mmhal_random_u32(1, 0xffff);
     }
 
-    session->session_id = ping_next_session_id;
+    uint16_t session_id = ping_next_session_id;
 
     /* Increment next session identifier, but skip zero since we reserve it. */
     if (++ping_next_session_id == 0)
     {
         ping_next_session_id = 1;
     }
+    UNLOCK_TCPIP_CORE();
 
     LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL,
-                ("Starting ping session. Target=%s Interval=%lums Count=%lu Size=%lu\n",
+                ("Starting ping session. Target=%s Interval=%lums Count=%lu Size=%lu "
+                 "In-flight=%u\n",
                  args->ping_target,
                  args->ping_interval_ms,
                  args->ping_count,
-                 args->ping_size));
-    if (session->args.ping_interval_ms < PING_DISPLAY_THRESHOLD_MS)
+                 args->ping_size,
+                 args->max_in_flight));
+    if (args->ping_interval_ms < PING_DISPLAY_THRESHOLD_MS)
     {
         LWIP_DEBUGF(LWIP_DBG_LEVEL_ALL,
                     ("Interval is less than %d ms threshold for showing individual pings\n",
@@ -752,46 +920,55 @@ uint16_t mmping_start(const struct mmping_args *args)
     int ok = ipaddr_aton(args->ping_src, &session->args.ping_src);
     if (!ok)
     {
+        session->running = false;
         return 0;
     }
     ok = ipaddr_aton(args->ping_target, &session->args.ping_target);
     if (!ok)
     {
+        session->running = false;
         return 0;
     }
 
     session->args.ping_interval_ms = args->ping_interval_ms;
     session->args.ping_count = args->ping_count;
     session->args.ping_size = args->ping_size;
+    session->args.max_in_flight = args->max_in_flight;
 
-    session->state = PING_AWAITING_SND;
-    session->timeout_time_ms = mmosal_get_time_ms();
-    session->last_rx_seq_num = -1;
+    session->next_seq_time_ms = mmosal_get_time_ms();
 
     if (args->ping_count == 0 || args->ping_count > MMPING_MAX_COUNT)
     {
         session->args.ping_count = MMPING_MAX_COUNT;
     }
 
+    if (args->max_in_flight == 0)
+    {
+        session->args.max_in_flight = 1;
+    }
+
     session->semb = mmosal_semb_create("ping");
     if (session->semb == NULL)
     {
-        session->stats.ping_is_running = false;
-        session->state = PING_IDLE;
+        session->running = false;
         return 0;
     }
 
+    /* Assign the session ID only once the session is fully initialised, since the session ID is
+     * used to determine which sessions contribute to the statistics. */
+    session->session_id = session_id;
+
     session->task_handle =
-        mmosal_task_create(ping_task, NULL, MMOSAL_TASK_PRI_LOW, 512, "ping_request");
+        mmosal_task_create(ping_task, session, MMOSAL_TASK_PRI_LOW, 512, "ping_request");
     if (session->task_handle == NULL)
     {
         mmosal_semb_delete(session->semb);
         session->semb = NULL;
 
-        session->stats.ping_is_running = false;
-        session->state = PING_IDLE;
+        session->session_id = 0;
+        session->running = false;
         return 0;
     }
 
-    return session->session_id;
+    return session_id;
 }
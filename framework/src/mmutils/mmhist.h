@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @defgroup MMHIST Morse Micro log-linear histogram (mmhist) API
+ *
+ * Helpers for fixed size log-linear histograms, as used for latency percentiles.
+ *
+ * Values below 2^sub_bucket_bits each have their own bucket. Above that, each power of two range
+ * is split into 2^sub_bucket_bits linearly spaced buckets. This gives a constant relative error
+ * of at most 2^-sub_bucket_bits across the whole range without any dynamic allocation.
+ *
+ * The caller owns the bucket counters, so can choose their width and combine several histograms
+ * of the same geometry when computing percentiles.
+ *
+ * @{
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * Number of buckets in a histogram.
+ *
+ * @param sub_bucket_bits Number of linear sub-buckets per power of two, as a power of 2.
+ * @param max_value_bits  Values are clamped to be less than 2^max_value_bits.
+ */
+#define MMHIST_NUM_BUCKETS(sub_bucket_bits, max_value_bits) \
+    (((max_value_bits) - (sub_bucket_bits) + 1) << (sub_bucket_bits))
+
+/**
+ * Get the index of the bucket that a value falls into.
+ *
+ * @param value           The value. Values of 2^max_value_bits or more are clamped.
+ * @param sub_bucket_bits Number of linear sub-buckets per power of two, as a power of 2.
+ * @param max_value_bits  Values are clamped to be less than 2^max_value_bits.
+ *
+ * @returns the bucket index, which is less than
+ *          @ref MMHIST_NUM_BUCKETS(@p sub_bucket_bits, @p max_value_bits).
+ */
+static inline unsigned mmhist_bucket_index(uint32_t value,
+                                           unsigned sub_bucket_bits,
+                                           unsigned max_value_bits)
+{
+    const uint32_t sub_buckets = 1ul << sub_bucket_bits;
+
+    if (value >= (1ul << max_value_bits))
+    {
+        value = (1ul << max_value_bits) - 1;
+    }
+    if (value < sub_buckets)
+    {
+        return value;
+    }
+
+    unsigned shift = (31 - __builtin_clz(value)) - sub_bucket_bits;
+    return ((shift + 1) << sub_bucket_bits) + ((value >> shift) & (sub_buckets - 1));
+}
+
+/**
+ * Get the largest value that falls into the bucket with the given index.
+ *
+ * @param index           The bucket index.
+ * @param sub_bucket_bits Number of linear sub-buckets per power of two, as a power of 2.
+ *
+ * @returns the upper bound of the bucket.
+ */
+static inline uint32_t mmhist_bucket_upper_bound(unsigned index, unsigned sub_bucket_bits)
+{
+    const uint32_t sub_buckets = 1ul << sub_bucket_bits;
+
+    if (index < sub_buckets)
+    {
+        return index;
+    }
+
+    unsigned shift = (index >> sub_bucket_bits) - 1;
+    return ((sub_buckets + (index & (sub_buckets - 1))) << shift) + (1ul << shift) - 1;
+}
+
+/**
+ * Get the rank of a percentile, i.e., the number of samples that must be counted (walking the
+ * buckets in ascending order) to reach it.
+ *
+ * @param count     Total number of samples.
+ * @param per_mille The percentile, in units of 0.1%.
+ *
+ * @returns the rank of the percentile.
+ */
+static inline uint32_t mmhist_percentile_rank(uint32_t count, uint32_t per_mille)
+{
+    return (uint32_t)(((uint64_t)count * per_mille + 999) / 1000);
+}
+
+/**
+ * Clamp a percentile to the range of the samples. Bucket upper bounds may overshoot the largest
+ * sample, and the smallest sample may be larger than its bucket's lower values.
+ *
+ * @param value The percentile, as returned by @ref mmhist_bucket_upper_bound().
+ * @param min   Smallest sample recorded.
+ * @param max   Largest sample recorded.
+ *
+ * @returns @p value clamped to the range @p min to @p max.
+ */
+static inline uint32_t mmhist_clamp(uint32_t value, uint32_t min, uint32_t max)
+{
+    if (value < min)
+    {
+        return min;
+    }
+    if (value > max)
+    {
+        return max;
+    }
+    return value;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
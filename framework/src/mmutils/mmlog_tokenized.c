@@ -0,0 +1,524 @@
+/*
+ * Copyright 2026 Morse Micro
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Tokenized logging backend and per-module runtime log levels. See mmlog.h for the record format.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "mmhal_os.h"
+#include "mmlog.h"
+#include "mmosal.h"
+#include "mmutils.h"
+
+#if MMLOG_RUNTIME_LEVELS_ENABLED
+
+uint8_t mmlog_module_levels[MMLOG_MODULE_COUNT] = {
+    [0 ... MMLOG_MODULE_COUNT - 1] = MMLOG_LEVEL,
+};
+
+void mmlog_set_module_level(enum mmlog_module module, uint8_t level)
+{
+    if ((unsigned)module < MMLOG_MODULE_COUNT)
+    {
+        mmlog_module_levels[module] = level;
+    }
+}
+
+uint8_t mmlog_get_module_level(enum mmlog_module module)
+{
+    if ((unsigned)module >= MMLOG_MODULE_COUNT)
+    {
+        return MMLOG_LEVEL_INVALID;
+    }
+    return mmlog_module_levels[module];
+}
+
+#endif
+
+#if MMLOG_TOKENIZED_ENABLED
+
+#ifndef MMLOG_TOKENIZED_BUF_SIZE
+/** Size of the tokenized log ring buffer in octets. Must be a power of 2. */
+#define MMLOG_TOKENIZED_BUF_SIZE (2048)
+#endif
+
+#ifndef MMLOG_TOKENIZED_MAX_RECORD_LEN
+/** Maximum length of a single tokenized log record in octets (including header). */
+#define MMLOG_TOKENIZED_MAX_RECORD_LEN (96)
+#endif
+
+#ifndef MMLOG_TOKENIZED_MAX_STR_LEN
+/** Maximum number of characters of a string argument that will be included in a record. */
+#define MMLOG_TOKENIZED_MAX_STR_LEN (32)
+#endif
+
+#ifndef MMLOG_TOKENIZED_DRAIN_INTERVAL_MS
+/** Interval at which the drain task polls the ring buffer when it is empty. */
+#define MMLOG_TOKENIZED_DRAIN_INTERVAL_MS (10)
+#endif
+
+#ifndef MMLOG_TOKENIZED_TASK_STACK_SIZE_U32
+/** Stack size of the drain task in 32-bit words. */
+#define MMLOG_TOKENIZED_TASK_STACK_SIZE_U32 (256)
+#endif
+
+/** Length of the record header (sync, length, ID, timestamp and task name). */
+#define RECORD_HDR_LEN (12)
+
+MM_STATIC_ASSERT((MMLOG_TOKENIZED_BUF_SIZE & (MMLOG_TOKENIZED_BUF_SIZE - 1)) == 0,
+                 "MMLOG_TOKENIZED_BUF_SIZE must be a power of 2");
+MM_STATIC_ASSERT(MMLOG_TOKENIZED_MAX_RECORD_LEN >= RECORD_HDR_LEN + 8,
+                 "MMLOG_TOKENIZED_MAX_RECORD_LEN too small");
+MM_STATIC_ASSERT(MMLOG_TOKENIZED_MAX_RECORD_LEN <= UINT8_MAX + 2,
+                 "MMLOG_TOKENIZED_MAX_RECORD_LEN too large for length field");
+MM_STATIC_ASSERT(MMLOG_TOKENIZED_MAX_STR_LEN < UINT8_MAX,
+                 "MMLOG_TOKENIZED_MAX_STR_LEN too large for length field");
+
+/** Tokenized log state. */
+struct mmlog_tokenized_data
+{
+    /** Ring buffer containing whole records. */
+    uint8_t buf[MMLOG_TOKENIZED_BUF_SIZE];
+    /** Free-running write index. Only modified within a critical section. */
+    volatile uint32_t wr_idx;
+    /** Free-running read index. Only modified by the (single) reader. */
+    volatile uint32_t rd_idx;
+    /** Number of records dropped since last reported. */
+    volatile uint32_t dropped;
+    /** Buffer used by the drain task. */
+    uint8_t drain_buf[2 * MMLOG_TOKENIZED_MAX_RECORD_LEN];
+};
+
+/** Tokenized log state. */
+static struct mmlog_tokenized_data mmlog_tokenized;
+
+/** Cursor used when encoding a record. */
+struct record_cursor
+{
+    /** Buffer that the record is being encoded into. */
+    uint8_t *buf;
+    /** Current offset into @c buf. */
+    size_t offset;
+    /** Set to true when the record was too short to contain all arguments. */
+    bool truncated;
+};
+
+static void record_put_u32(struct record_cursor *cursor, uint32_t value)
+{
+    if (cursor->truncated || cursor->offset + 4 > MMLOG_TOKENIZED_MAX_RECORD_LEN)
+    {
+        cursor->truncated = true;
+        return;
+    }
+
+    cursor->buf[cursor->offset++] = value;
+    cursor->buf[cursor->offset++] = value >> 8;
+    cursor->buf[cursor->offset++] = value >> 16;
+    cursor->buf[cursor->offset++] = value >> 24;
+}
+
+static void record_put_u64(struct record_cursor *cursor, uint64_t value)
+{
+    if (cursor->truncated || cursor->offset + 8 > MMLOG_TOKENIZED_MAX_RECORD_LEN)
+    {
+        cursor->truncated = true;
+        return;
+    }
+
+    record_put_u32(cursor, (uint32_t)value);
+    record_put_u32(cursor, (uint32_t)(value >> 32));
+}
+
+static void record_put_str(struct record_cursor *cursor, const char *str)
+{
+    if (str == NULL)
+    {
+        str = "(null)";
+    }
+
+    size_t len = strnlen(str, MMLOG_TOKENIZED_MAX_STR_LEN);
+    if (cursor->truncated || cursor->offset + 1 + len > MMLOG_TOKENIZED_MAX_RECORD_LEN)
+    {
+        cursor->truncated = true;
+        return;
+    }
+
+    cursor->buf[cursor->offset++] = len;
+    memcpy(cursor->buf + cursor->offset, str, len);
+    cursor->offset += len;
+}
+
+/** Length modifiers of a @c printf conversion specification. */
+enum length_modifier
+{
+    LENGTH_DEFAULT,
+    LENGTH_LONG,
+    LENGTH_LONG_LONG,
+    LENGTH_SIZE,
+    LENGTH_INTMAX,
+    LENGTH_PTRDIFF,
+    LENGTH_LONG_DOUBLE,
+};
+
+/**
+ * Encode arguments according to the given format string.
+ *
+ * This only needs to walk the conversion specifications to know how to fetch each argument;
+ * all formatting is left to the host.
+ *
+ * @param cursor    Cursor to encode the arguments at.
+ * @param fmt       The @c printf format string.
+ * @param args      Arguments matching @p fmt.
+ */
+static void record_put_args(struct record_cursor *cursor, const char *fmt, va_list args)
+{
+    while (*fmt != '\0' && !cursor->truncated)
+    {
+        if (*fmt++ != '%')
+        {
+            continue;
+        }
+
+        while (*fmt == '-' || *fmt == '+' || *fmt == ' ' || *fmt == '#' || *fmt == '0')
+        {
+            fmt++;
+        }
+
+        if (*fmt == '*')
+        {
+            record_put_u32(cursor, va_arg(args, int));
+            fmt++;
+        }
+        while (*fmt >= '0' && *fmt <= '9')
+        {
+            fmt++;
+        }
+
+        if (*fmt == '.')
+        {
+            fmt++;
+            if (*fmt == '*')
+            {
+                record_put_u32(cursor, va_arg(args, int));
+                fmt++;
+            }
+            while (*fmt >= '0' && *fmt <= '9')
+            {
+                fmt++;
+            }
+        }
+
+        enum length_modifier length = LENGTH_DEFAULT;
+        switch (*fmt)
+        {
+            case 'h':
+                fmt += (fmt[1] == 'h') ? 2 : 1;
+                break;
+
+            case 'l':
+                if (fmt[1] == 'l')
+                {
+                    length = LENGTH_LONG_LONG;
+                    fmt++;
+                }
+                else
+                {
+                    length = LENGTH_LONG;
+                }
+                fmt++;
+                break;
+
+            case 'z':
+                length = LENGTH_SIZE;
+                fmt++;
+                break;
+
+            case 'j':
+                length = LENGTH_INTMAX;
+                fmt++;
+                break;
+
+            case 't':
+                length = LENGTH_PTRDIFF;
+                fmt++;
+                break;
+
+            case 'L':
+                length = LENGTH_LONG_DOUBLE;
+                fmt++;
+                break;
+
+            default:
+                break;
+        }
+
+        switch (*fmt++)
+        {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+            case 'c':
+                switch (length)
+                {
+                    case LENGTH_LONG:
+                        record_put_u32(cursor, va_arg(args, unsigned long));
+                        break;
+
+                    case LENGTH_LONG_LONG:
+                        record_put_u64(cursor, va_arg(args, unsigned long long));
+                        break;
+
+                    case LENGTH_SIZE:
+                        record_put_u32(cursor, va_arg(args, size_t));
+                        break;
+
+                    case LENGTH_INTMAX:
+                        record_put_u64(cursor, va_arg(args, uintmax_t));
+                        break;
+
+                    case LENGTH_PTRDIFF:
+                        record_put_u32(cursor, va_arg(args, ptrdiff_t));
+                        break;
+
+                    default:
+                        record_put_u32(cursor, va_arg(args, unsigned));
+                        break;
+                }
+                break;
+
+            case 'p':
+                record_put_u32(cursor, (uintptr_t)va_arg(args, void *));
+                break;
+
+            case 's':
+                record_put_str(cursor, va_arg(args, const char *));
+                break;
+
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+            {
+                union {
+                    double d;
+                    uint64_t u;
+                } value;
+                if (length == LENGTH_LONG_DOUBLE)
+                {
+                    value.d = (double)va_arg(args, long double);
+                }
+                else
+                {
+                    value.d = va_arg(args, double);
+                }
+                record_put_u64(cursor, value.u);
+                break;
+            }
+
+            case 'n':
+                (void)va_arg(args, void *);
+                break;
+
+            case '%':
+                break;
+
+            default:
+                /* Unsupported conversion; we cannot know how to fetch the remaining arguments. */
+                return;
+        }
+    }
+}
+
+/**
+ * Copy a record into the ring buffer.
+ *
+ * @param record    The record to copy.
+ * @param len       Length of @p record.
+ *
+ * @returns true if the record was copied, false if there was insufficient space.
+ */
+static bool mmlog_tokenized_ring_put(const uint8_t *record, size_t len)
+{
+    bool ok = false;
+
+    mmosal_task_enter_critical();
+    uint32_t wr_idx = mmlog_tokenized.wr_idx;
+    if (MMLOG_TOKENIZED_BUF_SIZE - (wr_idx - mmlog_tokenized.rd_idx) >= len)
+    {
+        size_t offset = wr_idx & (MMLOG_TOKENIZED_BUF_SIZE - 1);
+        size_t first = MMLOG_TOKENIZED_BUF_SIZE - offset;
+        if (first > len)
+        {
+            first = len;
+        }
+        memcpy(mmlog_tokenized.buf + offset, record, first);
+        memcpy(mmlog_tokenized.buf, record + first, len - first);
+        mmlog_tokenized.wr_idx = wr_idx + len;
+        ok = true;
+    }
+    else
+    {
+        mmlog_tokenized.dropped++;
+    }
+    mmosal_task_exit_critical();
+
+    return ok;
+}
+
+/** Get the octet at the given free-running index of the ring buffer. */
+static uint8_t mmlog_tokenized_ring_peek(uint32_t idx)
+{
+    return mmlog_tokenized.buf[idx & (MMLOG_TOKENIZED_BUF_SIZE - 1)];
+}
+
+/** Begin a record in the given buffer, returning a cursor positioned after the header. */
+static struct record_cursor record_begin(uint8_t *buf, uint32_t id)
+{
+    struct record_cursor cursor = { .buf = buf, .offset = 2 };
+    const char *task_name = mmosal_task_name();
+
+    buf[0] = MMLOG_TOKENIZED_SYNC;
+    record_put_u32(&cursor, id);
+    record_put_u32(&cursor, mmosal_get_time_ms());
+    buf[cursor.offset++] = (task_name != NULL && task_name[0] != '\0') ? task_name[0] : '?';
+    buf[cursor.offset++] = (task_name != NULL && task_name[0] != '\0') ? task_name[1] : '?';
+
+    return cursor;
+}
+
+/** Complete a record, filling in its length field. Returns the total length of the record. */
+static size_t record_end(struct record_cursor *cursor)
+{
+    cursor->buf[1] = cursor->offset - 2;
+    return cursor->offset;
+}
+
+void mmlog_tokenized_write(const struct mmlog_tokenized_desc *desc, ...)
+{
+    uint8_t record[MMLOG_TOKENIZED_MAX_RECORD_LEN];
+    struct record_cursor cursor = record_begin(record, (uint32_t)(uintptr_t)desc);
+
+    va_list args;
+    va_start(args, desc);
+    record_put_args(&cursor, desc->fmt, args);
+    va_end(args);
+
+    mmlog_tokenized_ring_put(record, record_end(&cursor));
+}
+
+size_t mmlog_tokenized_read(uint8_t *buf, size_t maxlen)
+{
+    uint32_t rd_idx = mmlog_tokenized.rd_idx;
+    uint32_t wr_idx = mmlog_tokenized.wr_idx;
+    size_t len = 0;
+
+    /* Records are only ever added whole, so we can walk them without a lock. */
+    while (rd_idx != wr_idx)
+    {
+        size_t record_len = mmlog_tokenized_ring_peek(rd_idx + 1) + 2;
+        if (len + record_len > maxlen)
+        {
+            break;
+        }
+
+        while (record_len--)
+        {
+            buf[len++] = mmlog_tokenized_ring_peek(rd_idx++);
+        }
+    }
+
+    mmlog_tokenized.rd_idx = rd_idx;
+    return len;
+}
+
+/**
+ * If any records have been dropped, encode a record to report this.
+ *
+ * @param buf   Buffer of at least @c MMLOG_TOKENIZED_MAX_RECORD_LEN octets to encode into.
+ *
+ * @returns the length of the record, or 0 if no records have been dropped.
+ */
+static size_t mmlog_tokenized_encode_dropped(uint8_t *buf)
+{
+    uint32_t dropped;
+
+    mmosal_task_enter_critical();
+    dropped = mmlog_tokenized.dropped;
+    mmlog_tokenized.dropped = 0;
+    mmosal_task_exit_critical();
+
+    if (dropped == 0)
+    {
+        return 0;
+    }
+
+    struct record_cursor cursor = record_begin(buf, MMLOG_TOKENIZED_ID_DROPPED);
+    record_put_u32(&cursor, dropped);
+    return record_end(&cursor);
+}
+
+void mmlog_tokenized_flush(void)
+{
+    uint8_t *buf = mmlog_tokenized.drain_buf;
+    size_t len = mmlog_tokenized_encode_dropped(buf);
+
+    while (len != 0 || (len = mmlog_tokenized_read(buf, sizeof(mmlog_tokenized.drain_buf))) != 0)
+    {
+        /* Interrupts may be disabled, so make sure there is room in the log output first. */
+        mmhal_log_flush();
+        mmhal_log_write(buf, len);
+        len = 0;
+    }
+}
+
+/**
+ * Task that drains the ring buffer to the log output.
+ *
+ * @param arg   Unused.
+ */
+static void mmlog_tokenized_drain_task(void *arg)
+{
+    MM_UNUSED(arg);
+
+    while (true)
+    {
+        size_t len = mmlog_tokenized_encode_dropped(mmlog_tokenized.drain_buf);
+        len += mmlog_tokenized_read(mmlog_tokenized.drain_buf + len,
+                                    sizeof(mmlog_tokenized.drain_buf) - len);
+        if (len != 0)
+        {
+            mm_logging_write(mmlog_tokenized.drain_buf, len);
+        }
+        else
+        {
+            mmosal_task_sleep(MMLOG_TOKENIZED_DRAIN_INTERVAL_MS);
+        }
+    }
+}
+
+void mmlog_tokenized_init(void)
+{
+    struct mmosal_task *task = mmosal_task_create(mmlog_tokenized_drain_task,
+                                                  NULL,
+                                                  MMOSAL_TASK_PRI_MIN,
+                                                  MMLOG_TOKENIZED_TASK_STACK_SIZE_U32,
+                                                  "mmlog");
+    MMOSAL_ASSERT(task != NULL);
+}
+
+#endif
@@ -175,6 +175,9 @@ void mmosal_impl_assert(void)
         mmosal_dump_failure_info();
 #endif
     }
+#if MMLOG_TOKENIZED_ENABLED
+    mmlog_tokenized_flush();
+#endif
     mmhal_log_flush();
     MMPORT_BREAKPOINT();
 #else
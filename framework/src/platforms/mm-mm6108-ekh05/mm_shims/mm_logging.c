@@ -44,6 +44,23 @@ void mm_logging_init(void)
 {
     log_mutex = mmosal_mutex_create("log");
     MMOSAL_ASSERT(log_mutex != NULL);
+#if MMLOG_TOKENIZED_ENABLED
+    mmlog_tokenized_init();
+#endif
+}
+
+void mm_logging_write(const uint8_t *data, size_t len)
+{
+    /* If it takes too long to get the mutex then we give up on this write. */
+    bool ok = morse_debug_mutex_take();
+    if (!ok)
+    {
+        return;
+    }
+
+    mmhal_log_write(data, len);
+
+    morse_debug_mutex_release();
 }
 
 /* Mutex must have been acquired before this function is invoked. */
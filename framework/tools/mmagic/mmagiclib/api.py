@@ -407,6 +407,16 @@ class Configuration:
     def datatype_is_raw(self, name: str):
         return name.startswith("raw")
 
+    def varlen_tail(self, args: List[Argument]):
+        """ Get the final argument if it is a string or raw type that can be sent at its used length """
+        if args and VARLEN_TYPE_REGEX.match(args[-1].type):
+            return args[-1]
+        return None
+
+    def varlen_extra_len(self, name: str):
+        """ Number of octets beyond the length field that are sent with a string or raw value """
+        return 1 if self.datatype_is_string(name) else 0
+
     def datatype_ref_prefix(self, name: str):
         if name.startswith("struct") or name.startswith("string") or name.startswith("raw"):
             return "&"
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+#
+# Copyright 2026 Morse Micro
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+
+"""
+Tool to decode tokenized MMLOG output (MMLOG_TOKENIZED_ENABLED=1) back into text.
+
+Each tokenized record contains the address of a log descriptor in the application image. The
+descriptor (format string, function name, line number and level) is read from the ELF file and
+used to format the raw arguments contained in the record. Any plain text in the log output (for
+example, from printf or MMLOG_APP) is passed through unchanged.
+"""
+
+import argparse
+import logging
+import re
+import struct
+import sys
+
+from elftools.elf.constants import SH_FLAGS
+from elftools.elf.elffile import ELFFile
+
+MMLOG_TOKENIZED_SYNC = 0x1e
+MMLOG_TOKENIZED_ID_DROPPED = 0
+
+RECORD_HDR_FMT = "<IIcc"
+RECORD_HDR_LEN = struct.calcsize(RECORD_HDR_FMT)
+
+CONVERSION_RE = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<precision>\*|\d*))?"
+    r"(?P<length>hh|h|ll|l|z|j|t|L)?(?P<conversion>[diuxXocpsfFeEgGaAn%])")
+
+
+class ImageReader:
+    """Provides access to the initialised contents of an ELF image by address."""
+
+    def __init__(self, elf_path):
+        with open(elf_path, "rb") as f:
+            elf = ELFFile(f)
+            self.ptr_size = elf.elfclass // 8
+            self.ptr_fmt = "<I" if self.ptr_size == 4 else "<Q"
+            self.segments = []
+            for section in elf.iter_sections():
+                if not section["sh_flags"] & SH_FLAGS.SHF_ALLOC:
+                    continue
+                if section["sh_type"] == "SHT_NOBITS" or section["sh_size"] == 0:
+                    continue
+                self.segments.append((section["sh_addr"], section.data()))
+        self.descriptors = {}
+
+    def read(self, addr, length):
+        for base, data in self.segments:
+            if base <= addr and addr + length <= base + len(data):
+                return data[addr - base:addr - base + length]
+        raise KeyError(f"Address 0x{addr:08x} not in image")
+
+    def read_ptr(self, addr):
+        return struct.unpack(self.ptr_fmt, self.read(addr, self.ptr_size))[0]
+
+    def read_str(self, addr):
+        for base, data in self.segments:
+            if base <= addr < base + len(data):
+                end = data.index(b"\0", addr - base)
+                return data[addr - base:end].decode("utf-8", errors="replace")
+        raise KeyError(f"Address 0x{addr:08x} not in image")
+
+    def descriptor(self, addr):
+        """Returns (fmt, function, line, level) for the descriptor at the given address."""
+        if addr not in self.descriptors:
+            fmt = self.read_str(self.read_ptr(addr))
+            function = self.read_str(self.read_ptr(addr + self.ptr_size))
+            line, level = struct.unpack("<Hc", self.read(addr + 2 * self.ptr_size, 3))
+            self.descriptors[addr] = (fmt, function, line, level.decode("ascii", "replace"))
+        return self.descriptors[addr]
+
+
+class ArgReader:
+    """Consumes encoded arguments from the payload of a record."""
+
+    def __init__(self, payload):
+        self.payload = payload
+        self.offset = 0
+
+    def _take(self, length):
+        if self.offset + length > len(self.payload):
+            raise EOFError
+        data = self.payload[self.offset:self.offset + length]
+        self.offset += length
+        return data
+
+    def integer(self, size, signed):
+        fmt = {(4, False): "<I", (4, True): "<i", (8, False): "<Q", (8, True): "<q"}[(size, signed)]
+        return struct.unpack(fmt, self._take(size))[0]
+
+    def double(self):
+        return struct.unpack("<d", self._take(8))[0]
+
+    def string(self):
+        length = self._take(1)[0]
+        return self._take(length).decode("utf-8", errors="replace")
+
+
+def format_message(fmt, args):
+    """Formats the given printf format string using arguments from the given ArgReader."""
+    out = []
+    pos = 0
+    try:
+        for match in CONVERSION_RE.finditer(fmt):
+            out.append(fmt[pos:match.start()])
+            pos = match.end()
+            conversion = match["conversion"]
+            if conversion == "%":
+                out.append("%")
+                continue
+
+            width = match["width"] or ""
+            if width == "*":
+                width = str(args.integer(4, True))
+            precision = match["precision"]
+            if precision == "*":
+                precision = str(args.integer(4, True))
+            spec = "%" + match["flags"] + width
+            if precision is not None:
+                spec += "." + precision
+
+            size = 8 if match["length"] in ("ll", "j") else 4
+            if conversion in "di":
+                out.append((spec + "d") % args.integer(size, True))
+            elif conversion in "uxXo":
+                out.append((spec + conversion) % args.integer(size, False))
+            elif conversion == "c":
+                out.append((spec + "c") % chr(args.integer(4, False) & 0xff))
+            elif conversion == "p":
+                out.append((spec + "s") % f"0x{args.integer(4, False):08x}")
+            elif conversion == "s":
+                out.append((spec + "s") % args.string())
+            elif conversion in "aA":
+                value = args.double().hex()
+                out.append((spec + "s") % (value.upper() if conversion == "A" else value))
+            elif conversion in "fFeEgG":
+                out.append((spec + conversion) % args.double())
+    except EOFError:
+        out.append("<truncated>")
+        return "".join(out) + ("\n" if fmt.endswith("\n") else "")
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+def decode_record(image, record):
+    """Decodes a single record (excluding the sync and length octets) to text."""
+    if len(record) < RECORD_HDR_LEN:
+        return "<short record>\n"
+
+    desc_addr, timestamp, task0, task1 = struct.unpack_from(RECORD_HDR_FMT, record)
+    task = (task0 + task1).decode("ascii", errors="replace").replace("\0", " ")
+    args = ArgReader(record[RECORD_HDR_LEN:])
+
+    if desc_addr == MMLOG_TOKENIZED_ID_DROPPED:
+        return f"! {timestamp:8d} {task} mmlog: {args.integer(4, False)} records dropped\n"
+
+    try:
+        fmt, function, line, level = image.descriptor(desc_addr)
+    except (KeyError, ValueError):
+        return f"? {timestamp:8d} {task} <unknown log id 0x{desc_addr:08x}>\n"
+
+    return f"{level} {timestamp:8d} {task} {function}[{line}] {format_message(fmt, args)}"
+
+
+def decode_stream(image, read, write):
+    """
+    Decodes a stream of log output.
+
+    :param image: ImageReader for the application image.
+    :param read: Function that takes a maximum length and returns bytes (empty at end of stream).
+    :param write: Function that takes a string to output.
+    """
+    buf = bytearray()
+    while True:
+        data = read(4096)
+        if not data:
+            break
+        buf.extend(data)
+
+        while buf:
+            if buf[0] != MMLOG_TOKENIZED_SYNC:
+                end = buf.find(MMLOG_TOKENIZED_SYNC)
+                if end < 0:
+                    end = len(buf)
+                write(buf[:end].decode("utf-8", errors="replace"))
+                del buf[:end]
+                continue
+
+            if len(buf) < 2 or len(buf) < buf[1] + 2:
+                break
+            record_len = buf[1]
+            write(decode_record(image, bytes(buf[2:2 + record_len])))
+            del buf[:2 + record_len]
+
+
+def _main():
+    parser = argparse.ArgumentParser(formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+                                     description=__doc__)
+    parser.add_argument("-v", "--verbose", action="count", default=0,
+                        help="Increase verbosity of log messages (repeat for increased verbosity)")
+    parser.add_argument("-p", "--port",
+                        help="Serial port to read log output from (requires pyserial)")
+    parser.add_argument("-b", "--baudrate", type=int, default=115200,
+                        help="Baud rate to use with --port")
+    parser.add_argument("elf", help="ELF file of the application that generated the log")
+    parser.add_argument("input", nargs="?", default="-",
+                        help="File containing captured log output ('-' for stdin). "
+                             "Ignored if --port is given.")
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.WARNING - 10 * args.verbose,
+                        format="%(levelname)s: %(message)s")
+
+    image = ImageReader(args.elf)
+    logging.info("Loaded %d sections from %s", len(image.segments), args.elf)
+
+    def write(text):
+        sys.stdout.write(text)
+        sys.stdout.flush()
+
+    if args.port:
+        import serial
+        with serial.Serial(args.port, args.baudrate, timeout=None) as port:
+            decode_stream(image, lambda n: port.read(max(1, min(n, port.in_waiting))), write)
+    elif args.input == "-":
+        decode_stream(image, sys.stdin.buffer.read1, write)
+    else:
+        with open(args.input, "rb") as f:
+            decode_stream(image, f.read, write)
+
+
+if __name__ == "__main__":
+    _main()